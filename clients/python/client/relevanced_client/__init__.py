@@ -4,9 +4,12 @@ from relevanced_client.gen_py.RelevancedProtocol.ttypes import (
     TException,
     EDocumentDoesNotExist,
     ECentroidDoesNotExist,
+    ECentroidNotYetLoaded,
     EDocumentAlreadyExists,
     ECentroidAlreadyExists,
     EDocumentNotInCentroid,
     EDocumentAlreadyInCentroid,
+    EUploadDoesNotExist,
+    ETooManyUploads,
     Language
 )
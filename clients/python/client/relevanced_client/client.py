@@ -239,6 +239,77 @@ class Client(object):
             document_text.encode('utf-8'), lang
         )
 
+    def begin_document_upload(self, lang=Language.EN, document_id=None):
+        """
+        Start creating a document whose text is too large to
+        send in one `create_document` call.  The text is then
+        sent with `append_document_upload`, and the document is
+        created by `commit_document_upload`.
+
+        If `document_id` is given, the document is created with
+        that ID, and `EDocumentAlreadyExists` is raised if one
+        already exists.  Otherwise the server generates a UUID.
+
+        Raises `ETooManyUploads` if the server already has its
+        maximum number of uploads in progress.  Uploads that go
+        unused for a while are discarded by the server.
+
+        Returns a `BeginDocumentUploadResponse`.  Its `uploadId`
+        property identifies the upload in the calls that follow.
+        """
+        if document_id is None:
+            return self.thrift_client.beginDocumentUpload(lang)
+        return self.thrift_client.beginDocumentUploadWithID(
+            document_id.encode('utf-8'), lang
+        )
+
+    def append_document_upload(self, upload_id, text_chunk):
+        """
+        Send the next piece of an upload's text.  Chunks may
+        split words; they are joined back together on the server.
+        Wait for each call to return before sending the next chunk.
+
+        Raises `EUploadDoesNotExist` if there is no upload
+        with ID `upload_id`, or it has already been committed,
+        aborted or discarded for being idle.
+        """
+        if not isinstance(text_chunk, bytes):
+            text_chunk = text_chunk.encode('utf-8')
+        return self.thrift_client.appendDocumentUpload(upload_id, text_chunk)
+
+    def commit_document_upload(self, upload_id):
+        """
+        Create the document from all of the text sent to the
+        upload `upload_id`.
+
+        Returns a `CreateDocumentResponse` like `create_document`.
+        """
+        return self.thrift_client.commitDocumentUpload(upload_id)
+
+    def abort_document_upload(self, upload_id):
+        """
+        Discard the upload `upload_id` without creating a document.
+        """
+        return self.thrift_client.abortDocumentUpload(upload_id)
+
+    def upload_document(self, text_chunks, lang=Language.EN, document_id=None):
+        """
+        Create a document from an iterable of text chunks (for
+        instance, a file read a block at a time) using
+        `begin_document_upload`, `append_document_upload` and
+        `commit_document_upload`.
+
+        Returns a `CreateDocumentResponse`.
+        """
+        upload_id = self.begin_document_upload(lang, document_id).uploadId
+        try:
+            for chunk in text_chunks:
+                self.append_document_upload(upload_id, chunk)
+        except Exception:
+            self.abort_document_upload(upload_id)
+            raise
+        return self.commit_document_upload(upload_id)
+
     def delete_document(self, document_id, ignore_missing=False):
         """
         Delete the document with id = `document_id`.
@@ -322,6 +393,28 @@ class Client(object):
         request.ignoreMissing = ignore_missing
         return self.thrift_client.joinCentroid(request)
 
+    def rebuild_centroid(self, centroid_id, ignore_missing=False):
+        """
+        Recalculate a centroid from all of its documents,
+        discarding any incrementally tracked changes, and
+        return once the recalculation is complete.
+
+        The server normally applies document additions and
+        removals to a centroid incrementally; this forces
+        a full recalculation instead, and is mainly useful
+        for repairing a centroid.
+
+        Returns a `JoinCentroidResponse`.
+
+        If no centroid exists with the given ID, raises
+        `ECentroidDoesNotExist` unless `ignore_missing=True`
+        is passed.
+        """
+        request = JoinCentroidRequest()
+        request.id = centroid_id
+        request.ignoreMissing = ignore_missing
+        return self.thrift_client.rebuildCentroid(request)
+
     def multi_join_centroids(self, centroid_ids, ignore_missing=False):
         """
         Synchronize with the server-side centroid
@@ -453,6 +546,27 @@ class Client(object):
             centroid_ids, text.encode('utf-8'), lang
         )
 
+    def multi_get_text_similarity_batch(self, texts, centroid_ids, lang=Language.EN):
+        """
+        Calculate the cosine similarity of each blob of text in
+        `texts` against each of the centroids in `centroid_ids`,
+        in a single round-trip.
+
+        Returns a `MultiSimilarityBatchResponse`.  Its `responses`
+        property is a list of `MultiSimilarityResponse` objects,
+        one per text and in the same order as `texts`.
+
+        If any of the centroids do not exist, raises
+        `ECentroidDoesNotExist`.
+        """
+
+        if isinstance(centroid_ids, basestring):
+            centroid_ids = [centroid_ids]
+
+        return self.thrift_client.multiGetTextSimilarityBatch(
+            [text.encode('utf-8') for text in texts], centroid_ids, lang
+        )
+
     def multi_get_document_similarity(self, centroid_ids, document_id):
         """
         Calculate the cosine similarity of document with id
@@ -487,6 +601,50 @@ class Client(object):
             centroid_ids, text.encode('utf-8')
         )
 
+    def get_text_best_matching_centroids(self, text, count, lang=Language.EN):
+        """
+        Return the `count` centroids most similar to `text`,
+        highest score first.
+
+        Returns a `BestMatchingCentroidsResponse`.  Its `centroids`
+        property is a list of `ScoredCentroidDTO` objects, each
+        with an `id` and a cosine similarity `score`.
+
+        This is much cheaper than scoring against every centroid
+        and sorting on the client: the server skips centroids
+        that cannot make the cut, and only `count` scores are
+        sent back.
+
+        Example:
+            response = client.get_text_best_matching_centroids(
+                'this is some text', 2
+            )
+            pprint([(c.id, c.score) for c in response.centroids])
+            # [("centroid2", 0.3921579), ("centroid1", 0.08731412)]
+        """
+
+        return self.thrift_client.getTextBestMatchingCentroids(
+            text.encode('utf-8'), lang, count
+        )
+
+    def get_document_best_matching_centroids(self, document_id, count):
+        """
+        Return the `count` centroids most similar to the document
+        with id `document_id`, highest score first.
+
+        The document must already exist on the server.
+
+        Returns a `BestMatchingCentroidsResponse`, as with
+        `get_text_best_matching_centroids`.
+
+        If the document does not exist, raises
+        `EDocumentDoesNotExist`.
+        """
+
+        return self.thrift_client.getDocumentBestMatchingCentroids(
+            document_id, count
+        )
+
     def get_document_similarity(self, centroid_id, document_id):
         """
         Return cosine similarity of document with ID `document_id`
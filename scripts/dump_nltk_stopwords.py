@@ -1,4 +1,4 @@
-from nltk.corpus import stopwords
+import io
 import sys
 HEX_1 = 16**3
 HEX_2 = 16**2
@@ -6,6 +6,16 @@ HEX_3 = 16
 HEX_4 = 1
 digit_to_hex = {i: k for i, k in enumerate('0123456789abcdef')}
 
+MASK_64 = 0xFFFFFFFFFFFFFFFF
+
+# these must match `text_util::fnv1a64` and `stopwordSlot`
+# in src/stopwords/StopwordTable.h.
+FNV_OFFSET = 14695981039346656037
+FNV_PRIME = 1099511628211
+DISPLACEMENT_MULTIPLIER = 0x9E3779B97F4A7C15
+SLOT_MULTIPLIER = 0xFF51AFD7ED558CCD
+MAX_DISPLACEMENT = 0xFFFF
+
 def get_hex(an_int):
     out = []
     for place in (HEX_1, HEX_2, HEX_3, HEX_4):
@@ -24,52 +34,149 @@ def reencode_word(word):
 
     return str(''.join(out))
 
+def fnv1a64(data):
+    hash_value = FNV_OFFSET
+    for byte in bytearray(data):
+        hash_value ^= byte
+        hash_value = (hash_value * FNV_PRIME) & MASK_64
+    return hash_value
+
+def stopword_slot(hash_value, displacement, slot_bits):
+    mixed = hash_value ^ ((displacement * DISPLACEMENT_MULTIPLIER) & MASK_64)
+    mixed = (mixed * SLOT_MULTIPLIER) & MASK_64
+    return mixed >> (64 - slot_bits)
+
+def next_power_of_2(n):
+    power = 1
+    while power < n:
+        power *= 2
+    return power
+
+def log_2(n):
+    bits = 0
+    while (1 << bits) < n:
+        bits += 1
+    return bits
+
+def build_perfect_hash(hashes):
+    # hash and displace: keys are split into small buckets, and each
+    # bucket gets the first displacement that sends all of its keys
+    # to free slots.  A lookup reads one displacement and probes
+    # exactly one slot.
+    slot_count = next_power_of_2(len(hashes) * 5 / 4 + 1)
+    slot_bits = log_2(slot_count)
+    bucket_count = next_power_of_2(len(hashes) / 4 + 1)
+    buckets = [[] for _ in xrange(bucket_count)]
+    for hash_value in hashes:
+        buckets[(hash_value >> 40) & (bucket_count - 1)].append(hash_value)
+    displacements = [0] * bucket_count
+    slots = [None] * slot_count
+    order = sorted(xrange(bucket_count), key=lambda i: -len(buckets[i]))
+    for bucket_index in order:
+        bucket = buckets[bucket_index]
+        if not bucket:
+            continue
+        for displacement in xrange(MAX_DISPLACEMENT + 1):
+            candidates = [stopword_slot(h, displacement, slot_bits) for h in bucket]
+            if len(set(candidates)) != len(candidates):
+                continue
+            if any(slots[c] is not None for c in candidates):
+                continue
+            for h, c in zip(bucket, candidates):
+                slots[c] = h
+            displacements[bucket_index] = displacement
+            break
+        else:
+            raise ValueError('no displacement found; try a larger table')
+    return slot_bits, displacements, slots
+
+def generate_impl(language, words):
+    func_name = 'is%sStopword' % language.title()
+    table_name = 'k%sStopwords' % language.title()
+    unique_words = sorted(set(words))
+    hashes = {}
+    for word in unique_words:
+        hashes[fnv1a64(word.encode('utf-8'))] = word
+    if len(hashes) != len(unique_words):
+        raise ValueError('fnv1a64 collision between stopwords')
+    slot_bits, displacements, slots = build_perfect_hash(hashes.keys())
+
+    print '// generated by scripts/dump_nltk_stopwords.py; do not edit.'
+    print ''
+    print '#include <cstdint>'
+    print '#include "stopwords/%s_stopwords.h"' % language
+    print '#include "stopwords/StopwordTable.h"'
+    print '#include "text_util/StringView.h"'
+    print ''
+    print 'namespace relevanced {'
+    print 'namespace stopwords {'
+    print ''
+    print 'namespace {'
+    print ''
+    print 'const uint16_t kDisplacements[%d] = {' % len(displacements)
+    for i in xrange(0, len(displacements), 12):
+        row = displacements[i:i + 12]
+        print '  %s,' % ', '.join(str(d) for d in row)
+    print '};'
+    print ''
+    print 'const StopwordEntry kEntries[%d] = {' % len(slots)
+    for hash_value in slots:
+        if hash_value is None:
+            print '  {0, "", 0},'
+        else:
+            word = hashes[hash_value]
+            print '  {%dULL, "%s", %d},' % (
+                hash_value, reencode_word(word), len(word.encode('utf-8'))
+            )
+    print '};'
+    print ''
+    print '} // anonymous namespace'
+    print ''
+    print 'const StopwordTable %s {' % table_name
+    print '  kDisplacements, %d, kEntries, %d' % (len(displacements) - 1, slot_bits)
+    print '};'
+    print ''
+    print 'bool %s(const text_util::StringView &word, uint64_t hash) {' % func_name
+    print '  return %s.contains(word, hash);' % table_name
+    print '}'
+    print ''
+    print '} // stopwords'
+    print '} // relevanced'
+
+def generate_header(language):
+    func_name = 'is%sStopword' % language.title()
+    print '#pragma once'
+    print '#include <cstdint>'
+    print '#include "text_util/StringView.h"'
+    print ''
+    print 'namespace relevanced {'
+    print 'namespace stopwords {'
+    print ''
+    print '// `hash` is `text_util::fnv1a64` of the word.'
+    print 'bool %s(const text_util::StringView &word, uint64_t hash);' % func_name
+    print ''
+    print '} // stopwords'
+    print '} // relevanced'
+
+def read_words(path):
+    with io.open(path, encoding='utf-8') as f:
+        return [line.strip() for line in f if line.strip()]
+
 if __name__ == '__main__':
     if len(sys.argv) < 3 or sys.argv[2] not in ('header', 'impl'):
-        raise ValueError('usage: <script> $language header|impl')
+        raise ValueError(
+            'usage: <script> $language header|impl [word_list_file]'
+        )
 
     language = sys.argv[1]
-    func_name = 'is%sStopword' % language.title()
 
     if sys.argv[2] == 'impl':
-        words = map(reencode_word, stopwords.words(language))
-
-        print '#include <string>'
-        print '#include <unordered_set>'
-        print '#include "stopwords/%s_stopwords.h"' % language
-        print ''
-        print 'using namespace std;'
-        print ''
-        print 'namespace relevanced {'
-        print 'namespace stopwords {'
-        print ''
-
-        print 'const unordered_set<string> stopwordSet {'
-        for i in xrange(len(words)):
-            word = words[i]
-            line = '  "%s"' % word
-            if i < (len(words) - 1):
-                line += ','
-            print line
-        print '};'
-
-        print ''
-        print 'bool %s(const string &word) {' % func_name
-        print '  return stopwordSet.count(word) > 0;'
-        print '}'
-
-        print ''
-        print '} // stopwords'
-        print '} // relevanced'
-        print ''
+        if len(sys.argv) > 3:
+            # one UTF-8 word per line, instead of NLTK's list
+            words = read_words(sys.argv[3])
+        else:
+            from nltk.corpus import stopwords
+            words = stopwords.words(language)
+        generate_impl(language, words)
     elif sys.argv[2] == 'header':
-        print '#include <string>'
-        print ''
-        print 'namespace relevanced {'
-        print 'namespace stopwords {'
-        print ''
-        print 'bool %s(const std::string &word);' % func_name
-        print ''
-        print '} // stopwords'
-        print '} // relevanced'
-        print ''
+        generate_header(language)
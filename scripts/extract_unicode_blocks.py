@@ -1,10 +1,9 @@
 from collections import namedtuple
+import os
+import re
 import sys
 from pprint import pprint
 
-import requests
-from bs4 import BeautifulSoup
-
 UnicodeBlock = namedtuple('UnicodeBlock', ['name', 'start', 'end'])
 
 
@@ -140,28 +139,183 @@ def generate_get_block(blocks):
     print '}\n\n'
 
 
+# the code point table is generated against the existing enum,
+# so that regenerating it never renumbers `UnicodeBlock`.
+ENUM_HEADER = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    '..', 'src', 'libunicode', 'UnicodeBlock.h'
+)
+
+# code points per second-level page of the table.
+TABLE_PAGE_BITS = 7
+MAX_CODE_POINT = 0x10FFFF
+
+NON_LETTER_BLOCKS = set([
+    'ARROWS', 'BLOCK_ELEMENTS', 'BOX_DRAWING', 'BRAILLE_PATTERNS',
+    'COMBINING_DIACRITICAL_MARKS', 'COMBINING_DIACRITICAL_MARKS_EXTENDED',
+    'CONTROL_PICTURES', 'DINGBATS', 'DOMINO_TILES', 'EMOTICONS',
+    'ENCLOSED_ALPHANUMERICS', 'GENERAL_PUNCTUATION', 'GEOMETRIC_SHAPES',
+    'IPA_EXTENSIONS', 'MATHEMATICAL_OPERATORS',
+    'MISCELLANEOUS_MATHEMATICAL_SYMBOLS_A',
+    'MISCELLANEOUS_MATHEMATICAL_SYMBOLS_B', 'MISCELLANEOUS_SYMBOLS',
+    'MISCELLANEOUS_SYMBOLS_AND_ARROWS', 'MISCELLANEOUS_TECHNICAL',
+    'MUSICAL_SYMBOLS', 'NUMBER_FORMS', 'SPACING_MODIFIER_LETTERS',
+    'SUPERSCRIPTS_AND_SUBSCRIPTS', 'SUPPLEMENTAL_MATHEMATICAL_OPERATORS',
+    'SUPPLEMENTAL_PUNCTUATION'
+])
+
+
+def enum_block_names():
+    with open(ENUM_HEADER) as f:
+        header = f.read()
+    body = header[header.index('enum class UnicodeBlock {'):]
+    body = body[:body.index('};')]
+    return re.findall(r'^\s+([A-Z0-9_]+),?\s*$', body, re.M)
+
+
+def lowercase_offset(cp, block_name):
+    if block_name == 'BASIC_LATIN':
+        if 65 <= cp <= 90:
+            return 32
+    elif block_name == 'LATIN_1_SUPPLEMENT':
+        if 192 <= cp <= 214 or 216 <= cp <= 221:
+            return 32
+    elif block_name == 'LATIN_EXTENDED_A':
+        # up to 311, latin A alternates between upper and lower
+        # case versions with uppers on even numbers.  383 (the
+        # small long S) has no capital.
+        if cp < 311 and cp % 2 == 0:
+            return 1
+    return 0
+
+
+def is_letter(cp, block_name):
+    if block_name == 'BASIC_LATIN':
+        # punctuation, digits, brackets etc.
+        return not (cp <= 64 or 91 <= cp <= 96 or cp > 122)
+    if block_name == 'LATIN_1_SUPPLEMENT':
+        # punctuation up to the inverted question mark (191),
+        # then the multiplication and division signs.
+        return not (cp <= 191 or cp in (215, 247))
+    return block_name not in NON_LETTER_BLOCKS
+
+
+def generate_table(blocks):
+    names = enum_block_names()
+    ordinals = dict((name, i) for i, name in enumerate(names))
+    unknown = ordinals['UNKNOWN']
+    by_code_point = [unknown] * (MAX_CODE_POINT + 1)
+    block_names = [None] * (MAX_CODE_POINT + 1)
+    for block in blocks:
+        name = codify_name(block.name)
+        if name not in ordinals:
+            continue
+        for cp in xrange(block.start, block.end + 1):
+            by_code_point[cp] = ordinals[name]
+            block_names[cp] = name
+
+    page_size = 1 << TABLE_PAGE_BITS
+    pages = []
+    page_ids = {}
+    page_index = []
+    for page_start in xrange(0, MAX_CODE_POINT + 1, page_size):
+        page = []
+        for cp in xrange(page_start, page_start + page_size):
+            name = block_names[cp]
+            page.append((
+                by_code_point[cp],
+                lowercase_offset(cp, name),
+                1 if is_letter(cp, name) else 0
+            ))
+        page = tuple(page)
+        if page not in page_ids:
+            page_ids[page] = len(pages)
+            pages.append(page)
+        page_index.append(page_ids[page])
+
+    print '// generated by scripts/extract_unicode_blocks.py; do not edit.'
+    print ''
+    print '#include <cstdint>'
+    print '#include "libunicode/UnicodeBlock.h"'
+    print '#include "libunicode/code_point_table.h"'
+    print ''
+    print 'namespace relevanced {'
+    print 'namespace libunicode {'
+    print ''
+    print 'static_assert((uint16_t) UnicodeBlock::UNKNOWN == %d,' % unknown
+    print '  "UnicodeBlock changed; regenerate the code point table");'
+    print 'static_assert(kCodePointPageBits == %d,' % TABLE_PAGE_BITS
+    print '  "page size changed; regenerate the code point table");'
+    print ''
+    print 'const uint16_t kCodePointPageIndex[%d] = {' % len(page_index)
+    for i in xrange(0, len(page_index), 16):
+        row = page_index[i:i + 16]
+        print '  %s,' % ', '.join(str(x) for x in row)
+    print '};'
+    print ''
+    print 'const CodePointInfo kCodePointPages[%d][%d] = {' % (len(pages), page_size)
+    for page in pages:
+        print '  {'
+        for i in xrange(0, page_size, 8):
+            row = page[i:i + 8]
+            print '    %s,' % ', '.join('{%d, %d, %d}' % entry for entry in row)
+        print '  },'
+    print '};'
+    print ''
+    print '} // libunicode'
+    print '} // relevanced'
+
+
+def fetch_wikipedia_blocks():
+    import requests
+    from bs4 import BeautifulSoup
+    page = requests.get('https://en.wikipedia.org/wiki/Unicode_block')
+    soup = BeautifulSoup(page.content)
+    table = soup.select('.wikitable')[0]
+
+    # 3 header rows at top, 1 footnote row at bottom
+    rows = table.findAll('tr')[3:-1]
+    return map(extract_row, rows)
+
+
+def read_blocks_file(path):
+    # Unicode's own Blocks.txt: `0000..007F; Basic Latin`
+    blocks = []
+    with open(path) as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if not line:
+                continue
+            code_range, name = line.split(';')
+            start, end = code_range.strip().split('..')
+            blocks.append(UnicodeBlock(
+                name=name.strip(),
+                start=int(start, 16),
+                end=int(end, 16)
+            ))
+    return blocks
+
+
 def throw_usage(args, allowed_keys):
     pprint(args)
     keys = '|'.join(sorted(allowed_keys))
-    message = 'usage: <script> %s' % allowed_keys
+    message = 'usage: <script> %s [path/to/Blocks.txt]' % keys
     raise ValueError(message)
 
 if __name__ == '__main__':
     funcs = {
         'get_block': generate_get_block,
         'string_of': generate_string_of_block,
-        'enum': generate_enum
+        'enum': generate_enum,
+        'table': generate_table
     }
     args = sys.argv
     if len(args) < 2:
         throw_usage(args, funcs.keys())
     if args[1] not in funcs.keys():
         throw_usage(args, funcs.keys())
-    page = requests.get('https://en.wikipedia.org/wiki/Unicode_block')
-    soup = BeautifulSoup(page.content)
-    table = soup.select('.wikitable')[0]
-
-    # 3 header rows at top, 1 footnote row at bottom
-    rows = table.findAll('tr')[3:-1]
-    blocks = map(extract_row, rows)
+    if len(args) > 2:
+        blocks = read_blocks_file(args[2])
+    else:
+        blocks = fetch_wikipedia_blocks()
     funcs[sys.argv[1]](blocks)
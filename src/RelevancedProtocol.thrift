@@ -10,6 +10,8 @@ enum Language  {
     FR,
     IT,
     RU,
+    // detected per document by the server
+    AUTO = 253,
     OTHER = 254
 }
 
@@ -45,10 +47,15 @@ struct ProcessedDocumentMetadataDTO {
     4: required i64 updated;
 }
 
+// `terms[i]` has weight `weights[4*i..4*i+4]` (little-endian float32).
+// records written before these fields existed carry `scoredWords`
+// instead, which is still read but no longer written.
 struct ProcessedDocumentPersistenceDTO {
     1: required ProcessedDocumentMetadataDTO metadata;
-    2: required list<ScoredWordDTO> scoredWords;
+    2: optional list<ScoredWordDTO> scoredWords;
     3: required double magnitude;
+    4: optional list<binary> terms;
+    5: optional binary weights;
 }
 
 struct ProcessedDocumentDTO {
@@ -72,6 +79,19 @@ struct MultiSimilarityResponse {
     1: required map<string, double> scores;
 }
 
+struct MultiSimilarityBatchResponse {
+    1: required list<MultiSimilarityResponse> responses;
+}
+
+struct ScoredCentroidDTO {
+    1: required string id;
+    2: required double score;
+}
+
+struct BestMatchingCentroidsResponse {
+    1: required list<ScoredCentroidDTO> centroids;
+}
+
 struct ListCentroidDocumentsResponse {
     1: required list<string> documents;
 }
@@ -88,6 +108,10 @@ struct CreateDocumentResponse {
     1: required string id;
 }
 
+struct BeginDocumentUploadResponse {
+    1: required string uploadId;
+}
+
 struct DeleteDocumentRequest {
     1: required string id;
     2: optional bool ignoreMissing;
@@ -196,6 +220,13 @@ exception ECentroidDoesNotExist {
     2: string message;
 }
 
+// raised while the server is still loading centroids at startup
+// (see `background_centroid_loading`); safe to retry.
+exception ECentroidNotYetLoaded {
+    1: string id;
+    2: string message;
+}
+
 exception ECentroidAlreadyExists {
     1: string id;
     2: string message;
@@ -211,6 +242,17 @@ exception EDocumentAlreadyExists {
     2: string message;
 }
 
+exception EUploadDoesNotExist {
+    1: string id;
+    2: string message;
+}
+
+// raised by `beginDocumentUpload` while the server already has as
+// many uploads in progress as it allows; safe to retry later.
+exception ETooManyUploads {
+    1: string message;
+}
+
 exception EDocumentNotInCentroid {
     1: string documentId;
     2: string centroidId;
@@ -227,13 +269,21 @@ service Relevanced {
     void ping(),
     map<string, string> getServerMetadata(),
 
-    double getDocumentSimilarity(1: string centroidId, 2: string docId) throws (1: ECentroidDoesNotExist centroidErr, 2: EDocumentDoesNotExist docErr),
-    MultiSimilarityResponse multiGetDocumentSimilarity(1: list<string> centroidIds, 2: string documentId) throws (1: ECentroidDoesNotExist centroidErr, 2: EDocumentDoesNotExist docErr),
-    double getTextSimilarity(1: string centroidId, 2: string text, 3: Language lang) throws (1: ECentroidDoesNotExist err),
-    MultiSimilarityResponse multiGetTextSimilarity(1: list<string> centroidIds, 2: string text, 3: Language lang) throws (1: ECentroidDoesNotExist err),
-    double getCentroidSimilarity(1: string centroid1Id, 2: string centroid2Id) throws (1: ECentroidDoesNotExist err),
+    double getDocumentSimilarity(1: string centroidId, 2: string docId) throws (1: ECentroidDoesNotExist centroidErr, 2: EDocumentDoesNotExist docErr, 3: ECentroidNotYetLoaded loadingErr),
+    MultiSimilarityResponse multiGetDocumentSimilarity(1: list<string> centroidIds, 2: string documentId) throws (1: ECentroidDoesNotExist centroidErr, 2: EDocumentDoesNotExist docErr, 3: ECentroidNotYetLoaded loadingErr),
+    double getTextSimilarity(1: string centroidId, 2: string text, 3: Language lang) throws (1: ECentroidDoesNotExist err, 2: ECentroidNotYetLoaded loadingErr),
+    MultiSimilarityResponse multiGetTextSimilarity(1: list<string> centroidIds, 2: string text, 3: Language lang) throws (1: ECentroidDoesNotExist err, 2: ECentroidNotYetLoaded loadingErr),
+    MultiSimilarityBatchResponse multiGetTextSimilarityBatch(1: list<string> texts, 2: list<string> centroidIds, 3: Language lang) throws (1: ECentroidDoesNotExist err, 2: ECentroidNotYetLoaded loadingErr),
+    BestMatchingCentroidsResponse getTextBestMatchingCentroids(1: string text, 2: Language lang, 3: i32 count),
+    BestMatchingCentroidsResponse getDocumentBestMatchingCentroids(1: string documentId, 2: i32 count) throws (1: EDocumentDoesNotExist err),
+    double getCentroidSimilarity(1: string centroid1Id, 2: string centroid2Id) throws (1: ECentroidDoesNotExist err, 2: ECentroidNotYetLoaded loadingErr),
     CreateDocumentResponse createDocument(1: string text, 2: Language language),
     CreateDocumentResponse createDocumentWithID(1: string id, 2: string text, 3: Language language) throws (1: EDocumentAlreadyExists err),
+    BeginDocumentUploadResponse beginDocumentUpload(1: Language language) throws (1: ETooManyUploads err),
+    BeginDocumentUploadResponse beginDocumentUploadWithID(1: string id, 2: Language language) throws (1: EDocumentAlreadyExists err, 2: ETooManyUploads limitErr),
+    void appendDocumentUpload(1: string uploadId, 2: string text) throws (1: EUploadDoesNotExist err),
+    CreateDocumentResponse commitDocumentUpload(1: string uploadId) throws (1: EUploadDoesNotExist uploadErr, 2: EDocumentAlreadyExists docErr),
+    void abortDocumentUpload(1: string uploadId) throws (1: EUploadDoesNotExist err),
     DeleteDocumentResponse deleteDocument(1: DeleteDocumentRequest request) throws (1: EDocumentDoesNotExist err),
     MultiDeleteDocumentsResponse multiDeleteDocuments(1: MultiDeleteDocumentsRequest request) throws (1: EDocumentDoesNotExist err),
     GetDocumentMetadataResponse getDocumentMetadata(1: string id) throws (1: EDocumentDoesNotExist err),
@@ -250,6 +300,7 @@ service Relevanced {
     RemoveDocumentsFromCentroidResponse removeDocumentsFromCentroid(1: RemoveDocumentsFromCentroidRequest request) throws (1: ECentroidDoesNotExist centroidErr, 2: EDocumentDoesNotExist docErr, 3: EDocumentNotInCentroid bothErr),
     JoinCentroidResponse joinCentroid(1: JoinCentroidRequest request) throws (1: ECentroidDoesNotExist err),
     MultiJoinCentroidsResponse multiJoinCentroids(1: MultiJoinCentroidsRequest request) throws (1: ECentroidDoesNotExist err),
+    JoinCentroidResponse rebuildCentroid(1: JoinCentroidRequest request) throws (1: ECentroidDoesNotExist err),
     ListCentroidsResponse listAllCentroids(),
     ListCentroidsResponse listCentroidRange(1: i64 offset, 2: i64 count),
     ListCentroidsResponse listCentroidRangeFromID(1: string centroidId, 2: i64 count),
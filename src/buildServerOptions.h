@@ -25,7 +25,12 @@ std::map<std::string, std::string> getEnvSettings() {
       {"RELEVANCED_ROCKSDB_THREADS", "rocks_db_threads"},
       {"RELEVANCED_DOCUMENT_PROCESSING_THREADS", "document_processing_threads"},
       {"RELEVANCED_SIMILARITY_SCORE_THREADS", "similarity_score_threads"},
-      {"RELEVANCED_CENTROID_UPDATE_THREADS", "centroid_update_threads"}};
+      {"RELEVANCED_CENTROID_UPDATE_THREADS", "centroid_update_threads"},
+      {"RELEVANCED_CENTROID_ACCUMULATION_THREADS",
+       "centroid_accumulation_threads"},
+      {"RELEVANCED_BACKGROUND_CENTROID_LOADING",
+       "background_centroid_loading"},
+      {"RELEVANCED_BIGRAM_BITS", "bigram_bits"}};
   std::map<std::string, std::string> output;
   for (auto &elem : envVarMap) {
     char *charVal = getenv(elem.first.c_str());
@@ -81,6 +86,12 @@ std::shared_ptr<RelevanceServerOptions> buildOptions() {
       options->setCentroidUpdateThreadCount(
           folly::convertTo<int>(confCentroidUpdateThreads->second));
     }
+    auto confAccumulationThreads =
+        parsedConf.find("centroid_accumulation_threads");
+    if (confAccumulationThreads != confItems.end()) {
+      options->setCentroidAccumulationThreadCount(
+          folly::convertTo<int>(confAccumulationThreads->second));
+    }
     auto confProcessingThreads = parsedConf.find("document_processing_threads");
     if (confProcessingThreads != confItems.end()) {
       options->setDocumentProcessingThreadCount(
@@ -91,6 +102,16 @@ std::shared_ptr<RelevanceServerOptions> buildOptions() {
       options->setSimilarityScoreThreadCount(
           folly::convertTo<int>(confScoringThreads->second));
     }
+    auto confBackgroundLoading =
+        parsedConf.find("background_centroid_loading");
+    if (confBackgroundLoading != confItems.end()) {
+      options->setBackgroundCentroidLoading(
+          folly::convertTo<bool>(confBackgroundLoading->second));
+    }
+    auto confBigramBits = parsedConf.find("bigram_bits");
+    if (confBigramBits != confItems.end()) {
+      options->setBigramBits(folly::convertTo<int>(confBigramBits->second));
+    }
   }
 
   {
@@ -113,6 +134,12 @@ std::shared_ptr<RelevanceServerOptions> buildOptions() {
       options->setCentroidUpdateThreadCount(
           folly::to<int>(envUpdatingThreads.value()));
     }
+    auto envAccumulationThreads =
+        folly::get_optional(envSettings, "centroid_accumulation_threads");
+    if (envAccumulationThreads.hasValue()) {
+      options->setCentroidAccumulationThreadCount(
+          folly::to<int>(envAccumulationThreads.value()));
+    }
     auto envProcessingThreads =
         folly::get_optional(envSettings, "document_processing_threads");
     if (envProcessingThreads.hasValue()) {
@@ -125,6 +152,16 @@ std::shared_ptr<RelevanceServerOptions> buildOptions() {
       options->setSimilarityScoreThreadCount(
           folly::to<int>(envScoringThreads.value()));
     }
+    auto envBackgroundLoading =
+        folly::get_optional(envSettings, "background_centroid_loading");
+    if (envBackgroundLoading.hasValue()) {
+      options->setBackgroundCentroidLoading(
+          folly::to<bool>(envBackgroundLoading.value()));
+    }
+    auto envBigramBits = folly::get_optional(envSettings, "bigram_bits");
+    if (envBigramBits.hasValue()) {
+      options->setBigramBits(folly::to<int>(envBigramBits.value()));
+    }
   }
 
   if (FLAGS_data_dir.size() > 0) {
@@ -139,6 +176,10 @@ std::shared_ptr<RelevanceServerOptions> buildOptions() {
   if (FLAGS_centroid_update_threads > 0) {
     options->setCentroidUpdateThreadCount(FLAGS_centroid_update_threads);
   }
+  if (FLAGS_centroid_accumulation_threads > 0) {
+    options->setCentroidAccumulationThreadCount(
+        FLAGS_centroid_accumulation_threads);
+  }
   if (FLAGS_document_processing_threads > 0) {
     options->setDocumentProcessingThreadCount(
         FLAGS_document_processing_threads);
@@ -147,6 +188,13 @@ std::shared_ptr<RelevanceServerOptions> buildOptions() {
     options->setSimilarityScoreThreadCount(FLAGS_similarity_score_threads);
   }
 
+  if (FLAGS_background_centroid_loading) {
+    options->setBackgroundCentroidLoading(true);
+  }
+  if (FLAGS_bigram_bits > 0) {
+    options->setBigramBits(FLAGS_bigram_bits);
+  }
+
   options->setIntegrationTestMode(FLAGS_integration_test_mode);
   return options;
 }
@@ -19,6 +19,7 @@
 
 #include "models/Centroid.h"
 #include "models/ProcessedDocument.h"
+#include "models/SparseVector.h"
 #include "models/WordVector.h"
 #include "gen-cpp2/RelevancedProtocol_types.h"
 #include "persistence/Persistence.h"
@@ -28,10 +29,13 @@
 
 using namespace std;
 using namespace folly;
+using wangle::CPUThreadPoolExecutor;
+using wangle::FutureExecutor;
 
 namespace relevanced {
 namespace centroid_update_worker {
 using models::WordVector;
+using models::SparseVector;
 using models::Centroid;
 using models::ProcessedDocument;
 using thrift_protocol::ECentroidDoesNotExist;
@@ -42,11 +46,13 @@ CentroidUpdater::CentroidUpdater(
     shared_ptr<persistence::CentroidMetadataDbIf> metadataDb,
     shared_ptr<util::ClockIf> clock,
     shared_ptr<DocumentAccumulatorFactoryIf> accumulatorFactory,
+    shared_ptr<FutureExecutor<CPUThreadPoolExecutor>> accumulationPool,
     string centroidId)
     : persistence_(persistence),
       centroidMetadataDb_(metadataDb),
       clock_(clock),
       accumulatorFactory_(accumulatorFactory),
+      accumulationPool_(accumulationPool),
       centroidId_(centroidId) {}
 
 Try<bool> CentroidUpdater::run() {
@@ -57,9 +63,113 @@ Try<bool> CentroidUpdater::run() {
   }
 
   const uint64_t startTimestamp = clock_->getEpochTime();
-  const size_t idListBatchSize = 500;
-  const size_t documentBatchSize = 20;
+  auto changes = persistence_->takeCentroidDocumentChanges(centroidId_).get();
+  if (!changes.needsFullRebuild) {
+    auto result = runIncremental(changes, startTimestamp);
+    if (result.hasValue()) {
+      persistence_->finishCentroidUpdate(
+        centroidId_, !result.value().hasException()
+      ).get();
+      return result.value();
+    }
+
+    // hand the changes back as unapplied, and take the
+    // centroid again for a full rebuild.
+    persistence_->finishCentroidUpdate(centroidId_, false).get();
+    changes = persistence_->takeCentroidDocumentChanges(centroidId_).get();
+  }
+  auto result = runFullRebuild(startTimestamp);
+  persistence_->finishCentroidUpdate(
+    centroidId_, !result.hasException()
+  ).get();
+  return result;
+}
+
+Optional<Try<bool>> CentroidUpdater::runIncremental(
+    const persistence::CentroidDocumentChanges &changes,
+    uint64_t startTimestamp) {
+  Optional<Try<bool>> result;
+  auto existing = persistence_->loadCentroid(centroidId_).get();
+  if (existing.hasException()) {
+    result.assign(Try<bool>(existing.exception()));
+    return result;
+  }
+  auto accumulator = accumulatorFactory_->get();
+  accumulator->initialize(existing.value()->wordVector);
+
+  auto removedDocuments = loadDocuments(changes.removed);
+  for (size_t i = 0; i < removedDocuments.size(); i++) {
+    auto &doc = removedDocuments.at(i);
+    if (!doc.hasValue()) {
+      LOG(INFO) << format(
+          "document '{}' removed from centroid '{}' no longer exists; "
+          "falling back to a full rebuild.",
+          changes.removed.at(i), centroidId_);
+      return result;
+    }
+    accumulator->removeDocument(doc.value().get());
+  }
+
+  auto addedDocuments = loadDocuments(changes.added);
+  for (size_t i = 0; i < addedDocuments.size(); i++) {
+    auto &doc = addedDocuments.at(i);
+    if (!doc.hasValue()) {
+      LOG(INFO) << format("missing document '{}' from centroid '{}'",
+                          changes.added.at(i), centroidId_);
+      continue;
+    }
+    accumulator->addDocument(doc.value().get());
+  }
+  result.assign(saveAccumulated(accumulator.get(), startTimestamp));
+  return result;
+}
+
+vector<Optional<shared_ptr<ProcessedDocument>>> CentroidUpdater::loadDocuments(
+    const vector<string> &documentIds) {
+  // each batch is a single MultiGet on the persistence pool,
+  // so a few large batches beat many small point lookups.
+  const size_t documentBatchSize = 250;
+  vector<Future<vector<Try<shared_ptr<ProcessedDocument>>>>> batchFutures;
+  for (size_t docNum = 0; docNum < documentIds.size();
+       docNum += documentBatchSize) {
+    size_t batchEnd = min(documentIds.size(), docNum + documentBatchSize);
+    vector<string> batchIds(
+      documentIds.begin() + docNum, documentIds.begin() + batchEnd
+    );
+    batchFutures.push_back(persistence_->loadDocuments(std::move(batchIds)));
+  }
+  vector<Optional<shared_ptr<ProcessedDocument>>> documents;
+  documents.reserve(documentIds.size());
+  for (auto &batch : collect(batchFutures).get()) {
+    for (auto &doc : batch) {
+      Optional<shared_ptr<ProcessedDocument>> result;
+      if (doc.hasValue()) {
+        result.assign(std::move(doc.value()));
+      }
+      documents.push_back(std::move(result));
+    }
+  }
+  return documents;
+}
+
+void CentroidUpdater::accumulateDocuments(
+    DocumentAccumulatorIf *accumulator, const vector<string> &documentIds) {
+  auto documents = loadDocuments(documentIds);
+  for (size_t i = 0; i < documents.size(); i++) {
+    auto &doc = documents.at(i);
+    if (!doc.hasValue()) {
+      auto &docId = documentIds.at(i);
+      LOG(INFO) << format("missing document '{}' from centroid '{}'", docId,
+                          centroidId_);
+      persistence_->removeDocumentFromCentroid(centroidId_, docId);
+      continue;
+    }
+    accumulator->addDocument(doc.value().get());
+  }
+}
 
+Try<bool> CentroidUpdater::runFullRebuild(uint64_t startTimestamp) {
+  const size_t idListBatchSize = 500;
 
   auto firstIdSet = persistence_->listCentroidDocumentRangeFromOffsetOption(
                                       centroidId_, 0, idListBatchSize).get();
@@ -70,63 +180,93 @@ Try<bool> CentroidUpdater::run() {
         centroidId_);
     return Try<bool>(make_exception_wrapper<ECentroidDoesNotExist>());
   }
-  auto accumulator = accumulatorFactory_->get();
   vector<string> idSet = std::move(firstIdSet.value());
 
-  if (idSet.size() > 0) {
-    do {
-      // start the next set of IDs loading here so they'll be done
-      // at the end of the current loop.
-      auto nextIdSetFuture =
-          persistence_->listCentroidDocumentRangeFromDocumentIdOption(
-              centroidId_, idSet.back(), idListBatchSize);
-
-      for (size_t docNum = 0; docNum < idSet.size();
-           docNum += documentBatchSize) {
-        size_t lastDocIndex = min(idSet.size() - 1, docNum + documentBatchSize);
-        vector<Future<Optional<shared_ptr<ProcessedDocument>>>> documentFutures;
-
-        // get batch of documents in parallel
-        for (size_t i = docNum; i <= lastDocIndex; i++) {
-          documentFutures.push_back(
-            util::optionOfTry<shared_ptr<ProcessedDocument>>(
-              persistence_->loadDocument(idSet.at(i))
-            )
-          );
-        }
-
-        auto loadedDocuments = collect(documentFutures).get();
-
-        // add non-falsy documents to the centroid
-        for (size_t i = 0; i < loadedDocuments.size(); i++) {
-          auto doc = loadedDocuments.at(i);
-          if (!doc.hasValue()) {
-            auto docId = idSet.at(i);
-            LOG(INFO) << format("missing document '{}' from centroid '{}'", docId,
-                                centroidId_);
-            persistence_->removeDocumentFromCentroid(centroidId_, docId);
-            continue;
-          }
-          accumulator->addDocument(doc.value().get());
-        }
-      }
+  // a centroid that fits in a single listing isn't worth
+  // handing off to other threads.
+  if (idSet.size() < idListBatchSize) {
+    auto accumulator = accumulatorFactory_->get();
+    accumulateDocuments(accumulator.get(), idSet);
+    return saveAccumulated(accumulator.get(), startTimestamp);
+  }
+
+  size_t shardCount = max((size_t) 1, accumulationPool_->numThreads());
+  vector<UniquePointer<DocumentAccumulatorIf>> accumulators;
+  vector<Future<bool>> shardTasks;
+  for (size_t i = 0; i < shardCount; i++) {
+    accumulators.push_back(accumulatorFactory_->get());
+    shardTasks.push_back(makeFuture(true));
+  }
+
+  // each shard's accumulator is only ever touched by one
+  // page at a time, which also bounds how far listing can
+  // run ahead of accumulation.
+  size_t pageNum = 0;
+  auto dispatchPage = [&](vector<string> &&ids) {
+    size_t shard = pageNum++ % shardCount;
+    shardTasks[shard].wait();
+    auto accumulator = accumulators[shard].get();
+    auto page = make_shared<vector<string>>(std::move(ids));
+    shardTasks[shard] = accumulationPool_->addFuture([this, accumulator, page]() {
+      accumulateDocuments(accumulator, *page);
+      return true;
+    });
+  };
 
-      auto nextIdSet = nextIdSetFuture.get();
-      if (!nextIdSet.hasValue()) {
-        LOG(INFO) << format(
-            "received falsy document list for centroid '{}'; it must have been "
-            "deleted. aborting.",
-            centroidId_);
-        return Try<bool>(make_exception_wrapper<ECentroidDoesNotExist>());
+  bool centroidDeleted = false;
+  size_t listedCount = idSet.size();
+  for (;;) {
+    if (listedCount < idListBatchSize) {
+      if (!idSet.empty()) {
+        dispatchPage(std::move(idSet));
       }
-      idSet = std::move(nextIdSet.value());
+      break;
+    }
+
+    // start the next set of IDs loading here so they'll be done
+    // by the time this page has been handed off.
+    string lastId = idSet.back();
+    auto nextIdSetFuture =
+        persistence_->listCentroidDocumentRangeFromDocumentIdOption(
+            centroidId_, lastId, idListBatchSize);
+    dispatchPage(std::move(idSet));
+
+    auto nextIdSet = nextIdSetFuture.get();
+    if (!nextIdSet.hasValue()) {
+      centroidDeleted = true;
+      break;
+    }
+    idSet = std::move(nextIdSet.value());
+    listedCount = idSet.size();
+
+    // listing from a document id includes that document.
+    if (!idSet.empty() && idSet.front() == lastId) {
+      idSet.erase(idSet.begin());
+    }
+  }
 
-    } while (idSet.size() >= idListBatchSize);
+  for (auto &task : shardTasks) {
+    task.wait();
+  }
+  if (centroidDeleted) {
+    LOG(INFO) << format(
+        "received falsy document list for centroid '{}'; it must have been "
+        "deleted. aborting.",
+        centroidId_);
+    return Try<bool>(make_exception_wrapper<ECentroidDoesNotExist>());
+  }
+  for (size_t i = 1; i < accumulators.size(); i++) {
+    accumulators[0]->merge(accumulators[i].get());
   }
+  return saveAccumulated(accumulators[0].get(), startTimestamp);
+}
+
+Try<bool> CentroidUpdater::saveAccumulated(
+    DocumentAccumulatorIf *accumulator, uint64_t startTimestamp) {
   auto centroid = make_shared<Centroid>(centroidId_);
   centroid->wordVector.magnitude = accumulator->getMagnitude();
   centroid->wordVector.documentWeight = accumulator->getCount();
-  centroid->wordVector.scores = std::move(accumulator->getScores());
+  centroid->wordVector.scores = SparseVector(accumulator->getScores());
   if (!persistence_->doesCentroidExist(centroidId_).get()) {
     LOG(INFO) << "Centroid missing after update; must have been deleted.";
     return Try<bool>(make_exception_wrapper<ECentroidDoesNotExist>());
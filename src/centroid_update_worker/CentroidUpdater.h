@@ -3,7 +3,11 @@
 #include <memory>
 #include <string>
 #include <folly/futures/Try.h>
+#include <folly/Optional.h>
+#include <wangle/concurrent/CPUThreadPoolExecutor.h>
+#include <wangle/concurrent/FutureExecutor.h>
 #include "centroid_update_worker/DocumentAccumulatorFactory.h"
+#include "persistence/CentroidDocumentChanges.h"
 #include "declarations.h"
 
 namespace relevanced {
@@ -15,19 +19,61 @@ class CentroidUpdaterIf {
   virtual ~CentroidUpdaterIf() = default;
 };
 
+/**
+ * `CentroidUpdater` brings a single centroid up to date with its
+ * current set of documents.
+ *
+ * When persistence can tell it exactly which documents were added
+ * and removed since the last update, it loads only those and applies
+ * them as deltas to the persisted centroid, whose scores are the raw
+ * sums of its documents' scores.  Otherwise (or if a removed document
+ * has since disappeared) it falls back to re-accumulating every
+ * document in the centroid.
+ *
+ * A full rebuild of a large centroid is spread over the
+ * accumulation pool: pages of the centroid's document ids are
+ * dealt out to one private accumulator per pool thread, and the
+ * shards are merged once every page has been accumulated.
+ */
 class CentroidUpdater : public CentroidUpdaterIf {
  protected:
   std::shared_ptr<persistence::PersistenceIf> persistence_;
   std::shared_ptr<persistence::CentroidMetadataDbIf> centroidMetadataDb_;
   std::shared_ptr<util::ClockIf> clock_;
   std::shared_ptr<DocumentAccumulatorFactoryIf> accumulatorFactory_;
+  std::shared_ptr<wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>>
+      accumulationPool_;
   std::string centroidId_;
 
+  folly::Try<bool> runFullRebuild(uint64_t startTimestamp);
+
+  // empty if the changes can't be applied incrementally.
+  folly::Optional<folly::Try<bool>> runIncremental(
+    const persistence::CentroidDocumentChanges &changes,
+    uint64_t startTimestamp
+  );
+
+  std::vector<folly::Optional<std::shared_ptr<models::ProcessedDocument>>>
+    loadDocuments(const std::vector<std::string> &documentIds);
+
+  // adds every document that still exists, and drops the
+  // ones that don't from the centroid.
+  void accumulateDocuments(
+    DocumentAccumulatorIf *accumulator,
+    const std::vector<std::string> &documentIds
+  );
+
+  folly::Try<bool> saveAccumulated(
+    DocumentAccumulatorIf *accumulator,
+    uint64_t startTimestamp
+  );
+
  public:
   CentroidUpdater(std::shared_ptr<persistence::PersistenceIf>,
                   std::shared_ptr<persistence::CentroidMetadataDbIf>,
                   std::shared_ptr<util::ClockIf>,
                   std::shared_ptr<DocumentAccumulatorFactoryIf>,
+                  std::shared_ptr<wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>>,
                   std::string centroidId);
   folly::Try<bool> run() override;
 };
@@ -6,6 +6,8 @@
 #include "util/Clock.h"
 
 using namespace std;
+using wangle::CPUThreadPoolExecutor;
+using wangle::FutureExecutor;
 
 namespace relevanced {
 namespace centroid_update_worker {
@@ -14,16 +16,19 @@ CentroidUpdaterFactory::CentroidUpdaterFactory(
     shared_ptr<persistence::PersistenceIf> persistence,
     shared_ptr<persistence::CentroidMetadataDbIf> metadata,
     shared_ptr<DocumentAccumulatorFactoryIf> accumulatorFactory,
-    shared_ptr<util::ClockIf> clock)
+    shared_ptr<util::ClockIf> clock,
+    shared_ptr<FutureExecutor<CPUThreadPoolExecutor>> accumulationPool)
     : persistence_(persistence),
       centroidMetadataDb_(metadata),
       accumulatorFactory_(accumulatorFactory),
-      clock_(clock) {}
+      clock_(clock),
+      accumulationPool_(accumulationPool) {}
 
 shared_ptr<CentroidUpdaterIf> CentroidUpdaterFactory::makeForCentroidId(
     const string &centroidId) {
   return shared_ptr<CentroidUpdaterIf>(new CentroidUpdater(
-    persistence_, centroidMetadataDb_, clock_, accumulatorFactory_, centroidId
+    persistence_, centroidMetadataDb_, clock_, accumulatorFactory_,
+    accumulationPool_, centroidId
   ));
 }
 
@@ -2,6 +2,8 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <wangle/concurrent/CPUThreadPoolExecutor.h>
+#include <wangle/concurrent/FutureExecutor.h>
 #include "centroid_update_worker/DocumentAccumulatorFactory.h"
 #include "declarations.h"
 
@@ -22,12 +24,15 @@ class CentroidUpdaterFactory : public CentroidUpdaterFactoryIf {
   std::shared_ptr<persistence::CentroidMetadataDbIf> centroidMetadataDb_;
   std::shared_ptr<DocumentAccumulatorFactoryIf> accumulatorFactory_;
   std::shared_ptr<util::ClockIf> clock_;
+  std::shared_ptr<wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>>
+      accumulationPool_;
 
  public:
   CentroidUpdaterFactory(std::shared_ptr<persistence::PersistenceIf>,
                          std::shared_ptr<persistence::CentroidMetadataDbIf>,
                          std::shared_ptr<DocumentAccumulatorFactoryIf>,
-                         std::shared_ptr<util::ClockIf>);
+                         std::shared_ptr<util::ClockIf>,
+                         std::shared_ptr<wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>>);
 
   std::shared_ptr<CentroidUpdaterIf>
     makeForCentroidId(const std::string&) override;
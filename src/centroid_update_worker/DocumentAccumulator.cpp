@@ -3,6 +3,7 @@
 #include <vector>
 #include <cmath>
 #include "models/ProcessedDocument.h"
+#include "models/WordVector.h"
 #include "centroid_update_worker/DocumentAccumulator.h"
 
 using namespace std;
@@ -10,21 +11,73 @@ using namespace std;
 namespace relevanced {
 namespace centroid_update_worker {
 using models::ProcessedDocument;
+using models::WordVector;
+
+// sums left over after every contributing document has been
+// subtracted back out are rounding noise, not real weights.
+static const double kRemovedScoreEpsilon = 1e-9;
+
+void DocumentAccumulator::initialize(const WordVector &existing) {
+  staleMagnitude_ = true;
+  documentCount_ = (size_t) existing.documentWeight;
+  scores_.clear();
+  scores_.reserve(existing.scores.size());
+  for (size_t i = 0; i < existing.scores.size(); i++) {
+    scores_.insert(make_pair(
+      existing.scores.ids[i], existing.scores.weights[i]
+    ));
+  }
+}
 
 void DocumentAccumulator::addDocument(ProcessedDocument* document) {
   staleMagnitude_ = true;
   documentCount_++;
   for (auto &elem : document->scoredWords) {
-    string key = elem.word;
-    if (scores_.find(key) == scores_.end()) {
-      scores_[key] = elem.score;
+    auto existing = scores_.find(elem.termId);
+    if (existing == scores_.end()) {
+      scores_.insert(make_pair(elem.termId, elem.score));
+    } else {
+      existing->second += elem.score;
+    }
+  }
+}
+
+void DocumentAccumulator::removeDocument(ProcessedDocument* document) {
+  staleMagnitude_ = true;
+  if (documentCount_ > 0) {
+    documentCount_--;
+  }
+  for (auto &elem : document->scoredWords) {
+    auto existing = scores_.find(elem.termId);
+    if (existing == scores_.end()) {
+      continue;
+    }
+    existing->second -= elem.score;
+    if (documentCount_ == 0 || fabs(existing->second) < kRemovedScoreEpsilon) {
+      scores_.erase(existing);
+    }
+  }
+}
+
+void DocumentAccumulator::merge(DocumentAccumulatorIf *other) {
+  staleMagnitude_ = true;
+  documentCount_ += other->getCount();
+  auto otherScores = std::move(other->getScores());
+  if (scores_.empty()) {
+    scores_ = std::move(otherScores);
+    return;
+  }
+  for (auto &elem : otherScores) {
+    auto existing = scores_.find(elem.first);
+    if (existing == scores_.end()) {
+      scores_.insert(elem);
     } else {
-      scores_[key] += elem.score;
+      existing->second += elem.second;
     }
   }
 }
 
-std::unordered_map<std::string, double>&& DocumentAccumulator::getScores() {
+std::unordered_map<uint32_t, double>&& DocumentAccumulator::getScores() {
   return std::move(scores_);
 }
 
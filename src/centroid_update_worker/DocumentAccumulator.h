@@ -4,13 +4,22 @@
 #include <vector>
 #include <cmath>
 #include "models/ProcessedDocument.h"
+#include "models/WordVector.h"
 namespace relevanced {
 namespace centroid_update_worker {
 
 class DocumentAccumulatorIf {
 public:
+  // resumes from a previously persisted centroid vector, whose
+  // scores are the raw sums of its documents' scores.
+  virtual void initialize(const models::WordVector &existing) = 0;
   virtual void addDocument(models::ProcessedDocument* document) = 0;
-  virtual std::unordered_map<std::string, double>&& getScores() = 0;
+  virtual void removeDocument(models::ProcessedDocument* document) = 0;
+
+  // folds another accumulator's documents into this one,
+  // consuming its scores.
+  virtual void merge(DocumentAccumulatorIf *other) = 0;
+  virtual std::unordered_map<uint32_t, double>&& getScores() = 0;
   virtual double getMagnitude() = 0;
   virtual size_t getCount() = 0;
   virtual ~DocumentAccumulatorIf() = default;
@@ -18,12 +27,15 @@ public:
 
 class DocumentAccumulator: public DocumentAccumulatorIf {
   size_t documentCount_ {0};
-  std::unordered_map<std::string, double> scores_;
+  std::unordered_map<uint32_t, double> scores_;
   double magnitude_ {0};
   bool staleMagnitude_ {true};
 public:
+  void initialize(const models::WordVector &existing) override;
   void addDocument(models::ProcessedDocument* document) override;
-  std::unordered_map<std::string, double>&& getScores() override;
+  void removeDocument(models::ProcessedDocument* document) override;
+  void merge(DocumentAccumulatorIf *other) override;
+  std::unordered_map<uint32_t, double>&& getScores() override;
   double getMagnitude() override;
   size_t getCount() override;
 };
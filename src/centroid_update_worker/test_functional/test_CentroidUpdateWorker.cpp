@@ -53,10 +53,12 @@ struct UpdateWorkerTestCtx {
   shared_ptr<ClockIf> sysClock;
   shared_ptr<FutureExecutor<CPUThreadPoolExecutor>> threadPool1;
   shared_ptr<FutureExecutor<CPUThreadPoolExecutor>> threadPool2;
+  shared_ptr<FutureExecutor<CPUThreadPoolExecutor>> threadPool3;
   shared_ptr<CentroidUpdateWorker> updateWorker;
   UpdateWorkerTestCtx() {
     threadPool1.reset(new wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>(2));
     threadPool2.reset(new wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>(2));
+    threadPool3.reset(new wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>(2));
     sysClock.reset(new Clock);
     UniquePointer<RockHandleIf> rockHandle(new InMemoryRockHandle("foo"));
     UniquePointer<SyncPersistenceIf> syncPersistence(
@@ -69,7 +71,7 @@ struct UpdateWorkerTestCtx {
     metadb.reset(new CentroidMetadataDb(persistence));
     accumulatorFactory.reset(new DocumentAccumulatorFactory);
     updaterFactory.reset(new CentroidUpdaterFactory(
-      persistence, metadb, accumulatorFactory, sysClock
+      persistence, metadb, accumulatorFactory, sysClock, threadPool3
     ));
     updateWorker.reset(new CentroidUpdateWorker(updaterFactory, threadPool2));
   }
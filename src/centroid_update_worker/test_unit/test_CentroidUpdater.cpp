@@ -9,6 +9,7 @@
 #include <memory>
 
 #include <folly/ExceptionWrapper.h>
+#include <folly/Format.h>
 #include <folly/futures/Try.h>
 #include <wangle/concurrent/CPUThreadPoolExecutor.h>
 #include <wangle/concurrent/FutureExecutor.h>
@@ -23,8 +24,10 @@
 #include "document_processing_worker/DocumentProcessingWorker.h"
 #include "models/ProcessedDocument.h"
 #include "models/Centroid.h"
+#include "models/WordVector.h"
 
 #include "text_util/ScoredWord.h"
+#include "text_util/TermDictionary.h"
 #include "util/Clock.h"
 
 #include "testing/MockClock.h"
@@ -113,6 +116,14 @@ class StubSyncPersistence : public persistence::SyncPersistenceIf {
     );
     return Try<shared_ptr<ProcessedDocument>>(result);
   }
+  vector<Try<shared_ptr<ProcessedDocument>>> loadDocuments(
+      const vector<string>& ids) {
+    vector<Try<shared_ptr<ProcessedDocument>>> result;
+    for (auto &id: ids) {
+      result.push_back(loadDocument(id));
+    }
+    return result;
+  }
   MOCK_METHOD1(doesCentroidExist, bool(const string&));
   MOCK_METHOD1(createNewCentroid, Try<bool>(const string&));
   MOCK_METHOD1(deleteCentroid, Try<bool>(const string&));
@@ -143,6 +154,18 @@ class StubSyncPersistence : public persistence::SyncPersistenceIf {
   MOCK_METHOD3(setCentroidMetadata,
                Try<bool>(const string&, const string&, string));
   MOCK_METHOD0(debugEraseAllData, void());
+
+  persistence::CentroidDocumentChanges changes;
+  vector<bool> finishedUpdates;
+  persistence::CentroidDocumentChanges takeCentroidDocumentChanges(const string&) {
+    auto result = changes;
+    changes = persistence::CentroidDocumentChanges();
+    return result;
+  }
+  void finishCentroidUpdate(const string&, bool succeeded) {
+    finishedUpdates.push_back(succeeded);
+  }
+  void invalidateCentroidDocumentChanges(const string&) {}
 };
 
 class MockAccumulatorFactory: public DocumentAccumulatorFactoryIf {
@@ -158,14 +181,23 @@ public:
 
 class SpyAccumulator: public DocumentAccumulatorIf {
 public:
-  unordered_map<string, double> scores;
+  unordered_map<uint32_t, double> scores;
   set<string> seenDocumentIds;
+  set<string> removedDocumentIds;
   double magnitude {0.0};
   size_t count = 0;
+  size_t initializedCount = 0;
+  void initialize(const WordVector &existing) override {
+    initializedCount = existing.documentWeight;
+  }
   void addDocument(ProcessedDocument *doc) override {
     seenDocumentIds.insert(doc->id);
   }
-  std::unordered_map<string, double>&& getScores() override {
+  void removeDocument(ProcessedDocument *doc) override {
+    removedDocumentIds.insert(doc->id);
+  }
+  void merge(DocumentAccumulatorIf*) override {}
+  std::unordered_map<uint32_t, double>&& getScores() override {
     return std::move(scores);
   }
   size_t getCount() override {
@@ -176,7 +208,7 @@ public:
   }
 };
 
-CentroidUpdater makeUpdater(StubSyncPersistence &stubPersistence, MockCentroidMetadataDb &mockMeta, MockClock &mockClock, MockAccumulatorFactory &fact, const string &centroidId) {
+CentroidUpdater makeUpdater(StubSyncPersistence &stubPersistence, MockCentroidMetadataDb &mockMeta, MockClock &mockClock, DocumentAccumulatorFactoryIf &fact, const string &centroidId) {
   UniquePointer<SyncPersistenceIf> syncPtr(
     &stubPersistence, NonDeleter<SyncPersistenceIf>()
   );
@@ -189,7 +221,11 @@ CentroidUpdater makeUpdater(StubSyncPersistence &stubPersistence, MockCentroidMe
   shared_ptr<DocumentAccumulatorFactoryIf> accumulatorFactory(
     &fact, NonDeleter<DocumentAccumulatorFactoryIf>()
   );
-  return CentroidUpdater(persistence, metaDbPtr, clockPtr, accumulatorFactory, centroidId);
+  auto accumulationPool = std::make_shared<FutureExecutor<CPUThreadPoolExecutor>>(3);
+  return CentroidUpdater(
+    persistence, metaDbPtr, clockPtr, accumulatorFactory,
+    accumulationPool, centroidId
+  );
 }
 
 TEST(CentroidUpdater, Simple) {
@@ -258,9 +294,10 @@ TEST(CentroidUpdater, AccumulatorDetails) {
   EXPECT_CALL(mclock, getEpochTime())
     .WillOnce(Return(5555));
 
-  unordered_map<string, double> scores {
-    {"foo", 4.3},
-    {"bar", 1.2}
+  auto dictionary = TermDictionary::getDefault();
+  unordered_map<uint32_t, double> scores {
+    {dictionary->getId(string("foo")), 4.3},
+    {dictionary->getId(string("bar")), 1.2}
   };
   accumulator.scores = scores;
   accumulator.magnitude = 17.5;
@@ -334,4 +371,133 @@ TEST(CentroidUpdater, MissingDocument) {
   auto updateTime = mockMeta.getLastCalculatedTimestamp("some-centroid").get();
   EXPECT_TRUE(updateTime.hasValue());
   EXPECT_EQ(5555, updateTime.value());
-}
\ No newline at end of file
+}
+
+TEST(CentroidUpdater, IncrementalChanges) {
+  StubSyncPersistence stubPersistence;
+  map<string, ProcessedDocument> documents;
+  vector<string> docIds {"doc1", "doc2", "doc3"};
+  for (auto &id: docIds) {
+    vector<ScoredWord> words {
+      ScoredWord("cat", 3, 0.4),
+      ScoredWord("dog", 3, 0.2)
+    };
+    documents.insert(make_pair(id, ProcessedDocument(id, words, 5.0)));
+  }
+  for (auto &docIdPair: documents) {
+    stubPersistence.documents.insert(
+      make_pair(docIdPair.first, &docIdPair.second)
+    );
+    stubPersistence.centroidIds.push_back(docIdPair.first);
+  }
+  stubPersistence.existingCentroids.insert("some-centroid");
+  stubPersistence.changes.needsFullRebuild = false;
+  stubPersistence.changes.added.push_back("doc3");
+  stubPersistence.changes.removed.push_back("doc1");
+
+  MockClock mclock;
+  MockCentroidMetadataDb mockMeta;
+  SpyAccumulator accumulator;
+  MockAccumulatorFactory factory;
+  factory.set(&accumulator);
+  EXPECT_CALL(stubPersistence, doesCentroidExist("some-centroid"))
+    .WillRepeatedly(Return(true));
+  EXPECT_CALL(mclock, getEpochTime())
+    .WillOnce(Return(5555));
+  auto existing = make_shared<Centroid>("some-centroid");
+  existing->wordVector.documentWeight = 2;
+  Try<shared_ptr<Centroid>> loaded(existing);
+  EXPECT_CALL(stubPersistence, loadCentroid("some-centroid"))
+    .WillOnce(Return(loaded));
+
+  CentroidUpdater updater = makeUpdater(stubPersistence, mockMeta, mclock, factory, "some-centroid");
+  auto result = updater.run();
+  EXPECT_FALSE(result.hasException());
+  EXPECT_EQ(2, accumulator.initializedCount);
+  set<string> expectedAdded {"doc3"};
+  set<string> expectedRemoved {"doc1"};
+  EXPECT_EQ(expectedAdded, accumulator.seenDocumentIds);
+  EXPECT_EQ(expectedRemoved, accumulator.removedDocumentIds);
+  EXPECT_EQ("some-centroid", stubPersistence.savedCentroid->id);
+  vector<bool> expectedFinished {true};
+  EXPECT_EQ(expectedFinished, stubPersistence.finishedUpdates);
+}
+
+TEST(CentroidUpdater, IncrementalFallsBackWhenRemovedDocumentIsGone) {
+  StubSyncPersistence stubPersistence;
+  map<string, ProcessedDocument> documents;
+  vector<string> docIds {"doc1", "doc2"};
+  for (auto &id: docIds) {
+    vector<ScoredWord> words {
+      ScoredWord("cat", 3, 0.4)
+    };
+    documents.insert(make_pair(id, ProcessedDocument(id, words, 5.0)));
+  }
+  for (auto &docIdPair: documents) {
+    stubPersistence.documents.insert(
+      make_pair(docIdPair.first, &docIdPair.second)
+    );
+    stubPersistence.centroidIds.push_back(docIdPair.first);
+  }
+  stubPersistence.existingCentroids.insert("some-centroid");
+  stubPersistence.changes.needsFullRebuild = false;
+  stubPersistence.changes.removed.push_back("deleted-doc");
+
+  MockClock mclock;
+  MockCentroidMetadataDb mockMeta;
+  SpyAccumulator accumulator;
+  MockAccumulatorFactory factory;
+  factory.set(&accumulator);
+  EXPECT_CALL(stubPersistence, doesCentroidExist("some-centroid"))
+    .WillRepeatedly(Return(true));
+  EXPECT_CALL(mclock, getEpochTime())
+    .WillOnce(Return(5555));
+  Try<shared_ptr<Centroid>> loaded(make_shared<Centroid>("some-centroid"));
+  EXPECT_CALL(stubPersistence, loadCentroid("some-centroid"))
+    .WillOnce(Return(loaded));
+
+  CentroidUpdater updater = makeUpdater(stubPersistence, mockMeta, mclock, factory, "some-centroid");
+  auto result = updater.run();
+  EXPECT_FALSE(result.hasException());
+  set<string> expectedDocs {"doc1", "doc2"};
+  EXPECT_EQ(expectedDocs, accumulator.seenDocumentIds);
+  EXPECT_TRUE(accumulator.removedDocumentIds.empty());
+  vector<bool> expectedFinished {false, true};
+  EXPECT_EQ(expectedFinished, stubPersistence.finishedUpdates);
+}
+
+TEST(CentroidUpdater, ShardedAccumulation) {
+  StubSyncPersistence stubPersistence;
+  map<string, ProcessedDocument> documents;
+  for (size_t i = 0; i < 1234; i++) {
+    auto id = folly::sformat("doc{:04d}", i);
+    vector<ScoredWord> words {
+      ScoredWord("cat", 3, 0.5),
+      ScoredWord("dog", 3, 0.25)
+    };
+    documents.insert(make_pair(id, ProcessedDocument(id, words, 5.0)));
+  }
+  for (auto &docIdPair: documents) {
+    stubPersistence.documents.insert(
+      make_pair(docIdPair.first, &docIdPair.second)
+    );
+    stubPersistence.centroidIds.push_back(docIdPair.first);
+  }
+  stubPersistence.existingCentroids.insert("some-centroid");
+  MockClock mclock;
+  MockCentroidMetadataDb mockMeta;
+  DocumentAccumulatorFactory factory;
+  EXPECT_CALL(stubPersistence, doesCentroidExist("some-centroid"))
+    .WillRepeatedly(Return(true));
+  EXPECT_CALL(mclock, getEpochTime())
+    .WillOnce(Return(5555));
+
+  CentroidUpdater updater = makeUpdater(stubPersistence, mockMeta, mclock, factory, "some-centroid");
+  auto result = updater.run();
+  EXPECT_FALSE(result.hasException());
+  auto saved = stubPersistence.savedCentroid;
+  EXPECT_EQ(1234, saved->wordVector.documentWeight);
+  auto dictionary = TermDictionary::getDefault();
+  EXPECT_DOUBLE_EQ(617.0, saved->wordVector.scores.get(dictionary->getId(string("cat"))));
+  EXPECT_DOUBLE_EQ(308.5, saved->wordVector.scores.get(dictionary->getId(string("dog"))));
+}
@@ -1,7 +1,10 @@
 #include "gtest/gtest.h"
+#include <cmath>
 #include "centroid_update_worker/DocumentAccumulator.h"
 #include "models/ProcessedDocument.h"
+#include "models/WordVector.h"
 #include "text_util/ScoredWord.h"
+#include "text_util/TermDictionary.h"
 
 using namespace std;
 using namespace relevanced;
@@ -28,9 +31,87 @@ TEST(TestDocumentAccumulator, Simple) {
   auto scores = accumulator.getScores();
   set<string> expectedWords {"foo", "bar", "cat"};
   set<string> presentWords;
+  auto dictionary = TermDictionary::getDefault();
   for (auto &scorePair : scores) {
-    presentWords.insert(scorePair.first);
+    presentWords.insert(dictionary->getTerm(scorePair.first));
   }
   EXPECT_EQ(expectedWords, presentWords);
-  EXPECT_TRUE(scores["bar"] > scores["cat"]);
+  auto barId = dictionary->getId(string("bar"));
+  auto catId = dictionary->getId(string("cat"));
+  EXPECT_TRUE(scores[barId] > scores[catId]);
+}
+
+TEST(TestDocumentAccumulator, RemoveDocument) {
+  DocumentAccumulator accumulator;
+  ProcessedDocument doc1("doc-1",
+    vector<ScoredWord>{ ScoredWord("foo", 3, 0.5), ScoredWord("bar", 3, 0.5) },
+    1.0
+  );
+  ProcessedDocument doc2("doc-2",
+    vector<ScoredWord>{ ScoredWord("cat", 3, 0.5), ScoredWord("bar", 3, 0.3) },
+    1.0
+  );
+  accumulator.addDocument(&doc1);
+  accumulator.addDocument(&doc2);
+  accumulator.removeDocument(&doc1);
+  EXPECT_EQ(1, accumulator.getCount());
+  EXPECT_FLOAT_EQ(sqrt(0.5 * 0.5 + 0.3 * 0.3), accumulator.getMagnitude());
+  auto scores = accumulator.getScores();
+  auto dictionary = TermDictionary::getDefault();
+  EXPECT_EQ(2, scores.size());
+  EXPECT_EQ(0, scores.count(dictionary->getId(string("foo"))));
+  EXPECT_FLOAT_EQ(0.3, scores[dictionary->getId(string("bar"))]);
+  EXPECT_DOUBLE_EQ(0.5, scores[dictionary->getId(string("cat"))]);
+}
+
+TEST(TestDocumentAccumulator, InitializeFromExisting) {
+  DocumentAccumulator fromScratch;
+  ProcessedDocument doc1("doc-1",
+    vector<ScoredWord>{ ScoredWord("foo", 3, 0.5), ScoredWord("bar", 3, 0.5) },
+    1.0
+  );
+  ProcessedDocument doc2("doc-2",
+    vector<ScoredWord>{ ScoredWord("cat", 3, 0.5), ScoredWord("bar", 3, 0.3) },
+    1.0
+  );
+  fromScratch.addDocument(&doc1);
+  auto magnitude = fromScratch.getMagnitude();
+  auto count = fromScratch.getCount();
+  WordVector existing(fromScratch.getScores(), magnitude, count);
+
+  DocumentAccumulator resumed;
+  resumed.initialize(existing);
+  EXPECT_EQ(1, resumed.getCount());
+  EXPECT_DOUBLE_EQ(magnitude, resumed.getMagnitude());
+  resumed.addDocument(&doc2);
+  EXPECT_EQ(2, resumed.getCount());
+  auto scores = resumed.getScores();
+  auto dictionary = TermDictionary::getDefault();
+  EXPECT_FLOAT_EQ(0.8, scores[dictionary->getId(string("bar"))]);
+  EXPECT_DOUBLE_EQ(0.5, scores[dictionary->getId(string("cat"))]);
+  EXPECT_DOUBLE_EQ(0.5, scores[dictionary->getId(string("foo"))]);
+}
+
+TEST(TestDocumentAccumulator, Merge) {
+  ProcessedDocument doc1("doc-1",
+    vector<ScoredWord>{ ScoredWord("foo", 3, 0.5), ScoredWord("bar", 3, 0.5) },
+    1.0
+  );
+  ProcessedDocument doc2("doc-2",
+    vector<ScoredWord>{ ScoredWord("cat", 3, 0.5), ScoredWord("bar", 3, 0.3) },
+    1.0
+  );
+  DocumentAccumulator shard1;
+  DocumentAccumulator shard2;
+  shard1.addDocument(&doc1);
+  shard2.addDocument(&doc2);
+  shard2.addDocument(&doc1);
+  shard1.merge(&shard2);
+  EXPECT_EQ(3, shard1.getCount());
+  auto scores = shard1.getScores();
+  auto dictionary = TermDictionary::getDefault();
+  EXPECT_EQ(3, scores.size());
+  EXPECT_FLOAT_EQ(1.3, scores[dictionary->getId(string("bar"))]);
+  EXPECT_DOUBLE_EQ(0.5, scores[dictionary->getId(string("cat"))]);
+  EXPECT_DOUBLE_EQ(1.0, scores[dictionary->getId(string("foo"))]);
 }
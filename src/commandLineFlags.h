@@ -5,6 +5,10 @@ DEFINE_bool(
     integration_test_mode,
     false,
     "Enable dangerous commands used for testing (e.g. erase everything)");
+DEFINE_bool(
+    background_centroid_loading,
+    false,
+    "Accept requests while centroids are still being loaded on startup");
 DEFINE_int32(port, 0, "Port for relevanced's Thrift server to listen on");
 DEFINE_string(data_dir,
               "",
@@ -16,9 +20,16 @@ DEFINE_int32(rocks_db_threads,
 DEFINE_int32(centroid_update_threads,
              0,
              "Number of threads in the centroid updating pool");
+DEFINE_int32(centroid_accumulation_threads,
+             0,
+             "Number of threads used to accumulate a single large centroid");
 DEFINE_int32(similarity_score_threads,
              0,
              "Number of threads in the similarity scoring pool");
 DEFINE_int32(document_processing_threads,
              0,
              "Number of threads in the document processing pool");
+DEFINE_int32(bigram_bits,
+             0,
+             "Count adjacent stems as bigram features hashed into "
+             "2^bigram_bits buckets (0 disables bigrams)");
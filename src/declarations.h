@@ -22,6 +22,7 @@ namespace document_processing_worker {
 class DocumentProcessingWorkerIf;
 class DocumentProcessorIf;
 class DocumentProcessor;
+class DocumentUpload;
 } // document_processing_worker
 
 namespace stemmer {
@@ -31,6 +32,15 @@ class ThreadSafeStemmerManager;
 class PorterStemmer;
 } // stemmmer
 
+namespace text_util {
+class WordAccumulator;
+} // text_util
+
+namespace language_detection {
+class LanguageDetectorIf;
+class LanguageDetector;
+} // language_detection
+
 namespace stopwords {
 class StopwordFilterIf;
 class StopwordFilter;
@@ -1,10 +1,16 @@
 #include <memory>
+#include <mutex>
+#include <string>
+#include <folly/ExceptionWrapper.h>
 #include <folly/futures/Future.h>
+#include <folly/futures/Try.h>
 #include <wangle/concurrent/CPUThreadPoolExecutor.h>
 #include <wangle/concurrent/FutureExecutor.h>
 
 #include "document_processing_worker/DocumentProcessingWorker.h"
 #include "document_processing_worker/DocumentProcessor.h"
+#include "document_processing_worker/DocumentUpload.h"
+#include "gen-cpp2/RelevancedProtocol_types.h"
 #include "models/WordVector.h"
 #include "models/ProcessedDocument.h"
 #include "models/Document.h"
@@ -21,6 +27,7 @@ using wangle::CPUThreadPoolExecutor;
 using models::Document;
 using models::WordVector;
 using models::ProcessedDocument;
+using thrift_protocol::EUploadDoesNotExist;
 
 
 DocumentProcessingWorker::DocumentProcessingWorker(
@@ -35,8 +42,10 @@ using FutureDoc = Future<shared_ptr<ProcessedDocument>>;
 FutureDoc DocumentProcessingWorker::processNew(
     shared_ptr<Document> doc) {
   return threadPool_->addFuture([this, doc]() {
+    // hashed first: processing lowercases `doc->text` in place.
+    auto hash = hasher_->hash(doc->text);
     auto result = processor_->processNew(doc);
-    result->sha1Hash.assign(hasher_->hash(doc->text));
+    result->sha1Hash.assign(hash);
     return result;
   });
 }
@@ -48,6 +57,42 @@ FutureDoc DocumentProcessingWorker::processNewWithoutHash(
   });
 }
 
+FutureDoc DocumentProcessingWorker::processForScoring(
+    shared_ptr<Document> doc) {
+  return threadPool_->addFuture([this, doc]() {
+    return processor_->processForScoring(doc);
+  });
+}
+
+Future<Try<bool>> DocumentProcessingWorker::appendToUpload(
+    shared_ptr<DocumentUpload> upload, shared_ptr<string> text) {
+  return threadPool_->addFuture([this, upload, text]() {
+    lock_guard<mutex> lock(upload->mutex);
+    if (upload->finished) {
+      // raced with its own commit; the document was built without
+      // this chunk.
+      return Try<bool>(make_exception_wrapper<EUploadDoesNotExist>());
+    }
+    upload->sha1.update(text->data(), text->size());
+    upload->bytesReceived += text->size();
+    processor_->appendToUpload(*upload, *text);
+    return Try<bool>(true);
+  });
+}
+
+FutureDoc DocumentProcessingWorker::finishUpload(
+    shared_ptr<DocumentUpload> upload) {
+  return threadPool_->addFuture([this, upload]() {
+    lock_guard<mutex> lock(upload->mutex);
+    auto result = processor_->finishUpload(*upload);
+    result->sha1Hash.assign(upload->sha1.finish());
+    return result;
+  });
+}
+
+stemmer::StemCacheStats DocumentProcessingWorker::getStemCacheStats() {
+  return processor_->getStemCacheStats();
+}
 
 } // document_processing_worker
 } // relevanced
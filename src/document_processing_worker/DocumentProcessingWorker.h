@@ -1,11 +1,14 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <folly/futures/Future.h>
+#include <folly/futures/Try.h>
 #include <wangle/concurrent/CPUThreadPoolExecutor.h>
 #include <wangle/concurrent/FutureExecutor.h>
 
 #include "declarations.h"
+#include "stemmer/StemmerIf.h"
 
 namespace relevanced {
 namespace document_processing_worker {
@@ -17,6 +20,25 @@ class DocumentProcessingWorkerIf {
 
   virtual folly::Future<std::shared_ptr<models::ProcessedDocument>>
     processNewWithoutHash(std::shared_ptr<models::Document>) = 0;
+
+  // for text that is only scored; see `DocumentProcessorIf`.
+  virtual folly::Future<std::shared_ptr<models::ProcessedDocument>>
+    processForScoring(std::shared_ptr<models::Document>) = 0;
+
+  // raises `EUploadDoesNotExist` if the upload was committed
+  // before the chunk got its turn.
+  virtual folly::Future<folly::Try<bool>>
+    appendToUpload(
+      std::shared_ptr<DocumentUpload>,
+      std::shared_ptr<std::string> text
+    ) = 0;
+
+  // the result has a `sha1Hash` of all of the upload's text.
+  virtual folly::Future<std::shared_ptr<models::ProcessedDocument>>
+    finishUpload(std::shared_ptr<DocumentUpload>) = 0;
+
+  // summed over every processing thread.
+  virtual stemmer::StemCacheStats getStemCacheStats() = 0;
 };
 
 
@@ -39,6 +61,20 @@ class DocumentProcessingWorker : public DocumentProcessingWorkerIf {
 
   folly::Future<std::shared_ptr<models::ProcessedDocument>>
     processNewWithoutHash(std::shared_ptr<models::Document>) override;
+
+  folly::Future<std::shared_ptr<models::ProcessedDocument>>
+    processForScoring(std::shared_ptr<models::Document>) override;
+
+  folly::Future<folly::Try<bool>>
+    appendToUpload(
+      std::shared_ptr<DocumentUpload>,
+      std::shared_ptr<std::string> text
+    ) override;
+
+  folly::Future<std::shared_ptr<models::ProcessedDocument>>
+    finishUpload(std::shared_ptr<DocumentUpload>) override;
+
+  stemmer::StemCacheStats getStemCacheStats() override;
 };
 
 } // document_processing_worker
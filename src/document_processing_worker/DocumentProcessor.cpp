@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <map>
@@ -6,17 +7,24 @@
 #include <tuple>
 #include <cmath>
 #include <glog/logging.h>
+#include <utf8.h>
 #include "DocumentProcessor.h"
+#include "DocumentUpload.h"
+#include "language_detection/LanguageDetector.h"
+#include "libunicode/code_point_support.h"
 #include "models/Document.h"
 #include "models/ProcessedDocument.h"
 #include "models/WordVector.h"
 #include "stopwords/StopwordFilter.h"
 #include "stemmer/StemmerManagerIf.h"
 #include "tokenizer/DestructiveTokenIterator.h"
+#include "tokenizer/Token.h"
 #include "util/Clock.h"
 #include "util/util.h"
 #include "text_util/ScoredWord.h"
 #include "text_util/StringView.h"
+#include "text_util/bigrams.h"
+#include "text_util/fnv.h"
 #include "text_util/WordAccumulator.h"
 
 
@@ -25,64 +33,125 @@ namespace document_processing_worker {
 
 using models::Document;
 using models::ProcessedDocument;
+using thrift_protocol::Language;
 using stemmer::StemmerManagerIf;
 using namespace std;
+using tokenizer::Token;
 using util::UniquePointer;
 using util::ClockIf;
 using stopwords::StopwordFilterIf;
+using language_detection::LanguageDetectorIf;
+using language_detection::LanguageDetector;
 using namespace relevanced::text_util;
 
+// token buffers that grew past this for an unusually large
+// document are released instead of being kept by the thread.
+static const size_t kMaxRetainedTokens = 1 << 18;
+
 DocumentProcessor::DocumentProcessor(
     shared_ptr<StemmerManagerIf> stemmerManager,
     shared_ptr<StopwordFilterIf> stopwordFilter,
     shared_ptr<ClockIf> clock
   ): stemmerManager_(stemmerManager),
      stopwordFilter_(stopwordFilter),
-     clock_(clock) {}
+     clock_(clock),
+     languageDetector_(std::make_shared<LanguageDetector>()) {}
 
-void DocumentProcessor::process_(
-    Document &doc, ProcessedDocument *result) {
-  tokenizer::DestructiveTokenIterator it(doc.text);
-  WordAccumulator accumulator {200};
-  const char *cStr = doc.text.c_str();
-  std::tuple<bool, size_t, size_t> tokenOffsets;
-  auto stemmer = stemmerManager_->getStemmer(doc.language);
-  while (it.next(tokenOffsets)) {
-    if (!std::get<0>(tokenOffsets)) {
-      break;
-    }
-    size_t startPos = ::std::get<1>(tokenOffsets);
-    size_t len = ::std::get<2>(tokenOffsets) - startPos;
-    const char *tokenStart = cStr + startPos;
-    len = stemmer->getStemPos(tokenStart, len);
-    if (len > 23) {
-      len = 23;
+DocumentProcessor::DocumentProcessor(
+    shared_ptr<StemmerManagerIf> stemmerManager,
+    shared_ptr<StopwordFilterIf> stopwordFilter,
+    shared_ptr<ClockIf> clock,
+    shared_ptr<LanguageDetectorIf> languageDetector
+  ): stemmerManager_(stemmerManager),
+     stopwordFilter_(stopwordFilter),
+     clock_(clock),
+     languageDetector_(languageDetector) {}
+
+void DocumentProcessor::accumulate_(string &text, size_t begin, size_t end,
+    Language &language, WordAccumulator &accumulator,
+    folly::Optional<uint64_t> &previousStem) {
+  // each stage below is a flat loop over the token array.
+  auto &tokens = scratch_->tokens;
+  tokens.clear();
+  tokens.reserve((end - begin) / 6);
+  tokenizer::DestructiveTokenIterator it(text, begin, end);
+  it.tokenize(tokens);
+  if (tokens.empty()) {
+    return;
+  }
+  if (language == Language::AUTO) {
+    language = languageDetector_->detect(text, tokens);
+  }
+
+  // a stem is always a prefix of its token, so stemming just
+  // shortens the token in place.
+  const char *cStr = text.c_str();
+  auto stemmer = stemmerManager_->getStemmer(language);
+  for (auto &token : tokens) {
+    size_t len = stemmer->getStemPos(cStr + token.offset, token.length);
+    if (len != token.length) {
+      token.length = (uint32_t) len;
+      token.hash = fnv1a64(cStr + token.offset, len);
     }
-    StringView view(tokenStart, len);
-    uint8_t wordLen = (uint8_t) len;
-    ScoredWord scored(tokenStart, wordLen);
-    if (stopwordFilter_->isStopword(scored.word, doc.language)) {
+  }
+
+  for (auto &token : tokens) {
+    StringView view(cStr + token.offset, token.length);
+
+    // stopwords are filtered before anything is interned, so
+    // they never end up in the term dictionary.
+    if (stopwordFilter_->isStopword(view, token.hash, language)) {
       continue;
     }
-    accumulator.add(view);
+    accumulator.add(view, token.hash);
+    if (bigramBits_ > 0) {
+      if (previousStem.hasValue()) {
+        char term[kBigramTermLength];
+        formatBigramTerm(
+          bigramBucket(previousStem.value(), token.hash, bigramBits_), term
+        );
+        accumulator.addBigram(StringView(term, kBigramTermLength));
+      }
+      previousStem = token.hash;
+    }
+  }
+  if (tokens.capacity() > kMaxRetainedTokens) {
+    vector<Token>().swap(tokens);
   }
+}
+
+void DocumentProcessor::finish_(
+    WordAccumulator &accumulator, ProcessedDocument *result) {
   accumulator.build();
   result->magnitude = accumulator.getMagnitude();
-  result->scoredWords = std::move(accumulator.getScores());
-  result->id = doc.id;
+  auto &scores = accumulator.getScores();
+  result->scoredWords.assign(scores.begin(), scores.end());
   auto timestamp = clock_->getEpochTime();
   result->created = timestamp;
   result->updated = timestamp;
 }
 
+void DocumentProcessor::process_(
+    Document &doc, ProcessedDocument *result, bool internTerms) {
+  auto &accumulator = scratch_->accumulator;
+  accumulator.reset();
+  accumulator.setInternTerms(internTerms);
+  Language language = doc.language;
+  folly::Optional<uint64_t> previousStem;
+  accumulate_(doc.text, 0, doc.text.size(), language, accumulator,
+    previousStem);
+  result->id = doc.id;
+  finish_(accumulator, result);
+}
+
 void DocumentProcessor::process_(
     Document &doc, shared_ptr<ProcessedDocument> result) {
-  return process_(doc, result.get());
+  return process_(doc, result.get(), true);
 }
 
 ProcessedDocument DocumentProcessor::process(Document &doc) {
   ProcessedDocument processed(doc.id);
-  process_(doc, &processed);
+  process_(doc, &processed, true);
   return processed;
 }
 
@@ -100,5 +169,126 @@ shared_ptr<ProcessedDocument> DocumentProcessor::processNew(
   return result;
 }
 
+shared_ptr<ProcessedDocument> DocumentProcessor::processForScoring(
+    shared_ptr<Document> doc) {
+  auto result = std::make_shared<ProcessedDocument>(doc->id);
+  process_(*doc, result.get(), false);
+  return result;
+}
+
+void DocumentProcessor::setBigramBits(size_t bits) {
+  bigramBits_ = std::min(bits, kMaxBigramBits);
+}
+
+static inline bool isAsciiSpace(char c) {
+  return c == ' ' || c == '\n' || c == '\t' || c == '\r'
+      || c == '\f' || c == '\v';
+}
+
+// length of the longest prefix of `text` that doesn't end part way
+// through a UTF-8 sequence.
+static size_t completeUtf8Prefix(const string &text) {
+  size_t lead = text.size();
+  while (lead > 0 && text.size() - lead < 3
+      && (((unsigned char) text[lead - 1]) & 0xc0) == 0x80) {
+    lead--;
+  }
+  if (lead == 0) {
+    return text.size();
+  }
+  unsigned char c = (unsigned char) text[lead - 1];
+  size_t sequenceLength = 1;
+  if ((c & 0xe0) == 0xc0) {
+    sequenceLength = 2;
+  } else if ((c & 0xf0) == 0xe0) {
+    sequenceLength = 3;
+  } else if ((c & 0xf8) == 0xf0) {
+    sequenceLength = 4;
+  }
+  if (lead - 1 + sequenceLength > text.size()) {
+    return lead - 1;
+  }
+  return text.size();
+}
+
+// where to cut a tail that has outgrown `kMaxPendingBytes`: just
+// past its last non-letter, so no token is split, as long as that
+// leaves less than the limit pending.  Failing that the tail is one
+// enormous word, which is cut at its last complete code point.
+static size_t pendingFlushPoint(const string &pending) {
+  size_t complete = completeUtf8Prefix(pending);
+  const char *begin = pending.data();
+  const char *it = begin;
+  const char *end = begin + complete;
+  size_t afterSeparator = 0;
+  while (it < end) {
+    auto codePoint = utf8::next(it, end);
+    if (!libunicode::isLetterPoint(codePoint)) {
+      afterSeparator = it - begin;
+    }
+  }
+  if (pending.size() - afterSeparator <= DocumentUpload::kMaxPendingBytes) {
+    return afterSeparator;
+  }
+  return complete;
+}
+
+void DocumentProcessor::appendToUpload(DocumentUpload &upload, string &text) {
+  DCHECK(!upload.finished);
+  auto &accumulator = upload.accumulator;
+
+  // everything up to and including the last whitespace byte can be
+  // tokenized now; the rest may continue in the next chunk.
+  size_t split = text.size();
+  while (split > 0 && !isAsciiSpace(text[split - 1])) {
+    split--;
+  }
+  if (split == 0) {
+    upload.pending.append(text);
+    if (upload.pending.size() > DocumentUpload::kMaxPendingBytes) {
+      size_t cut = pendingFlushPoint(upload.pending);
+      accumulate_(upload.pending, 0, cut,
+        upload.language, accumulator, upload.previousStem);
+      upload.pending.erase(0, cut);
+    }
+    return;
+  }
+
+  // finish the previous chunk's tail with this chunk's head, then
+  // tokenize the rest of this chunk in place.
+  size_t headEnd = 0;
+  if (!upload.pending.empty()) {
+    while (!isAsciiSpace(text[headEnd])) {
+      headEnd++;
+    }
+    headEnd++;
+    upload.pending.append(text, 0, headEnd);
+    accumulate_(upload.pending, 0, upload.pending.size(),
+      upload.language, accumulator, upload.previousStem);
+    upload.pending.clear();
+  }
+  accumulate_(text, headEnd, split, upload.language, accumulator,
+    upload.previousStem);
+  upload.pending.assign(text, split, string::npos);
+}
+
+shared_ptr<ProcessedDocument> DocumentProcessor::finishUpload(
+    DocumentUpload &upload) {
+  DCHECK(!upload.finished);
+  upload.finished = true;
+  if (!upload.pending.empty()) {
+    accumulate_(upload.pending, 0, upload.pending.size(),
+      upload.language, upload.accumulator, upload.previousStem);
+    string().swap(upload.pending);
+  }
+  auto result = std::make_shared<ProcessedDocument>(upload.documentId);
+  finish_(upload.accumulator, result.get());
+  return result;
+}
+
+stemmer::StemCacheStats DocumentProcessor::getStemCacheStats() {
+  return stemmerManager_->getCacheStats();
+}
+
 } // document_processing_worker
-} // relevanced
\ No newline at end of file
+} // relevanced
@@ -1,7 +1,15 @@
 #pragma once
 #include <memory>
+#include <string>
+#include <vector>
+#include <folly/Optional.h>
+#include <folly/ThreadLocal.h>
 
 #include "declarations.h"
+#include "gen-cpp2/RelevancedProtocol_types.h"
+#include "stemmer/StemmerIf.h"
+#include "text_util/WordAccumulator.h"
+#include "tokenizer/Token.h"
 
 namespace relevanced {
 namespace document_processing_worker {
@@ -16,6 +24,21 @@ class DocumentProcessorIf {
   virtual std::shared_ptr<models::ProcessedDocument>
     processNew(std::shared_ptr<models::Document> doc) = 0;
 
+  // for text that is scored but never stored: terms that aren't
+  // in the `TermDictionary` yet are dropped instead of interned.
+  virtual std::shared_ptr<models::ProcessedDocument>
+    processForScoring(std::shared_ptr<models::Document> doc) = 0;
+
+  // counts the words of the next chunk of `upload`, tokenizing
+  // `text` in place.  The caller holds `upload.mutex`.
+  virtual void appendToUpload(DocumentUpload &upload, std::string &text) = 0;
+
+  // counts whatever is left of `upload` and builds its document.
+  virtual std::shared_ptr<models::ProcessedDocument>
+    finishUpload(DocumentUpload &upload) = 0;
+
+  virtual stemmer::StemCacheStats getStemCacheStats() = 0;
+
   virtual ~DocumentProcessorIf() = default;
 };
 
@@ -24,25 +47,70 @@ class DocumentProcessor : public DocumentProcessorIf {
   std::shared_ptr<stemmer::StemmerManagerIf> stemmerManager_;
   std::shared_ptr<stopwords::StopwordFilterIf> stopwordFilter_;
   std::shared_ptr<util::ClockIf> clock_;
+  std::shared_ptr<language_detection::LanguageDetectorIf> languageDetector_;
+  size_t bigramBits_ {0};
 
-  void process_(models::Document&, models::ProcessedDocument*);
+  // working buffers, reused by every document a pool thread
+  // processes so that the steady state doesn't allocate.
+  struct ThreadScratch {
+    std::vector<tokenizer::Token> tokens;
+    text_util::WordAccumulator accumulator {200};
+  };
+  struct ThreadScratchTag {};
+  folly::ThreadLocal<ThreadScratch, ThreadScratchTag> scratch_;
+
+  // a `language` of `AUTO` is replaced with the detected one.
+  // `previousStem` is the hash of the last stem counted, which
+  // starts the first bigram of `text`; it is updated on return.
+  void accumulate_(std::string &text, size_t begin, size_t end,
+    thrift_protocol::Language &language, text_util::WordAccumulator&,
+    folly::Optional<uint64_t> &previousStem);
+
+  void finish_(text_util::WordAccumulator&, models::ProcessedDocument*);
+
+  void process_(models::Document&, models::ProcessedDocument*,
+    bool internTerms);
 
   void process_(models::Document&, std::shared_ptr<models::ProcessedDocument>);
 
  public:
+  // detects `Language::AUTO` documents with a `LanguageDetector`.
   DocumentProcessor(
     std::shared_ptr<stemmer::StemmerManagerIf>,
     std::shared_ptr<stopwords::StopwordFilterIf>,
     std::shared_ptr<util::ClockIf>
   );
 
+  DocumentProcessor(
+    std::shared_ptr<stemmer::StemmerManagerIf>,
+    std::shared_ptr<stopwords::StopwordFilterIf>,
+    std::shared_ptr<util::ClockIf>,
+    std::shared_ptr<language_detection::LanguageDetectorIf>
+  );
+
   std::shared_ptr<models::ProcessedDocument>
     processNew(models::Document&) override;
 
   std::shared_ptr<models::ProcessedDocument>
     processNew(std::shared_ptr<models::Document>) override;
 
+  std::shared_ptr<models::ProcessedDocument>
+    processForScoring(std::shared_ptr<models::Document>) override;
+
   models::ProcessedDocument process(models::Document&) override;
+
+  // with `bits` > 0, every pair of adjacent non-stopword stems is
+  // also counted as a hashed bigram feature, in one of `2^bits`
+  // buckets (see `text_util/bigrams.h`).  0 disables bigrams.
+  // Must be called before any documents are processed.
+  void setBigramBits(size_t bits);
+
+  void appendToUpload(DocumentUpload&, std::string &text) override;
+
+  std::shared_ptr<models::ProcessedDocument>
+    finishUpload(DocumentUpload&) override;
+
+  stemmer::StemCacheStats getStemCacheStats() override;
 };
 
 } // document_processing_worker
@@ -0,0 +1,66 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <folly/Optional.h>
+#include "gen-cpp2/RelevancedProtocol_types.h"
+#include "text_util/WordAccumulator.h"
+#include "util/util.h"
+
+namespace relevanced {
+namespace document_processing_worker {
+
+/**
+ * A document whose text arrives in chunks
+ * (`beginDocumentUpload`, `appendDocumentUpload`,
+ * `commitDocumentUpload`).
+ *
+ * Each chunk is tokenized and counted as soon as it arrives, so an
+ * upload holds its word counts, a running SHA1, and the unfinished
+ * tail of the last chunk -- never the whole text.  The tail starts
+ * after the chunk's last ASCII whitespace byte, which can't be part
+ * of a token, so a word split across two chunks is counted once.
+ * A tail that grows past `kMaxPendingBytes` without any whitespace
+ * is tokenized up to its last non-letter, so a token is only ever
+ * split if it's longer than the limit itself, and never part way
+ * through a code point.
+ *
+ * `RelevanceServer` caps how many uploads can be in progress, and
+ * discards uploads that go idle.
+ */
+class DocumentUpload {
+ public:
+  static const size_t kMaxPendingBytes = 64 * 1024;
+
+  const std::string documentId;
+
+  // an upload begun as `Language::AUTO` takes the language detected
+  // in the first chunk that has any words, and keeps it for the
+  // rest of the document.
+  thrift_protocol::Language language;
+
+  // held while a chunk is processed.  Chunks are applied in the
+  // order they take the lock, so a client should wait for each
+  // append to finish before sending the next one.
+  std::mutex mutex;
+
+  std::string pending;
+
+  // so that a bigram can span two chunks.
+  folly::Optional<uint64_t> previousStem;
+  text_util::WordAccumulator accumulator {200};
+  util::Sha1Stream sha1;
+  size_t bytesReceived {0};
+  bool finished {false};
+
+  // epoch seconds of the last begin or append.
+  std::atomic<int64_t> lastActivity {0};
+
+  DocumentUpload(const std::string &documentId,
+      thrift_protocol::Language language)
+    : documentId(documentId), language(language) {}
+};
+
+} // document_processing_worker
+} // relevanced
@@ -22,6 +22,7 @@
 #include "persistence/InMemoryRockHandle.h"
 #include "document_processing_worker/DocumentProcessor.h"
 #include "document_processing_worker/DocumentProcessingWorker.h"
+#include "document_processing_worker/DocumentUpload.h"
 #include "stopwords/StopwordFilter.h"
 #include "stemmer/ThreadSafeStemmerManager.h"
 #include "models/ProcessedDocument.h"
@@ -45,6 +46,7 @@ using namespace relevanced::document_processing_worker;
 using namespace relevanced::stemmer;
 using namespace relevanced::stopwords;
 using relevanced::thrift_protocol::Language;
+using relevanced::thrift_protocol::EUploadDoesNotExist;
 
 using ::testing::Return;
 using ::testing::_;
@@ -94,7 +96,7 @@ TEST(DocumentProcessingWorker, TestSanity) {
   EXPECT_EQ("doc-id", result->id);
   set<string> words;
   for (auto &scoredWord: result->scoredWords) {
-    words.insert(scoredWord.word);
+    words.insert(scoredWord.getWord());
   }
   EXPECT_TRUE(words.find("fish") != words.end());
 }
@@ -111,3 +113,30 @@ TEST(DocumentProcessingWorker, TestWithWithoutHash) {
   auto result2 = ctx.worker->processNewWithoutHash(docPtr).get();
   EXPECT_FALSE(result2->sha1Hash.hasValue());
 }
+
+TEST(DocumentProcessingWorker, TestUpload) {
+  ProcessingWorkerTestCtx ctx;
+  string text = "this is some Document text, in two chunks";
+  auto document = std::make_shared<Document>("doc-id", text, Language::EN);
+  auto whole = ctx.worker->processNew(document).get();
+
+  auto upload = std::make_shared<DocumentUpload>("doc-id", Language::EN);
+  ctx.worker->appendToUpload(
+    upload, std::make_shared<string>(text.substr(0, 17))
+  ).get();
+  ctx.worker->appendToUpload(
+    upload, std::make_shared<string>(text.substr(17))
+  ).get();
+  auto uploaded = ctx.worker->finishUpload(upload).get();
+  EXPECT_EQ(text.size(), upload->bytesReceived);
+  EXPECT_EQ(util::sha1(text), uploaded->sha1Hash.value());
+  EXPECT_EQ(whole->sha1Hash.value(), uploaded->sha1Hash.value());
+  EXPECT_EQ(whole->scoredWords.size(), uploaded->scoredWords.size());
+
+  // a chunk that only gets its turn after the commit is refused.
+  auto late = ctx.worker->appendToUpload(
+    upload, std::make_shared<string>("more text")
+  ).get();
+  EXPECT_TRUE(late.hasException<EUploadDoesNotExist>());
+  EXPECT_EQ(text.size(), upload->bytesReceived);
+}
@@ -28,6 +28,7 @@ using namespace relevanced::util;
 using namespace relevanced::text_util;
 using relevanced::stopwords::StopwordFilterIf;
 using relevanced::stemmer::StemmerIf;
+using relevanced::stemmer::StemCacheStats;
 using relevanced::thrift_protocol::Language;
 using ::testing::Return;
 using ::testing::_;
@@ -37,7 +38,10 @@ class MockDocumentProcessor : public DocumentProcessorIf {
   MOCK_METHOD1(process, ProcessedDocument(Document&));
   MOCK_METHOD1(processNew, shared_ptr<ProcessedDocument>(Document&));
   MOCK_METHOD1(processNew, shared_ptr<ProcessedDocument>(shared_ptr<Document>));
-
+  MOCK_METHOD1(processForScoring, shared_ptr<ProcessedDocument>(shared_ptr<Document>));
+  MOCK_METHOD2(appendToUpload, void(DocumentUpload&, string&));
+  MOCK_METHOD1(finishUpload, shared_ptr<ProcessedDocument>(DocumentUpload&));
+  MOCK_METHOD0(getStemCacheStats, StemCacheStats());
 };
 
 TEST(DocumentProcessingWorker, Simple) {
@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
+#include <algorithm>
+#include <map>
 #include <vector>
 #include <string>
 #include <memory>
@@ -7,8 +9,11 @@
 #include "testing/TestHelpers.h"
 #include "models/Document.h"
 #include "document_processing_worker/DocumentProcessor.h"
+#include "document_processing_worker/DocumentUpload.h"
+#include "language_detection/LanguageDetector.h"
 #include "models/ProcessedDocument.h"
 #include "stopwords/StopwordFilter.h"
+#include "text_util/TermDictionary.h"
 #include "stemmer/Utf8Stemmer.h"
 #include "stemmer/StemmerIf.h"
 #include "stemmer/StemmerManagerIf.h"
@@ -23,7 +28,11 @@ using namespace relevanced::util;
 using relevanced::thrift_protocol::Language;
 using relevanced::stopwords::StopwordFilterIf;
 using relevanced::stemmer::StemmerIf;
+using relevanced::stemmer::StemCacheStats;
 using relevanced::stemmer::StemmerManagerIf;
+using relevanced::language_detection::LanguageDetectorIf;
+using relevanced::tokenizer::Token;
+using relevanced::text_util::TermDictionary;
 
 
 using ::testing::Return;
@@ -50,6 +59,19 @@ public:
     calledWith = lang;
     return shared_ptr<StemmerIf>(new NonStemmer);
   }
+  StemCacheStats getCacheStats() {
+    return StemCacheStats();
+  }
+};
+
+class StubLanguageDetector: public LanguageDetectorIf {
+public:
+  Language detected {Language::DE};
+  size_t callCount {0};
+  Language detect(const string&, const vector<Token>&) override {
+    callCount++;
+    return detected;
+  }
 };
 
 TEST(DocumentProcessor, Simple) {
@@ -84,3 +106,373 @@ TEST(DocumentProcessor, Simple) {
   EXPECT_EQ(Language::EN, stemmerManager.calledWith);
 
 }
+
+TEST(DocumentProcessor, ProcessForScoringDoesNotInternTerms) {
+  MockStopwordFilter stopwordFilter_;
+  shared_ptr<StopwordFilterIf> stopwordFilter(
+    &stopwordFilter_,
+    NonDeleter<StopwordFilterIf>()
+  );
+  MockClock mClock;
+  shared_ptr<ClockIf> clockPtr(&mClock, NonDeleter<ClockIf>());
+  EXPECT_CALL(mClock, getEpochTime()).WillRepeatedly(Return(1234));
+  NonStemmerManager stemmerManager;
+  shared_ptr<StemmerManagerIf> stemmerManagerPtr(
+    &stemmerManager, NonDeleter<StemmerManagerIf>()
+  );
+  DocumentProcessor processor(
+    stemmerManagerPtr, stopwordFilter, clockPtr
+  );
+  auto dictionary = TermDictionary::getDefault();
+
+  Document stored("doc-1", "storedscoringterm", Language::EN);
+  processor.process(stored);
+  auto scored = processor.processForScoring(std::make_shared<Document>(
+    "no-id", "storedscoringterm unseenscoringterm", Language::EN
+  ));
+  EXPECT_FALSE(dictionary->findId(string("unseenscoringterm")).hasValue());
+  ASSERT_EQ(1, scored->scoredWords.size());
+  EXPECT_EQ("storedscoringterm", scored->scoredWords.at(0).getWord());
+
+  // the next stored document interns its terms again.
+  Document next("doc-2", "unseenscoringterm", Language::EN);
+  auto result = processor.process(next);
+  EXPECT_EQ(1, result.scoredWords.size());
+  EXPECT_TRUE(dictionary->findId(string("unseenscoringterm")).hasValue());
+}
+
+TEST(DocumentProcessor, UploadMatchesWholeText) {
+  MockStopwordFilter stopwordFilter_;
+  shared_ptr<StopwordFilterIf> stopwordFilter(
+    &stopwordFilter_,
+    NonDeleter<StopwordFilterIf>()
+  );
+  MockClock mClock;
+  shared_ptr<ClockIf> clockPtr(&mClock, NonDeleter<ClockIf>());
+  EXPECT_CALL(mClock, getEpochTime()).WillRepeatedly(Return(1234));
+  NonStemmerManager stemmerManager;
+  shared_ptr<StemmerManagerIf> stemmerManagerPtr(
+    &stemmerManager, NonDeleter<StemmerManagerIf>()
+  );
+  DocumentProcessor processor(
+    stemmerManagerPtr, stopwordFilter, clockPtr
+  );
+
+  string text = "Some text about fish, and more FISH.\nThen cats; "
+                "then some more text about cats and fish";
+  Document whole("doc-id", text, Language::EN);
+  auto expected = processor.process(whole);
+
+  // chunks that split words, and chunks with no whitespace at all
+  vector<string> chunks {
+    "Some te", "xt about fi", "sh", ", and more FISH", ".\nThen cats; ",
+    "then some more text about ", "cats and fi", "sh"
+  };
+  DocumentUpload upload("doc-id", Language::EN);
+  for (auto chunk : chunks) {
+    processor.appendToUpload(upload, chunk);
+  }
+  auto result = processor.finishUpload(upload);
+  EXPECT_TRUE(upload.finished);
+  EXPECT_EQ("doc-id", result->id);
+  EXPECT_EQ(1234, result->created);
+  EXPECT_EQ(expected.magnitude, result->magnitude);
+  ASSERT_EQ(expected.scoredWords.size(), result->scoredWords.size());
+  for (size_t i = 0; i < expected.scoredWords.size(); i++) {
+    EXPECT_EQ(
+      expected.scoredWords[i].termId, result->scoredWords[i].termId
+    );
+    EXPECT_EQ(expected.scoredWords[i].score, result->scoredWords[i].score);
+  }
+}
+
+TEST(DocumentProcessor, UploadBoundsPendingText) {
+  MockStopwordFilter stopwordFilter_;
+  shared_ptr<StopwordFilterIf> stopwordFilter(
+    &stopwordFilter_,
+    NonDeleter<StopwordFilterIf>()
+  );
+  MockClock mClock;
+  shared_ptr<ClockIf> clockPtr(&mClock, NonDeleter<ClockIf>());
+  NonStemmerManager stemmerManager;
+  shared_ptr<StemmerManagerIf> stemmerManagerPtr(
+    &stemmerManager, NonDeleter<StemmerManagerIf>()
+  );
+  DocumentProcessor processor(
+    stemmerManagerPtr, stopwordFilter, clockPtr
+  );
+  DocumentUpload upload("doc-id", Language::EN);
+  string chunk(1000, 'x');
+  for (size_t i = 0; i < 100; i++) {
+    string toAppend = chunk;
+    processor.appendToUpload(upload, toAppend);
+    EXPECT_TRUE(upload.pending.size() <= DocumentUpload::kMaxPendingBytes);
+  }
+  string last = " tail end";
+  processor.appendToUpload(upload, last);
+  EXPECT_EQ("end", upload.pending);
+}
+
+TEST(DocumentProcessor, UploadFlushesLongNonAsciiRun) {
+  MockStopwordFilter stopwordFilter_;
+  shared_ptr<StopwordFilterIf> stopwordFilter(
+    &stopwordFilter_,
+    NonDeleter<StopwordFilterIf>()
+  );
+  MockClock mClock;
+  shared_ptr<ClockIf> clockPtr(&mClock, NonDeleter<ClockIf>());
+  EXPECT_CALL(mClock, getEpochTime()).WillRepeatedly(Return(1234));
+  NonStemmerManager stemmerManager;
+  shared_ptr<StemmerManagerIf> stemmerManagerPtr(
+    &stemmerManager, NonDeleter<StemmerManagerIf>()
+  );
+  DocumentProcessor processor(
+    stemmerManagerPtr, stopwordFilter, clockPtr
+  );
+
+  // no whitespace anywhere, and two-byte letters that 999-byte
+  // chunks keep splitting.
+  string text;
+  for (size_t i = 0; text.size() < 3 * DocumentUpload::kMaxPendingBytes; i++) {
+    text += (i % 2 == 0) ? "grüße-" : "öffnen,";
+  }
+  text += "schluß";
+  Document whole("doc-id", text, Language::DE);
+  auto expected = processor.process(whole);
+
+  DocumentUpload upload("doc-id", Language::DE);
+  for (size_t offset = 0; offset < text.size(); offset += 999) {
+    string chunk = text.substr(offset, 999);
+    processor.appendToUpload(upload, chunk);
+    EXPECT_TRUE(upload.pending.size() <= DocumentUpload::kMaxPendingBytes);
+  }
+  auto result = processor.finishUpload(upload);
+  EXPECT_EQ(expected.magnitude, result->magnitude);
+  ASSERT_EQ(expected.scoredWords.size(), result->scoredWords.size());
+  for (size_t i = 0; i < expected.scoredWords.size(); i++) {
+    EXPECT_EQ(
+      expected.scoredWords[i].termId, result->scoredWords[i].termId
+    );
+    EXPECT_EQ(expected.scoredWords[i].score, result->scoredWords[i].score);
+  }
+
+  // a single word longer than the limit is cut between code points.
+  DocumentUpload longWord("doc-id", Language::DE);
+  string letters;
+  for (size_t i = 0; i < DocumentUpload::kMaxPendingBytes; i++) {
+    letters += "ü";
+  }
+  for (size_t offset = 0; offset < letters.size(); offset += 999) {
+    string chunk = letters.substr(offset, 999);
+    processor.appendToUpload(longWord, chunk);
+    EXPECT_TRUE(longWord.pending.size() <= DocumentUpload::kMaxPendingBytes);
+  }
+  processor.finishUpload(longWord);
+}
+
+TEST(DocumentProcessor, DetectsAutoLanguage) {
+  MockStopwordFilter stopwordFilter_;
+  shared_ptr<StopwordFilterIf> stopwordFilter(
+    &stopwordFilter_,
+    NonDeleter<StopwordFilterIf>()
+  );
+  MockClock mClock;
+  shared_ptr<ClockIf> clockPtr(&mClock, NonDeleter<ClockIf>());
+  EXPECT_CALL(mClock, getEpochTime()).WillRepeatedly(Return(1234));
+  NonStemmerManager stemmerManager;
+  shared_ptr<StemmerManagerIf> stemmerManagerPtr(
+    &stemmerManager, NonDeleter<StemmerManagerIf>()
+  );
+  StubLanguageDetector detector;
+  shared_ptr<LanguageDetectorIf> detectorPtr(
+    &detector, NonDeleter<LanguageDetectorIf>()
+  );
+  DocumentProcessor processor(
+    stemmerManagerPtr, stopwordFilter, clockPtr, detectorPtr
+  );
+
+  Document explicitDoc("doc-1", "some text about fish", Language::EN);
+  processor.process(explicitDoc);
+  EXPECT_EQ(0, detector.callCount);
+  EXPECT_EQ(Language::EN, stemmerManager.calledWith);
+
+  Document autoDoc("doc-2", "etwas Text über Fische", Language::AUTO);
+  auto result = processor.process(autoDoc);
+  EXPECT_EQ(1, detector.callCount);
+  EXPECT_EQ(Language::DE, stemmerManager.calledWith);
+  EXPECT_EQ(4, result.scoredWords.size());
+}
+
+TEST(DocumentProcessor, UploadDetectsLanguageOnce) {
+  MockStopwordFilter stopwordFilter_;
+  shared_ptr<StopwordFilterIf> stopwordFilter(
+    &stopwordFilter_,
+    NonDeleter<StopwordFilterIf>()
+  );
+  MockClock mClock;
+  shared_ptr<ClockIf> clockPtr(&mClock, NonDeleter<ClockIf>());
+  EXPECT_CALL(mClock, getEpochTime()).WillRepeatedly(Return(1234));
+  NonStemmerManager stemmerManager;
+  shared_ptr<StemmerManagerIf> stemmerManagerPtr(
+    &stemmerManager, NonDeleter<StemmerManagerIf>()
+  );
+  StubLanguageDetector detector;
+  detector.detected = Language::FR;
+  shared_ptr<LanguageDetectorIf> detectorPtr(
+    &detector, NonDeleter<LanguageDetectorIf>()
+  );
+  DocumentProcessor processor(
+    stemmerManagerPtr, stopwordFilter, clockPtr, detectorPtr
+  );
+
+  DocumentUpload upload("doc-id", Language::AUTO);
+  // the first chunk has no complete word yet.
+  vector<string> chunks {"les ch", "ats dorment ", "sur le toit ", "encore"};
+  for (auto chunk : chunks) {
+    processor.appendToUpload(upload, chunk);
+  }
+  processor.finishUpload(upload);
+  EXPECT_EQ(1, detector.callCount);
+  EXPECT_EQ(Language::FR, upload.language);
+  EXPECT_EQ(Language::FR, stemmerManager.calledWith);
+}
+
+TEST(DocumentProcessor, BigramFeatures) {
+  MockStopwordFilter stopwordFilter_;
+  shared_ptr<StopwordFilterIf> stopwordFilter(
+    &stopwordFilter_,
+    NonDeleter<StopwordFilterIf>()
+  );
+  MockClock mClock;
+  shared_ptr<ClockIf> clockPtr(&mClock, NonDeleter<ClockIf>());
+  EXPECT_CALL(mClock, getEpochTime()).WillRepeatedly(Return(1234));
+  NonStemmerManager stemmerManager;
+  shared_ptr<StemmerManagerIf> stemmerManagerPtr(
+    &stemmerManager, NonDeleter<StemmerManagerIf>()
+  );
+  DocumentProcessor processor(
+    stemmerManagerPtr, stopwordFilter, clockPtr
+  );
+  processor.setBigramBits(16);
+
+  // "fish swim" twice and "swim fish" once.
+  Document doc("doc-id", "fish swim fish swim", Language::EN);
+  auto result = processor.process(doc);
+  ASSERT_EQ(4, result.scoredWords.size());
+  map<string, float> scores;
+  size_t bigramCount = 0;
+  for (auto &word : result.scoredWords) {
+    auto term = word.getWord();
+    if (term.substr(0, 3) == "_bg") {
+      bigramCount++;
+    }
+    scores[term] = word.score;
+  }
+  EXPECT_EQ(2, bigramCount);
+
+  // bigrams are normalized separately, so words keep the scores
+  // they have without bigrams.
+  EXPECT_FLOAT_EQ(0.5, scores["fish"]);
+  EXPECT_FLOAT_EQ(0.5, scores["swim"]);
+  vector<float> bigramScores;
+  for (auto &elem : scores) {
+    if (elem.first.substr(0, 3) == "_bg") {
+      bigramScores.push_back(elem.second);
+    }
+  }
+  std::sort(bigramScores.begin(), bigramScores.end());
+  EXPECT_FLOAT_EQ(1.0 / 3, bigramScores[0]);
+  EXPECT_FLOAT_EQ(2.0 / 3, bigramScores[1]);
+
+  // the same bigram in another document gets the same feature.
+  Document other("doc-2", "big fish swim", Language::EN);
+  auto otherResult = processor.process(other);
+  size_t shared = 0;
+  for (auto &word : otherResult.scoredWords) {
+    if (scores.count(word.getWord()) > 0) {
+      shared++;
+    }
+  }
+  EXPECT_EQ(3, shared);
+}
+
+TEST(DocumentProcessor, BigramsLeaveWordScoresUnchanged) {
+  MockStopwordFilter stopwordFilter_;
+  shared_ptr<StopwordFilterIf> stopwordFilter(
+    &stopwordFilter_,
+    NonDeleter<StopwordFilterIf>()
+  );
+  MockClock mClock;
+  shared_ptr<ClockIf> clockPtr(&mClock, NonDeleter<ClockIf>());
+  EXPECT_CALL(mClock, getEpochTime()).WillRepeatedly(Return(1234));
+  NonStemmerManager stemmerManager;
+  shared_ptr<StemmerManagerIf> stemmerManagerPtr(
+    &stemmerManager, NonDeleter<StemmerManagerIf>()
+  );
+  DocumentProcessor processor(
+    stemmerManagerPtr, stopwordFilter, clockPtr
+  );
+  Document doc(
+    "doc-id", "some text about fish and more fish then cats", Language::EN
+  );
+  auto plain = processor.process(doc);
+  processor.setBigramBits(12);
+  auto withBigrams = processor.process(doc);
+
+  map<string, float> plainScores;
+  for (auto &word : plain.scoredWords) {
+    plainScores[word.getWord()] = word.score;
+  }
+  size_t words = 0;
+  for (auto &word : withBigrams.scoredWords) {
+    auto term = word.getWord();
+    if (term.substr(0, 3) == "_bg") {
+      continue;
+    }
+    words++;
+    ASSERT_EQ(1, plainScores.count(term));
+    EXPECT_EQ(plainScores[term], word.score);
+  }
+  EXPECT_EQ(plainScores.size(), words);
+}
+
+TEST(DocumentProcessor, UploadMatchesWholeTextWithBigrams) {
+  MockStopwordFilter stopwordFilter_;
+  shared_ptr<StopwordFilterIf> stopwordFilter(
+    &stopwordFilter_,
+    NonDeleter<StopwordFilterIf>()
+  );
+  MockClock mClock;
+  shared_ptr<ClockIf> clockPtr(&mClock, NonDeleter<ClockIf>());
+  EXPECT_CALL(mClock, getEpochTime()).WillRepeatedly(Return(1234));
+  NonStemmerManager stemmerManager;
+  shared_ptr<StemmerManagerIf> stemmerManagerPtr(
+    &stemmerManager, NonDeleter<StemmerManagerIf>()
+  );
+  DocumentProcessor processor(
+    stemmerManagerPtr, stopwordFilter, clockPtr
+  );
+  processor.setBigramBits(12);
+
+  string text = "Some text about fish, and more FISH.\nThen cats; "
+                "then some more text about cats and fish";
+  Document whole("doc-id", text, Language::EN);
+  auto expected = processor.process(whole);
+
+  vector<string> chunks {
+    "Some te", "xt about fi", "sh", ", and more FISH", ".\nThen cats; ",
+    "then some more text about ", "cats and fi", "sh"
+  };
+  DocumentUpload upload("doc-id", Language::EN);
+  for (auto chunk : chunks) {
+    processor.appendToUpload(upload, chunk);
+  }
+  auto result = processor.finishUpload(upload);
+  ASSERT_EQ(expected.scoredWords.size(), result->scoredWords.size());
+  for (size_t i = 0; i < expected.scoredWords.size(); i++) {
+    EXPECT_EQ(
+      expected.scoredWords[i].termId, result->scoredWords[i].termId
+    );
+    EXPECT_EQ(expected.scoredWords[i].score, result->scoredWords[i].score);
+  }
+}
@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <utf8.h>
+
+#include "language_detection/LanguageDetector.h"
+#include "libunicode/code_point_table.h"
+#include "libunicode/UnicodeBlock.h"
+#include "stopwords/english_stopwords.h"
+#include "stopwords/french_stopwords.h"
+#include "stopwords/german_stopwords.h"
+#include "stopwords/italian_stopwords.h"
+#include "stopwords/spanish_stopwords.h"
+#include "text_util/StringView.h"
+#include "tokenizer/Token.h"
+
+using namespace std;
+
+namespace relevanced {
+namespace language_detection {
+
+using libunicode::UnicodeBlock;
+using text_util::StringView;
+using thrift_protocol::Language;
+using tokenizer::Token;
+
+const size_t LanguageDetector::kMaxSampledTokens;
+const size_t LanguageDetector::kMinStopwordHits;
+
+namespace {
+
+enum class Script { LATIN, CYRILLIC, OTHER };
+
+Script scriptOf(const char *word, size_t length) {
+  if (((unsigned char) word[0]) < 0x80) {
+    return Script::LATIN;
+  }
+  // tokens were re-encoded by the tokenizer, so they're valid UTF-8.
+  uint32_t codePoint = utf8::next(word, word + length);
+  auto block = (UnicodeBlock) libunicode::lookupCodePoint(codePoint).block;
+  switch (block) {
+    case UnicodeBlock::LATIN_1_SUPPLEMENT :
+    case UnicodeBlock::LATIN_EXTENDED_A :
+    case UnicodeBlock::LATIN_EXTENDED_B :
+    case UnicodeBlock::LATIN_EXTENDED_ADDITIONAL :
+      return Script::LATIN;
+    case UnicodeBlock::CYRILLIC :
+    case UnicodeBlock::CYRILLIC_SUPPLEMENT :
+    case UnicodeBlock::CYRILLIC_EXTENDED_A :
+    case UnicodeBlock::CYRILLIC_EXTENDED_B :
+      return Script::CYRILLIC;
+    default :
+      return Script::OTHER;
+  }
+}
+
+typedef bool (*StopwordLookup)(const StringView&, uint64_t);
+
+struct LatinProfile {
+  Language language;
+  StopwordLookup isStopword;
+};
+
+// ties go to the earlier entry.
+const LatinProfile kLatinProfiles[] = {
+  {Language::EN, stopwords::isEnglishStopword},
+  {Language::DE, stopwords::isGermanStopword},
+  {Language::FR, stopwords::isFrenchStopword},
+  {Language::ES, stopwords::isSpanishStopword},
+  {Language::IT, stopwords::isItalianStopword}
+};
+
+const size_t kLatinProfileCount =
+  sizeof(kLatinProfiles) / sizeof(kLatinProfiles[0]);
+
+} // anonymous namespace
+
+Language LanguageDetector::detect(const string &text,
+                                  const vector<Token> &tokens) {
+  size_t latin = 0;
+  size_t cyrillic = 0;
+  size_t other = 0;
+  size_t hits[kLatinProfileCount] = {0};
+  size_t sampled = std::min(tokens.size(), kMaxSampledTokens);
+  const char *cStr = text.c_str();
+  for (size_t i = 0; i < sampled; i++) {
+    auto &token = tokens[i];
+    const char *word = cStr + token.offset;
+    switch (scriptOf(word, token.length)) {
+      case Script::LATIN :
+        latin++;
+        break;
+      case Script::CYRILLIC :
+        cyrillic++;
+        continue;
+      case Script::OTHER :
+        other++;
+        continue;
+    }
+    StringView view(word, token.length);
+    for (size_t lang = 0; lang < kLatinProfileCount; lang++) {
+      if (kLatinProfiles[lang].isStopword(view, token.hash)) {
+        hits[lang]++;
+      }
+    }
+  }
+  if (cyrillic > latin && cyrillic >= other) {
+    return Language::RU;
+  }
+  if (other > latin) {
+    return Language::OTHER;
+  }
+  size_t best = 0;
+  for (size_t lang = 1; lang < kLatinProfileCount; lang++) {
+    if (hits[lang] > hits[best]) {
+      best = lang;
+    }
+  }
+  if (hits[best] < kMinStopwordHits) {
+    return Language::EN;
+  }
+  return kLatinProfiles[best].language;
+}
+
+} // language_detection
+} // relevanced
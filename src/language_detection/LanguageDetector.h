@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "gen-cpp2/RelevancedProtocol_types.h"
+#include "tokenizer/Token.h"
+
+namespace relevanced {
+namespace language_detection {
+
+class LanguageDetectorIf {
+ public:
+  // `tokens` are the output of `DestructiveTokenIterator::tokenize`
+  // over `text`.  Never returns `Language::AUTO`.
+  virtual thrift_protocol::Language detect(
+    const std::string &text,
+    const std::vector<tokenizer::Token> &tokens
+  ) = 0;
+
+  virtual ~LanguageDetectorIf() = default;
+};
+
+/**
+ * Picks a language for documents sent as `Language::AUTO`.
+ *
+ * Runs after tokenization, so it works on normalized tokens whose
+ * hashes are already known.  The first code point of each token
+ * gives its Unicode block: Cyrillic text is Russian, and text in
+ * any other non-Latin script is `OTHER`.  Latin-script text is
+ * scored against each language's stopword table; stopwords are
+ * the most frequent words of a language, so a few hundred tokens
+ * are enough to tell them apart.
+ *
+ * Only the first `kMaxSampledTokens` tokens are looked at.  Text
+ * with too few stopwords to decide falls back to English, which is
+ * what an unknown language has always been treated as.
+ */
+class LanguageDetector : public LanguageDetectorIf {
+ public:
+  static const size_t kMaxSampledTokens = 512;
+  static const size_t kMinStopwordHits = 2;
+
+  thrift_protocol::Language detect(
+    const std::string &text,
+    const std::vector<tokenizer::Token> &tokens
+  ) override;
+};
+
+} // language_detection
+} // relevanced
@@ -0,0 +1,78 @@
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "gen-cpp2/RelevancedProtocol_types.h"
+#include "language_detection/LanguageDetector.h"
+#include "tokenizer/DestructiveTokenIterator.h"
+#include "tokenizer/Token.h"
+
+using namespace std;
+using namespace relevanced;
+using relevanced::language_detection::LanguageDetector;
+using relevanced::thrift_protocol::Language;
+using relevanced::tokenizer::DestructiveTokenIterator;
+using relevanced::tokenizer::Token;
+
+namespace {
+
+Language detect(string text) {
+  vector<Token> tokens;
+  DestructiveTokenIterator it(text);
+  it.tokenize(tokens);
+  LanguageDetector detector;
+  return detector.detect(text, tokens);
+}
+
+} // anonymous namespace
+
+TEST(LanguageDetector, TestEnglish) {
+  EXPECT_EQ(Language::EN, detect(
+    "The fish were swimming through the reeds, and they were "
+    "not worried about any of the cats on the bank."
+  ));
+}
+
+TEST(LanguageDetector, TestGerman) {
+  EXPECT_EQ(Language::DE, detect(
+    "Die Katze sitzt auf dem Dach und wartet, weil sie nicht "
+    "weiß, wann der Regen aufhört."
+  ));
+}
+
+TEST(LanguageDetector, TestFrench) {
+  EXPECT_EQ(Language::FR, detect(
+    "Les chats dorment sur le toit parce qu'ils aiment "
+    "bien le soleil, mais nous avons des poissons."
+  ));
+}
+
+TEST(LanguageDetector, TestSpanish) {
+  EXPECT_EQ(Language::ES, detect(
+    "Los gatos duermen sobre el tejado porque les gusta mucho "
+    "el sol, pero nosotros tenemos una casa para ellos."
+  ));
+}
+
+TEST(LanguageDetector, TestItalian) {
+  EXPECT_EQ(Language::IT, detect(
+    "I gatti dormono sul tetto perché gli piace molto il sole, "
+    "e questo è quello che fanno sempre nella casa."
+  ));
+}
+
+TEST(LanguageDetector, TestRussian) {
+  EXPECT_EQ(Language::RU, detect(
+    "Кошка сидит на крыше и ждёт, когда закончится дождь."
+  ));
+}
+
+TEST(LanguageDetector, TestOtherScript) {
+  EXPECT_EQ(Language::OTHER, detect(
+    "Η γάτα κάθεται στη στέγη και περιμένει τη βροχή."
+  ));
+}
+
+TEST(LanguageDetector, TestTooFewStopwordsFallsBackToEnglish) {
+  EXPECT_EQ(Language::EN, detect("relevanced centroid similarity"));
+  EXPECT_EQ(Language::EN, detect(""));
+}
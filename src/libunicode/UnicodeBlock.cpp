@@ -1,1056 +1,14 @@
 #include "UnicodeBlock.h"
+#include "libunicode/code_point_table.h"
 
 
 namespace relevanced {
 namespace libunicode {
 
 UnicodeBlock getUnicodeBlock(uint32_t codePoint) {
-  auto cp = codePoint;
-  if (cp < 592) {
-    if (cp < 256) {
-      if (cp <= 127) {
-        return UnicodeBlock::BASIC_LATIN;
-      } else {
-        return UnicodeBlock::LATIN_1_SUPPLEMENT;
-      }
-    } else {
-      if (cp <= 383) {
-        return UnicodeBlock::LATIN_EXTENDED_A;
-      } else {
-        return UnicodeBlock::LATIN_EXTENDED_B;
-      }
-    }
-  }
-
-  if (cp < 43392) {
-    if (cp < 8192) {
-      if (cp < 4608) {
-        if (cp < 2304) {
-          if (cp < 1536) {
-            if (cp < 1024) {
-              if (cp < 768) {
-                if (cp <= 687) {
-                  return UnicodeBlock::IPA_EXTENSIONS;
-                } else {
-                  return UnicodeBlock::SPACING_MODIFIER_LETTERS;
-                }
-              } else {
-                if (cp <= 879) {
-                  return UnicodeBlock::COMBINING_DIACRITICAL_MARKS;
-                } else {
-                  return UnicodeBlock::GREEK_AND_COPTIC;
-                }
-              }
-            } else {
-              if (cp < 1328) {
-                if (cp <= 1279) {
-                  return UnicodeBlock::CYRILLIC;
-                } else {
-                  return UnicodeBlock::CYRILLIC_SUPPLEMENT;
-                }
-              } else {
-                if (cp <= 1423) {
-                  return UnicodeBlock::ARMENIAN;
-                } else {
-                  return UnicodeBlock::HEBREW;
-                }
-              }
-            }
-          } else {
-            if (cp < 1984) {
-              if (cp < 1872) {
-                if (cp <= 1791) {
-                  return UnicodeBlock::ARABIC;
-                } else {
-                  return UnicodeBlock::SYRIAC;
-                }
-              } else {
-                if (cp <= 1919) {
-                  return UnicodeBlock::ARABIC_SUPPLEMENT;
-                } else {
-                  return UnicodeBlock::THAANA;
-                }
-              }
-            } else {
-              if (cp < 2112) {
-                if (cp <= 2047) {
-                  return UnicodeBlock::NKO;
-                } else {
-                  return UnicodeBlock::SAMARITAN;
-                }
-              } else {
-                if (cp <= 2143) {
-                  return UnicodeBlock::MANDAIC;
-                } else {
-                  return UnicodeBlock::ARABIC_EXTENDED_A;
-                }
-              }
-            }
-          }
-        } else {
-          if (cp < 3328) {
-            if (cp < 2816) {
-              if (cp < 2560) {
-                if (cp <= 2431) {
-                  return UnicodeBlock::DEVANAGARI;
-                } else {
-                  return UnicodeBlock::BENGALI;
-                }
-              } else {
-                if (cp <= 2687) {
-                  return UnicodeBlock::GURMUKHI;
-                } else {
-                  return UnicodeBlock::GUJARATI;
-                }
-              }
-            } else {
-              if (cp < 3072) {
-                if (cp <= 2943) {
-                  return UnicodeBlock::ORIYA;
-                } else {
-                  return UnicodeBlock::TAMIL;
-                }
-              } else {
-                if (cp <= 3199) {
-                  return UnicodeBlock::TELUGU;
-                } else {
-                  return UnicodeBlock::KANNADA;
-                }
-              }
-            }
-          } else {
-            if (cp < 3840) {
-              if (cp < 3584) {
-                if (cp <= 3455) {
-                  return UnicodeBlock::MALAYALAM;
-                } else {
-                  return UnicodeBlock::SINHALA;
-                }
-              } else {
-                if (cp <= 3711) {
-                  return UnicodeBlock::THAI;
-                } else {
-                  return UnicodeBlock::LAO;
-                }
-              }
-            } else {
-              if (cp < 4256) {
-                if (cp <= 4095) {
-                  return UnicodeBlock::TIBETAN;
-                } else {
-                  return UnicodeBlock::MYANMAR;
-                }
-              } else {
-                if (cp <= 4351) {
-                  return UnicodeBlock::GEORGIAN;
-                } else {
-                  return UnicodeBlock::HANGUL_JAMO;
-                }
-              }
-            }
-          }
-        }
-      } else {
-        if (cp < 6624) {
-          if (cp < 5952) {
-            if (cp < 5760) {
-              if (cp < 5024) {
-                if (cp <= 4991) {
-                  return UnicodeBlock::ETHIOPIC;
-                } else {
-                  return UnicodeBlock::ETHIOPIC_SUPPLEMENT;
-                }
-              } else {
-                if (cp <= 5119) {
-                  return UnicodeBlock::CHEROKEE;
-                } else {
-                  return UnicodeBlock::UNIFIED_CANADIAN_ABORIGINAL_SYLLABICS;
-                }
-              }
-            } else {
-              if (cp < 5888) {
-                if (cp <= 5791) {
-                  return UnicodeBlock::OGHAM;
-                } else {
-                  return UnicodeBlock::RUNIC;
-                }
-              } else {
-                if (cp <= 5919) {
-                  return UnicodeBlock::TAGALOG;
-                } else {
-                  return UnicodeBlock::HANUNOO;
-                }
-              }
-            }
-          } else {
-            if (cp < 6320) {
-              if (cp < 6016) {
-                if (cp <= 5983) {
-                  return UnicodeBlock::BUHID;
-                } else {
-                  return UnicodeBlock::TAGBANWA;
-                }
-              } else {
-                if (cp <= 6143) {
-                  return UnicodeBlock::KHMER;
-                } else {
-                  return UnicodeBlock::MONGOLIAN;
-                }
-              }
-            } else {
-              if (cp < 6480) {
-                if (cp <= 6399) {
-                  return UnicodeBlock::UNIFIED_CANADIAN_ABORIGINAL_SYLLABICS_EXTENDED;
-                } else {
-                  return UnicodeBlock::LIMBU;
-                }
-              } else {
-                if (cp <= 6527) {
-                  return UnicodeBlock::TAI_LE;
-                } else {
-                  return UnicodeBlock::NEW_TAI_LUE;
-                }
-              }
-            }
-          }
-        } else {
-          if (cp < 7248) {
-            if (cp < 6912) {
-              if (cp < 6688) {
-                if (cp <= 6655) {
-                  return UnicodeBlock::KHMER_SYMBOLS;
-                } else {
-                  return UnicodeBlock::BUGINESE;
-                }
-              } else {
-                if (cp <= 6831) {
-                  return UnicodeBlock::TAI_THAM;
-                } else {
-                  return UnicodeBlock::COMBINING_DIACRITICAL_MARKS_EXTENDED;
-                }
-              }
-            } else {
-              if (cp < 7104) {
-                if (cp <= 7039) {
-                  return UnicodeBlock::BALINESE;
-                } else {
-                  return UnicodeBlock::SUNDANESE;
-                }
-              } else {
-                if (cp <= 7167) {
-                  return UnicodeBlock::BATAK;
-                } else {
-                  return UnicodeBlock::LEPCHA;
-                }
-              }
-            }
-          } else {
-            if (cp < 7552) {
-              if (cp < 7376) {
-                if (cp <= 7295) {
-                  return UnicodeBlock::OL_CHIKI;
-                } else {
-                  return UnicodeBlock::SUNDANESE_SUPPLEMENT;
-                }
-              } else {
-                if (cp <= 7423) {
-                  return UnicodeBlock::VEDIC_EXTENSIONS;
-                } else {
-                  return UnicodeBlock::PHONETIC_EXTENSIONS;
-                }
-              }
-            } else {
-              if (cp < 7680) {
-                if (cp <= 7615) {
-                  return UnicodeBlock::PHONETIC_EXTENSIONS_SUPPLEMENT;
-                } else {
-                  return UnicodeBlock::COMBINING_DIACRITICAL_MARKS_SUPPLEMENT;
-                }
-              } else {
-                if (cp <= 7935) {
-                  return UnicodeBlock::LATIN_EXTENDED_ADDITIONAL;
-                } else {
-                  return UnicodeBlock::GREEK_EXTENDED;
-                }
-              }
-            }
-          }
-        }
-      }
-    } else {
-      if (cp < 11904) {
-        if (cp < 9984) {
-          if (cp < 8960) {
-            if (cp < 8448) {
-              if (cp < 8352) {
-                if (cp <= 8303) {
-                  return UnicodeBlock::GENERAL_PUNCTUATION;
-                } else {
-                  return UnicodeBlock::SUPERSCRIPTS_AND_SUBSCRIPTS;
-                }
-              } else {
-                if (cp <= 8399) {
-                  return UnicodeBlock::CURRENCY_SYMBOLS;
-                } else {
-                  return UnicodeBlock::COMBINING_DIACRITICAL_MARKS_FOR_SYMBOLS;
-                }
-              }
-            } else {
-              if (cp < 8592) {
-                if (cp <= 8527) {
-                  return UnicodeBlock::LETTERLIKE_SYMBOLS;
-                } else {
-                  return UnicodeBlock::NUMBER_FORMS;
-                }
-              } else {
-                if (cp <= 8703) {
-                  return UnicodeBlock::ARROWS;
-                } else {
-                  return UnicodeBlock::MATHEMATICAL_OPERATORS;
-                }
-              }
-            }
-          } else {
-            if (cp < 9472) {
-              if (cp < 9280) {
-                if (cp <= 9215) {
-                  return UnicodeBlock::MISCELLANEOUS_TECHNICAL;
-                } else {
-                  return UnicodeBlock::CONTROL_PICTURES;
-                }
-              } else {
-                if (cp <= 9311) {
-                  return UnicodeBlock::OPTICAL_CHARACTER_RECOGNITION;
-                } else {
-                  return UnicodeBlock::ENCLOSED_ALPHANUMERICS;
-                }
-              }
-            } else {
-              if (cp < 9632) {
-                if (cp <= 9599) {
-                  return UnicodeBlock::BOX_DRAWING;
-                } else {
-                  return UnicodeBlock::BLOCK_ELEMENTS;
-                }
-              } else {
-                if (cp <= 9727) {
-                  return UnicodeBlock::GEOMETRIC_SHAPES;
-                } else {
-                  return UnicodeBlock::MISCELLANEOUS_SYMBOLS;
-                }
-              }
-            }
-          }
-        } else {
-          if (cp < 11264) {
-            if (cp < 10496) {
-              if (cp < 10224) {
-                if (cp <= 10175) {
-                  return UnicodeBlock::DINGBATS;
-                } else {
-                  return UnicodeBlock::MISCELLANEOUS_MATHEMATICAL_SYMBOLS_A;
-                }
-              } else {
-                if (cp <= 10239) {
-                  return UnicodeBlock::SUPPLEMENTAL_ARROWS_A;
-                } else {
-                  return UnicodeBlock::BRAILLE_PATTERNS;
-                }
-              }
-            } else {
-              if (cp < 10752) {
-                if (cp <= 10623) {
-                  return UnicodeBlock::SUPPLEMENTAL_ARROWS_B;
-                } else {
-                  return UnicodeBlock::MISCELLANEOUS_MATHEMATICAL_SYMBOLS_B;
-                }
-              } else {
-                if (cp <= 11007) {
-                  return UnicodeBlock::SUPPLEMENTAL_MATHEMATICAL_OPERATORS;
-                } else {
-                  return UnicodeBlock::MISCELLANEOUS_SYMBOLS_AND_ARROWS;
-                }
-              }
-            }
-          } else {
-            if (cp < 11568) {
-              if (cp < 11392) {
-                if (cp <= 11359) {
-                  return UnicodeBlock::GLAGOLITIC;
-                } else {
-                  return UnicodeBlock::LATIN_EXTENDED_C;
-                }
-              } else {
-                if (cp <= 11519) {
-                  return UnicodeBlock::COPTIC;
-                } else {
-                  return UnicodeBlock::GEORGIAN_SUPPLEMENT;
-                }
-              }
-            } else {
-              if (cp < 11744) {
-                if (cp <= 11647) {
-                  return UnicodeBlock::TIFINAGH;
-                } else {
-                  return UnicodeBlock::ETHIOPIC_EXTENDED;
-                }
-              } else {
-                if (cp <= 11775) {
-                  return UnicodeBlock::CYRILLIC_EXTENDED_A;
-                } else {
-                  return UnicodeBlock::SUPPLEMENTAL_PUNCTUATION;
-                }
-              }
-            }
-          }
-        }
-      } else {
-        if (cp < 19968) {
-          if (cp < 12688) {
-            if (cp < 12352) {
-              if (cp < 12272) {
-                if (cp <= 12031) {
-                  return UnicodeBlock::CJK_RADICALS_SUPPLEMENT;
-                } else {
-                  return UnicodeBlock::KANGXI_RADICALS;
-                }
-              } else {
-                if (cp <= 12287) {
-                  return UnicodeBlock::IDEOGRAPHIC_DESCRIPTION_CHARACTERS;
-                } else {
-                  return UnicodeBlock::CJK_SYMBOLS_AND_PUNCTUATION;
-                }
-              }
-            } else {
-              if (cp < 12544) {
-                if (cp <= 12447) {
-                  return UnicodeBlock::HIRAGANA;
-                } else {
-                  return UnicodeBlock::KATAKANA;
-                }
-              } else {
-                if (cp <= 12591) {
-                  return UnicodeBlock::BOPOMOFO;
-                } else {
-                  return UnicodeBlock::HANGUL_COMPATIBILITY_JAMO;
-                }
-              }
-            }
-          } else {
-            if (cp < 12800) {
-              if (cp < 12736) {
-                if (cp <= 12703) {
-                  return UnicodeBlock::KANBUN;
-                } else {
-                  return UnicodeBlock::BOPOMOFO_EXTENDED;
-                }
-              } else {
-                if (cp <= 12783) {
-                  return UnicodeBlock::CJK_STROKES;
-                } else {
-                  return UnicodeBlock::KATAKANA_PHONETIC_EXTENSIONS;
-                }
-              }
-            } else {
-              if (cp < 13312) {
-                if (cp <= 13055) {
-                  return UnicodeBlock::ENCLOSED_CJK_LETTERS_AND_MONTHS;
-                } else {
-                  return UnicodeBlock::CJK_COMPATIBILITY;
-                }
-              } else {
-                if (cp <= 19903) {
-                  return UnicodeBlock::CJK_UNIFIED_IDEOGRAPHS_EXTENSION_A;
-                } else {
-                  return UnicodeBlock::YIJING_HEXAGRAM_SYMBOLS;
-                }
-              }
-            }
-          }
-        } else {
-          if (cp < 42784) {
-            if (cp < 42240) {
-              if (cp < 42128) {
-                if (cp <= 40959) {
-                  return UnicodeBlock::CJK_UNIFIED_IDEOGRAPHS;
-                } else {
-                  return UnicodeBlock::YI_SYLLABLES;
-                }
-              } else {
-                if (cp <= 42191) {
-                  return UnicodeBlock::YI_RADICALS;
-                } else {
-                  return UnicodeBlock::LISU;
-                }
-              }
-            } else {
-              if (cp < 42656) {
-                if (cp <= 42559) {
-                  return UnicodeBlock::VAI;
-                } else {
-                  return UnicodeBlock::CYRILLIC_EXTENDED_B;
-                }
-              } else {
-                if (cp <= 42751) {
-                  return UnicodeBlock::BAMUM;
-                } else {
-                  return UnicodeBlock::MODIFIER_TONE_LETTERS;
-                }
-              }
-            }
-          } else {
-            if (cp < 43136) {
-              if (cp < 43056) {
-                if (cp <= 43007) {
-                  return UnicodeBlock::LATIN_EXTENDED_D;
-                } else {
-                  return UnicodeBlock::SYLOTI_NAGRI;
-                }
-              } else {
-                if (cp <= 43071) {
-                  return UnicodeBlock::COMMON_INDIC_NUMBER_FORMS;
-                } else {
-                  return UnicodeBlock::PHAGS_PA;
-                }
-              }
-            } else {
-              if (cp < 43264) {
-                if (cp <= 43231) {
-                  return UnicodeBlock::SAURASHTRA;
-                } else {
-                  return UnicodeBlock::DEVANAGARI_EXTENDED;
-                }
-              } else {
-                if (cp <= 43311) {
-                  return UnicodeBlock::KAYAH_LI;
-                } else if (cp <= 43359) {
-                  return UnicodeBlock::REJANG;
-                } else {
-                  return UnicodeBlock::HANGUL_JAMO_EXTENDED_A;
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-  } else {
-    if (cp < 68608) {
-      if (cp < 66000) {
-        if (cp < 63744) {
-          if (cp < 43888) {
-            if (cp < 43648) {
-              if (cp < 43520) {
-                if (cp <= 43487) {
-                  return UnicodeBlock::JAVANESE;
-                } else {
-                  return UnicodeBlock::MYANMAR_EXTENDED_B;
-                }
-              } else {
-                if (cp <= 43615) {
-                  return UnicodeBlock::CHAM;
-                } else {
-                  return UnicodeBlock::MYANMAR_EXTENDED_A;
-                }
-              }
-            } else {
-              if (cp < 43776) {
-                if (cp <= 43743) {
-                  return UnicodeBlock::TAI_VIET;
-                } else {
-                  return UnicodeBlock::MEETEI_MAYEK_EXTENSIONS;
-                }
-              } else {
-                if (cp <= 43823) {
-                  return UnicodeBlock::ETHIOPIC_EXTENDED_A;
-                } else {
-                  return UnicodeBlock::LATIN_EXTENDED_E;
-                }
-              }
-            }
-          } else {
-            if (cp < 55296) {
-              if (cp < 44032) {
-                if (cp <= 44031) {
-                  return UnicodeBlock::CHEROKEE_SUPPLEMENT;
-                } else {
-                  return UnicodeBlock::MEETEI_MAYEK;
-                }
-              } else {
-                if (cp <= 55215) {
-                  return UnicodeBlock::HANGUL_SYLLABLES;
-                } else {
-                  return UnicodeBlock::HANGUL_JAMO_EXTENDED_B;
-                }
-              }
-            } else {
-              if (cp < 56320) {
-                if (cp <= 56191) {
-                  return UnicodeBlock::HIGH_SURROGATES;
-                } else {
-                  return UnicodeBlock::HIGH_PRIVATE_USE_SURROGATES;
-                }
-              } else {
-                if (cp <= 57343) {
-                  return UnicodeBlock::LOW_SURROGATES;
-                } else {
-                  return UnicodeBlock::PRIVATE_USE_AREA;
-                }
-              }
-            }
-          }
-        } else {
-          if (cp < 65136) {
-            if (cp < 65040) {
-              if (cp < 64336) {
-                if (cp <= 64255) {
-                  return UnicodeBlock::CJK_COMPATIBILITY_IDEOGRAPHS;
-                } else {
-                  return UnicodeBlock::ALPHABETIC_PRESENTATION_FORMS;
-                }
-              } else {
-                if (cp <= 65023) {
-                  return UnicodeBlock::ARABIC_PRESENTATION_FORMS_A;
-                } else {
-                  return UnicodeBlock::VARIATION_SELECTORS;
-                }
-              }
-            } else {
-              if (cp < 65072) {
-                if (cp <= 65055) {
-                  return UnicodeBlock::VERTICAL_FORMS;
-                } else {
-                  return UnicodeBlock::COMBINING_HALF_MARKS;
-                }
-              } else {
-                if (cp <= 65103) {
-                  return UnicodeBlock::CJK_COMPATIBILITY_FORMS;
-                } else {
-                  return UnicodeBlock::SMALL_FORM_VARIANTS;
-                }
-              }
-            }
-          } else {
-            if (cp < 65664) {
-              if (cp < 65520) {
-                if (cp <= 65279) {
-                  return UnicodeBlock::ARABIC_PRESENTATION_FORMS_B;
-                } else {
-                  return UnicodeBlock::HALFWIDTH_AND_FULLWIDTH_FORMS;
-                }
-              } else {
-                if (cp <= 65535) {
-                  return UnicodeBlock::SPECIALS;
-                } else {
-                  return UnicodeBlock::LINEAR_B_SYLLABARY;
-                }
-              }
-            } else {
-              if (cp < 65856) {
-                if (cp <= 65791) {
-                  return UnicodeBlock::LINEAR_B_IDEOGRAMS;
-                } else {
-                  return UnicodeBlock::AEGEAN_NUMBERS;
-                }
-              } else {
-                if (cp <= 65935) {
-                  return UnicodeBlock::ANCIENT_GREEK_NUMBERS;
-                } else {
-                  return UnicodeBlock::ANCIENT_SYMBOLS;
-                }
-              }
-            }
-          }
-        }
-      } else {
-        if (cp < 67648) {
-          if (cp < 66464) {
-            if (cp < 66304) {
-              if (cp < 66208) {
-                if (cp <= 66047) {
-                  return UnicodeBlock::PHAISTOS_DISC;
-                } else {
-                  return UnicodeBlock::LYCIAN;
-                }
-              } else {
-                if (cp <= 66271) {
-                  return UnicodeBlock::CARIAN;
-                } else {
-                  return UnicodeBlock::COPTIC_EPACT_NUMBERS;
-                }
-              }
-            } else {
-              if (cp < 66384) {
-                if (cp <= 66351) {
-                  return UnicodeBlock::OLD_ITALIC;
-                } else {
-                  return UnicodeBlock::GOTHIC;
-                }
-              } else {
-                if (cp <= 66431) {
-                  return UnicodeBlock::OLD_PERMIC;
-                } else {
-                  return UnicodeBlock::UGARITIC;
-                }
-              }
-            }
-          } else {
-            if (cp < 66816) {
-              if (cp < 66640) {
-                if (cp <= 66527) {
-                  return UnicodeBlock::OLD_PERSIAN;
-                } else {
-                  return UnicodeBlock::DESERET;
-                }
-              } else {
-                if (cp <= 66687) {
-                  return UnicodeBlock::SHAVIAN;
-                } else {
-                  return UnicodeBlock::OSMANYA;
-                }
-              }
-            } else {
-              if (cp < 67072) {
-                if (cp <= 66863) {
-                  return UnicodeBlock::ELBASAN;
-                } else {
-                  return UnicodeBlock::CAUCASIAN_ALBANIAN;
-                }
-              } else {
-                if (cp <= 67455) {
-                  return UnicodeBlock::LINEAR_A;
-                } else {
-                  return UnicodeBlock::CYPRIOT_SYLLABARY;
-                }
-              }
-            }
-          }
-        } else {
-          if (cp < 68096) {
-            if (cp < 67840) {
-              if (cp < 67712) {
-                if (cp <= 67679) {
-                  return UnicodeBlock::IMPERIAL_ARAMAIC;
-                } else {
-                  return UnicodeBlock::PALMYRENE;
-                }
-              } else {
-                if (cp <= 67759) {
-                  return UnicodeBlock::NABATAEAN;
-                } else {
-                  return UnicodeBlock::HATRAN;
-                }
-              }
-            } else {
-              if (cp < 67968) {
-                if (cp <= 67871) {
-                  return UnicodeBlock::PHOENICIAN;
-                } else {
-                  return UnicodeBlock::LYDIAN;
-                }
-              } else {
-                if (cp <= 67999) {
-                  return UnicodeBlock::MEROITIC_HIEROGLYPHS;
-                } else {
-                  return UnicodeBlock::MEROITIC_CURSIVE;
-                }
-              }
-            }
-          } else {
-            if (cp < 68352) {
-              if (cp < 68224) {
-                if (cp <= 68191) {
-                  return UnicodeBlock::KHAROSHTHI;
-                } else {
-                  return UnicodeBlock::OLD_SOUTH_ARABIAN;
-                }
-              } else {
-                if (cp <= 68255) {
-                  return UnicodeBlock::OLD_NORTH_ARABIAN;
-                } else {
-                  return UnicodeBlock::MANICHAEAN;
-                }
-              }
-            } else {
-              if (cp < 68448) {
-                if (cp <= 68415) {
-                  return UnicodeBlock::AVESTAN;
-                } else {
-                  return UnicodeBlock::INSCRIPTIONAL_PARTHIAN;
-                }
-              } else {
-                if (cp <= 68479) {
-                  return UnicodeBlock::INSCRIPTIONAL_PAHLAVI;
-                } else {
-                  return UnicodeBlock::PSALTER_PAHLAVI;
-                }
-              }
-            }
-          }
-        }
-      }
-    } else {
-      if (cp < 113664) {
-        if (cp < 71168) {
-          if (cp < 70016) {
-            if (cp < 69760) {
-              if (cp < 69216) {
-                if (cp <= 68687) {
-                  return UnicodeBlock::OLD_TURKIC;
-                } else {
-                  return UnicodeBlock::OLD_HUNGARIAN;
-                }
-              } else {
-                if (cp <= 69247) {
-                  return UnicodeBlock::RUMI_NUMERAL_SYMBOLS;
-                } else {
-                  return UnicodeBlock::BRAHMI;
-                }
-              }
-            } else {
-              if (cp < 69888) {
-                if (cp <= 69839) {
-                  return UnicodeBlock::KAITHI;
-                } else {
-                  return UnicodeBlock::SORA_SOMPENG;
-                }
-              } else {
-                if (cp <= 69967) {
-                  return UnicodeBlock::CHAKMA;
-                } else {
-                  return UnicodeBlock::MAHAJANI;
-                }
-              }
-            }
-          } else {
-            if (cp < 70320) {
-              if (cp < 70144) {
-                if (cp <= 70111) {
-                  return UnicodeBlock::SHARADA;
-                } else {
-                  return UnicodeBlock::SINHALA_ARCHAIC_NUMBERS;
-                }
-              } else {
-                if (cp <= 70223) {
-                  return UnicodeBlock::KHOJKI;
-                } else {
-                  return UnicodeBlock::MULTANI;
-                }
-              }
-            } else {
-              if (cp < 70784) {
-                if (cp <= 70399) {
-                  return UnicodeBlock::KHUDAWADI;
-                } else {
-                  return UnicodeBlock::GRANTHA;
-                }
-              } else {
-                if (cp <= 70879) {
-                  return UnicodeBlock::TIRHUTA;
-                } else {
-                  return UnicodeBlock::SIDDHAM;
-                }
-              }
-            }
-          }
-        } else {
-          if (cp < 77824) {
-            if (cp < 72384) {
-              if (cp < 71424) {
-                if (cp <= 71263) {
-                  return UnicodeBlock::MODI;
-                } else {
-                  return UnicodeBlock::TAKRI;
-                }
-              } else {
-                if (cp <= 71487) {
-                  return UnicodeBlock::AHOM;
-                } else {
-                  return UnicodeBlock::WARANG_CITI;
-                }
-              }
-            } else {
-              if (cp < 74752) {
-                if (cp <= 72447) {
-                  return UnicodeBlock::PAU_CIN_HAU;
-                } else {
-                  return UnicodeBlock::CUNEIFORM;
-                }
-              } else {
-                if (cp <= 74879) {
-                  return UnicodeBlock::CUNEIFORM_NUMBERS_AND_PUNCTUATION;
-                } else {
-                  return UnicodeBlock::EARLY_DYNASTIC_CUNEIFORM;
-                }
-              }
-            }
-          } else {
-            if (cp < 92880) {
-              if (cp < 92160) {
-                if (cp <= 78895) {
-                  return UnicodeBlock::EGYPTIAN_HIEROGLYPHS;
-                } else {
-                  return UnicodeBlock::ANATOLIAN_HIEROGLYPHS;
-                }
-              } else {
-                if (cp <= 92735) {
-                  return UnicodeBlock::BAMUM_SUPPLEMENT;
-                } else {
-                  return UnicodeBlock::MRO;
-                }
-              }
-            } else {
-              if (cp < 93952) {
-                if (cp <= 92927) {
-                  return UnicodeBlock::BASSA_VAH;
-                } else {
-                  return UnicodeBlock::PAHAWH_HMONG;
-                }
-              } else {
-                if (cp <= 94111) {
-                  return UnicodeBlock::MIAO;
-                } else {
-                  return UnicodeBlock::KANA_SUPPLEMENT;
-                }
-              }
-            }
-          }
-        }
-      } else {
-        if (cp < 127744) {
-          if (cp < 120832) {
-            if (cp < 119296) {
-              if (cp < 118784) {
-                if (cp <= 113823) {
-                  return UnicodeBlock::DUPLOYAN;
-                } else {
-                  return UnicodeBlock::SHORTHAND_FORMAT_CONTROLS;
-                }
-              } else {
-                if (cp <= 119039) {
-                  return UnicodeBlock::BYZANTINE_MUSICAL_SYMBOLS;
-                } else {
-                  return UnicodeBlock::MUSICAL_SYMBOLS;
-                }
-              }
-            } else {
-              if (cp < 119648) {
-                if (cp <= 119375) {
-                  return UnicodeBlock::ANCIENT_GREEK_MUSICAL_NOTATION;
-                } else {
-                  return UnicodeBlock::TAI_XUAN_JING_SYMBOLS;
-                }
-              } else {
-                if (cp <= 119679) {
-                  return UnicodeBlock::COUNTING_ROD_NUMERALS;
-                } else {
-                  return UnicodeBlock::MATHEMATICAL_ALPHANUMERIC_SYMBOLS;
-                }
-              }
-            }
-          } else {
-            if (cp < 127024) {
-              if (cp < 126464) {
-                if (cp <= 121519) {
-                  return UnicodeBlock::SUTTON_SIGNWRITING;
-                } else {
-                  return UnicodeBlock::MENDE_KIKAKUI;
-                }
-              } else {
-                if (cp <= 126719) {
-                  return UnicodeBlock::ARABIC_MATHEMATICAL_ALPHABETIC_SYMBOLS;
-                } else {
-                  return UnicodeBlock::MAHJONG_TILES;
-                }
-              }
-            } else {
-              if (cp < 127232) {
-                if (cp <= 127135) {
-                  return UnicodeBlock::DOMINO_TILES;
-                } else {
-                  return UnicodeBlock::PLAYING_CARDS;
-                }
-              } else {
-                if (cp <= 127487) {
-                  return UnicodeBlock::ENCLOSED_ALPHANUMERIC_SUPPLEMENT;
-                } else {
-                  return UnicodeBlock::ENCLOSED_IDEOGRAPHIC_SUPPLEMENT;
-                }
-              }
-            }
-          }
-        } else {
-          if (cp < 131072) {
-            if (cp < 128768) {
-              if (cp < 128592) {
-                if (cp <= 128511) {
-                  return UnicodeBlock::MISCELLANEOUS_SYMBOLS_AND_PICTOGRAPHS;
-                } else {
-                  return UnicodeBlock::EMOTICONS;
-                }
-              } else {
-                if (cp <= 128639) {
-                  return UnicodeBlock::ORNAMENTAL_DINGBATS;
-                } else {
-                  return UnicodeBlock::TRANSPORT_AND_MAP_SYMBOLS;
-                }
-              }
-            } else {
-              if (cp < 129024) {
-                if (cp <= 128895) {
-                  return UnicodeBlock::ALCHEMICAL_SYMBOLS;
-                } else {
-                  return UnicodeBlock::GEOMETRIC_SHAPES_EXTENDED;
-                }
-              } else {
-                if (cp <= 129279) {
-                  return UnicodeBlock::SUPPLEMENTAL_ARROWS_C;
-                } else {
-                  return UnicodeBlock::SUPPLEMENTAL_SYMBOLS_AND_PICTOGRAPHS;
-                }
-              }
-            }
-          } else {
-            if (cp < 194560) {
-              if (cp < 177984) {
-                if (cp <= 173791) {
-                  return UnicodeBlock::CJK_UNIFIED_IDEOGRAPHS_EXTENSION_B;
-                } else {
-                  return UnicodeBlock::CJK_UNIFIED_IDEOGRAPHS_EXTENSION_C;
-                }
-              } else {
-                if (cp <= 178207) {
-                  return UnicodeBlock::CJK_UNIFIED_IDEOGRAPHS_EXTENSION_D;
-                } else {
-                  return UnicodeBlock::CJK_UNIFIED_IDEOGRAPHS_EXTENSION_E;
-                }
-              }
-            } else {
-              if (cp < 917760) {
-                if (cp <= 195103) {
-                  return UnicodeBlock::CJK_COMPATIBILITY_IDEOGRAPHS_SUPPLEMENT;
-                } else {
-                  return UnicodeBlock::TAGS;
-                }
-              } else {
-                if (cp <= 917999) {
-                  return UnicodeBlock::VARIATION_SELECTORS_SUPPLEMENT;
-                } else if (cp <= 1048575) {
-                  return UnicodeBlock::SUPPLEMENTARY_PRIVATE_USE_AREA_A;
-                } else {
-                  return UnicodeBlock::SUPPLEMENTARY_PRIVATE_USE_AREA_B;
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-  }
-  return UnicodeBlock::UNKNOWN;
+  return (UnicodeBlock) lookupCodePoint(codePoint).block;
 }
 
-
 std::string stringOfUnicodeBlock(UnicodeBlock block) {
   switch(block) {
     case UnicodeBlock::AEGEAN_NUMBERS : return "AEGEAN_NUMBERS";
@@ -1,13 +1,18 @@
+#pragma once
 #include <string>
 #include "libunicode/UnicodeBlock.h"
+#include "libunicode/code_point_table.h"
 
 namespace relevanced {
 namespace libunicode {
 
-uint32_t normalizeCodePoint(uint32_t codePoint, UnicodeBlock block);
-uint32_t normalizeCodePoint(uint32_t codePoint);
-bool isLetterPoint(uint32_t cp, UnicodeBlock uBlock);
-bool isLetterPoint(uint32_t cp);
+inline uint32_t normalizeCodePoint(uint32_t codePoint) {
+  return codePoint + lookupCodePoint(codePoint).lowercaseOffset;
+}
+
+inline bool isLetterPoint(uint32_t cp) {
+  return lookupCodePoint(cp).isLetter;
+}
 
 }
 }
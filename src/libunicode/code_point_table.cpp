@@ -0,0 +1,4256 @@
+// generated by scripts/extract_unicode_blocks.py; do not edit.
+
+#include <cstdint>
+#include "libunicode/UnicodeBlock.h"
+#include "libunicode/code_point_table.h"
+
+namespace relevanced {
+namespace libunicode {
+
+static_assert((uint16_t) UnicodeBlock::UNKNOWN == 262,
+  "UnicodeBlock changed; regenerate the code point table");
+static_assert(kCodePointPageBits == 7,
+  "page size changed; regenerate the code point table");
+
+const uint16_t kCodePointPageIndex[8704] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 10, 11, 11, 12, 13,
+  14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 28,
+  29, 30, 31, 31, 32, 32, 32, 33, 34, 34, 34, 34, 34, 35, 36, 37,
+  38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 50, 51, 51,
+  52, 53, 54, 55, 56, 56, 57, 57, 58, 59, 60, 61, 62, 62, 63, 64,
+  65, 65, 66, 67, 68, 68, 69, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+  78, 79, 80, 81, 82, 82, 83, 83, 84, 84, 84, 84, 84, 84, 84, 84,
+  84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+  84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+  84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 85, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 89, 89, 90, 91, 92, 93,
+  94, 95, 96, 97, 98, 99, 100, 101, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 103,
+  104, 104, 104, 104, 104, 104, 104, 105, 106, 106, 106, 106, 106, 106, 106, 106,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 108, 108, 108, 108, 109, 110, 110, 110, 110, 110, 111, 112, 113, 114,
+  115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 119, 126, 126, 126, 119,
+  127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 119, 119, 137, 119, 119, 119,
+  138, 139, 140, 141, 142, 143, 144, 119, 119, 145, 119, 146, 147, 148, 149, 119,
+  119, 150, 119, 119, 119, 151, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  152, 152, 152, 152, 152, 152, 152, 152, 153, 154, 155, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  156, 156, 156, 156, 156, 156, 156, 156, 157, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 158, 158, 158, 158, 158, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  159, 159, 159, 159, 160, 161, 162, 163, 119, 119, 119, 119, 119, 119, 164, 165,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  166, 166, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 167, 168, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  169, 169, 170, 170, 171, 119, 172, 119, 173, 173, 173, 173, 173, 173, 173, 173,
+  174, 174, 174, 174, 174, 175, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  176, 177, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 178, 178, 119, 119,
+  179, 180, 181, 181, 182, 182, 183, 183, 183, 183, 183, 183, 184, 185, 186, 187,
+  188, 188, 189, 189, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190,
+  190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 191, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192,
+  192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 193, 194,
+  195, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+  196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+  196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 197, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  198, 198, 198, 198, 199, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  200, 119, 201, 202, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 203,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+  204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204, 204,
+};
+
+const CodePointInfo kCodePointPages[205][128] = {
+  {
+    {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0},
+    {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0},
+    {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0},
+    {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0},
+    {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0},
+    {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0},
+    {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0},
+    {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0},
+    {20, 0, 0}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1},
+    {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1},
+    {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 32, 1},
+    {20, 32, 1}, {20, 32, 1}, {20, 32, 1}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0},
+    {20, 0, 0}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1},
+    {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1},
+    {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 1},
+    {20, 0, 1}, {20, 0, 1}, {20, 0, 1}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0}, {20, 0, 0},
+  },
+  {
+    {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0},
+    {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0},
+    {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0},
+    {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0},
+    {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0},
+    {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0},
+    {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0},
+    {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0}, {138, 0, 0},
+    {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1},
+    {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1},
+    {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 0, 0},
+    {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 32, 1}, {138, 0, 1}, {138, 0, 1},
+    {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1},
+    {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1},
+    {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 0},
+    {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1}, {138, 0, 1},
+  },
+  {
+    {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1},
+    {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1},
+    {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1},
+    {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1},
+    {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1},
+    {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1},
+    {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1}, {133, 1, 1}, {133, 0, 1},
+    {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1},
+    {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1},
+    {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1},
+    {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1},
+    {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1},
+    {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1},
+    {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1},
+    {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1},
+    {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1}, {133, 0, 1},
+  },
+  {
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+  },
+  {
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1}, {134, 0, 1},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+  },
+  {
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0}, {112, 0, 0},
+    {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0},
+    {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0},
+    {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0},
+    {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0},
+    {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0},
+    {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0},
+    {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0},
+    {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0},
+    {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0},
+    {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0}, {218, 0, 0},
+  },
+  {
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0}, {52, 0, 0},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+  },
+  {
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+    {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1}, {97, 0, 1},
+  },
+  {
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+    {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1}, {66, 0, 1},
+  },
+  {
+    {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1},
+    {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1},
+    {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1},
+    {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1},
+    {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1},
+    {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1}, {69, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+  },
+  {
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1}, {14, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+    {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1}, {108, 0, 1},
+  },
+  {
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+    {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1}, {8, 0, 1},
+  },
+  {
+    {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1},
+    {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1},
+    {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1},
+    {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1},
+    {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1},
+    {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1},
+    {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1},
+    {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1},
+    {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1},
+    {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1}, {233, 0, 1},
+    {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1},
+    {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1},
+    {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1},
+    {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1},
+    {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1},
+    {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1}, {13, 0, 1},
+  },
+  {
+    {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1},
+    {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1},
+    {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1},
+    {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1},
+    {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1},
+    {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1},
+    {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1},
+    {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1}, {244, 0, 1},
+    {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1},
+    {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1},
+    {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1},
+    {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1},
+    {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1},
+    {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1},
+    {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1},
+    {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1}, {177, 0, 1},
+  },
+  {
+    {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1},
+    {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1},
+    {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1},
+    {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1},
+    {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1},
+    {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1},
+    {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1},
+    {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1}, {208, 0, 1},
+    {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1},
+    {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1},
+    {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1},
+    {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1}, {152, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+    {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1}, {9, 0, 1},
+  },
+  {
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+    {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1}, {71, 0, 1},
+  },
+  {
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+    {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1}, {23, 0, 1},
+  },
+  {
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+    {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1}, {99, 0, 1},
+  },
+  {
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+    {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1}, {98, 0, 1},
+  },
+  {
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+    {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1}, {191, 0, 1},
+  },
+  {
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+    {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1}, {242, 0, 1},
+  },
+  {
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+    {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1}, {243, 0, 1},
+  },
+  {
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+    {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1}, {122, 0, 1},
+  },
+  {
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+    {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1}, {151, 0, 1},
+  },
+  {
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+    {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1}, {214, 0, 1},
+  },
+  {
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+    {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1}, {245, 0, 1},
+  },
+  {
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+    {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1}, {131, 0, 1},
+  },
+  {
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+    {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1}, {246, 0, 1},
+  },
+  {
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+  },
+  {
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1}, {174, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+    {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1}, {91, 0, 1},
+  },
+  {
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+    {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1}, {102, 0, 1},
+  },
+  {
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+    {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1}, {84, 0, 1},
+  },
+  {
+    {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1},
+    {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1},
+    {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1},
+    {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1}, {87, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+    {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1}, {50, 0, 1},
+  },
+  {
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+    {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1}, {251, 0, 1},
+  },
+  {
+    {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1},
+    {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1},
+    {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1},
+    {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1}, {181, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+    {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1}, {207, 0, 1},
+  },
+  {
+    {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1},
+    {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1},
+    {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1},
+    {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1}, {234, 0, 1},
+    {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1},
+    {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1},
+    {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1},
+    {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1}, {106, 0, 1},
+    {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1},
+    {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1},
+    {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1},
+    {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1}, {31, 0, 1},
+    {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1},
+    {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1},
+    {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1},
+    {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1}, {235, 0, 1},
+  },
+  {
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+    {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1}, {127, 0, 1},
+  },
+  {
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+  },
+  {
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1}, {170, 0, 1},
+    {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1},
+    {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1},
+    {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1},
+    {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1},
+    {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1},
+    {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1},
+    {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1},
+    {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1},
+    {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1},
+    {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1}, {252, 0, 1},
+  },
+  {
+    {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1},
+    {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1},
+    {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1},
+    {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1},
+    {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1},
+    {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1},
+    {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1},
+    {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1},
+    {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1},
+    {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1}, {141, 0, 1},
+    {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1},
+    {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1},
+    {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1},
+    {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1},
+    {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1},
+    {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1}, {237, 0, 1},
+  },
+  {
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1}, {179, 0, 1},
+    {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1},
+    {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1},
+    {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1},
+    {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1}, {128, 0, 1},
+  },
+  {
+    {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1},
+    {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1},
+    {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1},
+    {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1}, {30, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+  },
+  {
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1}, {238, 0, 1},
+    {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0},
+    {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0},
+    {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0},
+    {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0},
+    {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0},
+    {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0},
+    {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0},
+    {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0},
+    {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0},
+    {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0}, {53, 0, 0},
+  },
+  {
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+    {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1}, {17, 0, 1},
+  },
+  {
+    {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1},
+    {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1},
+    {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1},
+    {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1},
+    {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1},
+    {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1},
+    {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1},
+    {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1}, {220, 0, 1},
+    {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1},
+    {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1},
+    {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1},
+    {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1},
+    {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1},
+    {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1},
+    {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1},
+    {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1}, {22, 0, 1},
+  },
+  {
+    {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1},
+    {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1},
+    {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1},
+    {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1},
+    {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1},
+    {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1},
+    {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1},
+    {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1},
+    {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1},
+    {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1}, {139, 0, 1},
+    {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1},
+    {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1},
+    {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1},
+    {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1},
+    {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1},
+    {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1}, {182, 0, 1},
+  },
+  {
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {221, 0, 1}, {221, 0, 1}, {221, 0, 1}, {221, 0, 1}, {221, 0, 1}, {221, 0, 1}, {221, 0, 1}, {221, 0, 1},
+    {221, 0, 1}, {221, 0, 1}, {221, 0, 1}, {221, 0, 1}, {221, 0, 1}, {221, 0, 1}, {221, 0, 1}, {221, 0, 1},
+    {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1},
+    {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1},
+    {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1},
+    {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1},
+    {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1},
+    {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1}, {256, 0, 1},
+  },
+  {
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+    {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1}, {200, 0, 1},
+  },
+  {
+    {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1},
+    {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1},
+    {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1},
+    {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1},
+    {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1},
+    {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1},
+    {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1},
+    {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1}, {201, 0, 1},
+    {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1},
+    {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1},
+    {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1},
+    {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1},
+    {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1},
+    {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1},
+    {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1},
+    {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1}, {54, 0, 1},
+  },
+  {
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+    {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1}, {132, 0, 1},
+  },
+  {
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+    {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1}, {96, 0, 1},
+  },
+  {
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0}, {88, 0, 0},
+    {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0},
+    {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0},
+  },
+  {
+    {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0},
+    {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0},
+    {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0},
+    {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0}, {222, 0, 0},
+    {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1},
+    {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1},
+    {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1},
+    {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1},
+    {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1},
+    {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1}, {64, 0, 1},
+    {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1},
+    {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1},
+    {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1},
+    {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1},
+    {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1},
+    {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1}, {55, 0, 1},
+  },
+  {
+    {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1},
+    {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1},
+    {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1},
+    {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1},
+    {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1},
+    {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1},
+    {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1},
+    {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1},
+    {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1},
+    {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1}, {140, 0, 1},
+    {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0},
+    {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0},
+    {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0},
+    {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0},
+    {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0},
+    {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0},
+  },
+  {
+    {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0},
+    {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0}, {180, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+    {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0}, {15, 0, 0},
+  },
+  {
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+    {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0}, {155, 0, 0},
+  },
+  {
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+    {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0}, {167, 0, 0},
+  },
+  {
+    {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0},
+    {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0},
+    {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0},
+    {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0},
+    {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0},
+    {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0},
+    {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0},
+    {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0}, {58, 0, 0},
+    {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1},
+    {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1},
+    {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1},
+    {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1}, {190, 0, 1},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+  },
+  {
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+    {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0}, {81, 0, 0},
+  },
+  {
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+    {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0}, {27, 0, 0},
+  },
+  {
+    {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0},
+    {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0},
+    {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0},
+    {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0}, {24, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+    {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0}, {89, 0, 0},
+  },
+  {
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+    {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0}, {164, 0, 0},
+  },
+  {
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+  },
+  {
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0}, {73, 0, 0},
+    {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0},
+    {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0},
+    {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0},
+    {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0},
+    {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0},
+    {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0}, {162, 0, 0},
+    {223, 0, 1}, {223, 0, 1}, {223, 0, 1}, {223, 0, 1}, {223, 0, 1}, {223, 0, 1}, {223, 0, 1}, {223, 0, 1},
+    {223, 0, 1}, {223, 0, 1}, {223, 0, 1}, {223, 0, 1}, {223, 0, 1}, {223, 0, 1}, {223, 0, 1}, {223, 0, 1},
+  },
+  {
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+    {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0}, {29, 0, 0},
+  },
+  {
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+    {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1}, {224, 0, 1},
+  },
+  {
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+    {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0}, {163, 0, 0},
+  },
+  {
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+    {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0}, {226, 0, 0},
+  },
+  {
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+    {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0}, {165, 0, 0},
+  },
+  {
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1}, {93, 0, 1},
+    {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1},
+    {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1},
+    {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1},
+    {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1}, {135, 0, 1},
+  },
+  {
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+    {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1}, {59, 0, 1},
+  },
+  {
+    {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1},
+    {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1},
+    {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1},
+    {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1},
+    {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1},
+    {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1}, {92, 0, 1},
+    {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1},
+    {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1},
+    {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1},
+    {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1},
+    {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1},
+    {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1},
+    {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1},
+    {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1},
+    {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1},
+    {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1}, {247, 0, 1},
+  },
+  {
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1}, {85, 0, 1},
+    {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1},
+    {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1},
+    {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1},
+    {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1}, {67, 0, 1},
+  },
+  {
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+    {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0}, {227, 0, 0},
+  },
+  {
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+    {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1}, {37, 0, 1},
+  },
+  {
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+  },
+  {
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1}, {121, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {113, 0, 1}, {113, 0, 1}, {113, 0, 1}, {113, 0, 1}, {113, 0, 1}, {113, 0, 1}, {113, 0, 1}, {113, 0, 1},
+    {113, 0, 1}, {113, 0, 1}, {113, 0, 1}, {113, 0, 1}, {113, 0, 1}, {113, 0, 1}, {113, 0, 1}, {113, 0, 1},
+  },
+  {
+    {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1},
+    {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1},
+    {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1},
+    {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1},
+    {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1},
+    {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1},
+    {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1},
+    {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1}, {39, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+  },
+  {
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1}, {111, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+    {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1}, {123, 0, 1},
+  },
+  {
+    {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1},
+    {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1},
+    {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1},
+    {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1},
+    {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1},
+    {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1}, {25, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+  },
+  {
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1}, {101, 0, 1},
+    {120, 0, 1}, {120, 0, 1}, {120, 0, 1}, {120, 0, 1}, {120, 0, 1}, {120, 0, 1}, {120, 0, 1}, {120, 0, 1},
+    {120, 0, 1}, {120, 0, 1}, {120, 0, 1}, {120, 0, 1}, {120, 0, 1}, {120, 0, 1}, {120, 0, 1}, {120, 0, 1},
+    {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1},
+    {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1},
+    {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1},
+    {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1}, {26, 0, 1},
+    {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1},
+    {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1},
+    {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1},
+    {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1},
+    {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1},
+    {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1}, {38, 0, 1},
+    {124, 0, 1}, {124, 0, 1}, {124, 0, 1}, {124, 0, 1}, {124, 0, 1}, {124, 0, 1}, {124, 0, 1}, {124, 0, 1},
+    {124, 0, 1}, {124, 0, 1}, {124, 0, 1}, {124, 0, 1}, {124, 0, 1}, {124, 0, 1}, {124, 0, 1}, {124, 0, 1},
+  },
+  {
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+    {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1}, {82, 0, 1},
+  },
+  {
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+    {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1}, {33, 0, 1},
+  },
+  {
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+  },
+  {
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1}, {41, 0, 1},
+    {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1},
+    {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1},
+    {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1},
+    {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1},
+    {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1},
+    {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1},
+    {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1},
+    {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1}, {261, 0, 1},
+  },
+  {
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+    {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1}, {40, 0, 1},
+  },
+  {
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+  },
+  {
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1}, {260, 0, 1},
+    {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1},
+    {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1},
+    {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1},
+    {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1},
+    {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1},
+    {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1},
+    {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1},
+    {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1}, {259, 0, 1},
+    {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1},
+    {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1},
+    {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1},
+    {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1},
+    {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1},
+    {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1}, {145, 0, 1},
+  },
+  {
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+  },
+  {
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1}, {253, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+  },
+  {
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1}, {68, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+    {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1}, {18, 0, 1},
+  },
+  {
+    {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1},
+    {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1},
+    {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1},
+    {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1}, {169, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+  },
+  {
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+    {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1}, {136, 0, 1},
+  },
+  {
+    {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1},
+    {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1},
+    {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1},
+    {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1},
+    {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1},
+    {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1}, {232, 0, 1},
+    {57, 0, 1}, {57, 0, 1}, {57, 0, 1}, {57, 0, 1}, {57, 0, 1}, {57, 0, 1}, {57, 0, 1}, {57, 0, 1},
+    {57, 0, 1}, {57, 0, 1}, {57, 0, 1}, {57, 0, 1}, {57, 0, 1}, {57, 0, 1}, {57, 0, 1}, {57, 0, 1},
+    {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1},
+    {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1},
+    {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1},
+    {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1},
+    {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1},
+    {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1},
+    {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1},
+    {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1}, {197, 0, 1},
+  },
+  {
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1}, {209, 0, 1},
+    {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1},
+    {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1},
+    {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1},
+    {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1}, {72, 0, 1},
+  },
+  {
+    {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1},
+    {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1},
+    {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1},
+    {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1},
+    {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1},
+    {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1}, {125, 0, 1},
+    {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1},
+    {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1},
+    {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1},
+    {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1},
+    {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1},
+    {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1}, {205, 0, 1},
+    {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1},
+    {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1},
+    {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1},
+    {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1}, {103, 0, 1},
+  },
+  {
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1}, {117, 0, 1},
+    {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1},
+    {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1},
+    {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1},
+    {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1}, {176, 0, 1},
+  },
+  {
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1}, {49, 0, 1},
+    {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1},
+    {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1},
+    {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1},
+    {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1}, {175, 0, 1},
+  },
+  {
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1}, {239, 0, 1},
+    {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1},
+    {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1},
+    {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1},
+    {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1}, {157, 0, 1},
+  },
+  {
+    {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1},
+    {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1},
+    {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1},
+    {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1},
+    {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1},
+    {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1}, {86, 0, 1},
+    {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1},
+    {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1},
+    {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1},
+    {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1},
+    {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1},
+    {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1},
+    {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1},
+    {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1}, {137, 0, 1},
+    {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1},
+    {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1},
+  },
+  {
+    {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1},
+    {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1},
+    {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1},
+    {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1},
+    {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1},
+    {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1},
+    {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1},
+    {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1}, {51, 0, 1},
+    {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1},
+    {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1},
+    {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1},
+    {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1},
+    {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1},
+    {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1},
+    {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1},
+    {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1}, {156, 0, 1},
+  },
+  {
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+  },
+  {
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1}, {105, 0, 1},
+    {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1},
+    {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1},
+    {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1},
+    {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1},
+    {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1},
+    {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1},
+    {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1},
+    {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1},
+    {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1},
+    {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1}, {104, 0, 1},
+  },
+  {
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+    {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1}, {110, 0, 1},
+  },
+  {
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+    {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1}, {109, 0, 1},
+  },
+  {
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+    {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1}, {146, 0, 1},
+  },
+  {
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+    {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1}, {203, 0, 1},
+  },
+  {
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+    {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1}, {35, 0, 1},
+  },
+  {
+    {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1},
+    {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1},
+    {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1},
+    {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1},
+    {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1},
+    {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1},
+    {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1},
+    {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1},
+    {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1},
+    {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1}, {3, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+  },
+  {
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+    {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1}, {11, 0, 1},
+  },
+  {
+    {254, 0, 1}, {254, 0, 1}, {254, 0, 1}, {254, 0, 1}, {254, 0, 1}, {254, 0, 1}, {254, 0, 1}, {254, 0, 1},
+    {254, 0, 1}, {254, 0, 1}, {254, 0, 1}, {254, 0, 1}, {254, 0, 1}, {254, 0, 1}, {254, 0, 1}, {254, 0, 1},
+    {257, 0, 1}, {257, 0, 1}, {257, 0, 1}, {257, 0, 1}, {257, 0, 1}, {257, 0, 1}, {257, 0, 1}, {257, 0, 1},
+    {257, 0, 1}, {257, 0, 1}, {257, 0, 1}, {257, 0, 1}, {257, 0, 1}, {257, 0, 1}, {257, 0, 1}, {257, 0, 1},
+    {56, 0, 1}, {56, 0, 1}, {56, 0, 1}, {56, 0, 1}, {56, 0, 1}, {56, 0, 1}, {56, 0, 1}, {56, 0, 1},
+    {56, 0, 1}, {56, 0, 1}, {56, 0, 1}, {56, 0, 1}, {56, 0, 1}, {56, 0, 1}, {56, 0, 1}, {56, 0, 1},
+    {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1},
+    {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1},
+    {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1},
+    {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1}, {34, 0, 1},
+    {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1},
+    {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1},
+    {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1},
+    {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1}, {216, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+  },
+  {
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+    {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1}, {12, 0, 1},
+  },
+  {
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+  },
+  {
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1}, {100, 0, 1},
+    {219, 0, 1}, {219, 0, 1}, {219, 0, 1}, {219, 0, 1}, {219, 0, 1}, {219, 0, 1}, {219, 0, 1}, {219, 0, 1},
+    {219, 0, 1}, {219, 0, 1}, {219, 0, 1}, {219, 0, 1}, {219, 0, 1}, {219, 0, 1}, {219, 0, 1}, {219, 0, 1},
+  },
+  {
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+    {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1}, {144, 0, 1},
+  },
+  {
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+    {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1}, {143, 0, 1},
+  },
+  {
+    {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1},
+    {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1},
+    {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1},
+    {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1},
+    {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1},
+    {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1},
+    {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1},
+    {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1}, {0, 0, 1},
+    {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1},
+    {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1},
+    {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1},
+    {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1},
+    {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1},
+    {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1},
+    {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1},
+    {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1},
+  },
+  {
+    {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1},
+    {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1}, {6, 0, 1},
+    {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1},
+    {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1},
+    {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1},
+    {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1},
+    {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1},
+    {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1},
+    {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1},
+    {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1}, {7, 0, 1},
+    {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1},
+    {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1},
+    {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1},
+    {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1},
+    {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1},
+    {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1}, {198, 0, 1},
+  },
+  {
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1},
+    {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1},
+    {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1},
+    {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1}, {147, 0, 1},
+    {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1},
+    {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1},
+    {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1},
+    {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1},
+    {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1},
+    {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1},
+    {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1},
+    {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1}, {46, 0, 1},
+    {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1},
+    {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1},
+    {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1},
+    {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1}, {60, 0, 1},
+  },
+  {
+    {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1},
+    {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1},
+    {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1},
+    {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1},
+    {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1},
+    {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1}, {184, 0, 1},
+    {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1},
+    {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1},
+    {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1},
+    {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1}, {94, 0, 1},
+    {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1},
+    {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1},
+    {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1},
+    {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1},
+    {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1},
+    {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1}, {186, 0, 1},
+  },
+  {
+    {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1},
+    {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1},
+    {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1},
+    {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1}, {250, 0, 1},
+    {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1},
+    {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1},
+    {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1},
+    {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1},
+    {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1},
+    {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1},
+    {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1},
+    {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1}, {187, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1},
+    {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1},
+    {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1},
+    {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1},
+    {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1},
+    {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1},
+    {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1},
+    {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1},
+    {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1},
+    {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1}, {70, 0, 1},
+    {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1},
+    {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1},
+    {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1},
+    {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1},
+    {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1},
+    {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1}, {211, 0, 1},
+  },
+  {
+    {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1},
+    {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1},
+    {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1},
+    {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1},
+    {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1},
+    {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1}, {193, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1},
+    {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1},
+    {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1},
+    {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1},
+    {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1},
+    {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1}, {78, 0, 1},
+    {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1},
+    {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1},
+    {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1},
+    {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1},
+    {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1},
+    {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1},
+    {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1},
+    {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1}, {47, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+    {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1}, {142, 0, 1},
+  },
+  {
+    {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1},
+    {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1},
+    {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1},
+    {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1},
+    {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1},
+    {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1},
+    {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1},
+    {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1}, {65, 0, 1},
+    {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1},
+    {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1},
+    {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1},
+    {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1}, {114, 0, 1},
+    {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1},
+    {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1},
+    {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1},
+    {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1}, {195, 0, 1},
+  },
+  {
+    {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1},
+    {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1},
+    {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1},
+    {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1},
+    {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1},
+    {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1}, {178, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1},
+    {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1},
+    {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1},
+    {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1}, {107, 0, 1},
+  },
+  {
+    {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1},
+    {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1},
+    {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1},
+    {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1}, {199, 0, 1},
+    {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1},
+    {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1},
+    {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1},
+    {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1}, {148, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1},
+    {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1},
+    {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1},
+    {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1}, {160, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+    {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1}, {159, 0, 1},
+  },
+  {
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1}, {126, 0, 1},
+    {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1},
+    {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1},
+    {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1},
+    {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1}, {188, 0, 1},
+  },
+  {
+    {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1},
+    {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1},
+    {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1},
+    {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1}, {185, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1},
+    {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1},
+    {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1},
+    {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1},
+    {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1},
+    {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1},
+    {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1},
+    {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1}, {153, 0, 1},
+  },
+  {
+    {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1},
+    {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1},
+    {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1},
+    {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1},
+    {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1},
+    {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1},
+    {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1},
+    {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1}, {16, 0, 1},
+    {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1},
+    {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1},
+    {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1},
+    {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1}, {116, 0, 1},
+    {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1},
+    {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1},
+    {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1},
+    {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1}, {115, 0, 1},
+  },
+  {
+    {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1},
+    {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1},
+    {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1},
+    {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1},
+    {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1},
+    {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1}, {204, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1},
+    {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1},
+    {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1},
+    {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1},
+    {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1},
+    {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1},
+    {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1},
+    {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1},
+    {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1},
+    {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1}, {189, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+    {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1}, {183, 0, 1},
+  },
+  {
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1},
+    {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1},
+    {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1},
+    {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1}, {206, 0, 1},
+  },
+  {
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+    {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1}, {28, 0, 1},
+  },
+  {
+    {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1},
+    {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1},
+    {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1},
+    {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1},
+    {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1},
+    {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1},
+    {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1},
+    {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1},
+    {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1},
+    {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1}, {118, 0, 1},
+    {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1},
+    {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1},
+    {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1},
+    {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1},
+    {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1},
+    {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1}, {217, 0, 1},
+  },
+  {
+    {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1},
+    {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1},
+    {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1},
+    {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1},
+    {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1},
+    {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1},
+    {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1},
+    {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1},
+    {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1},
+    {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1}, {48, 0, 1},
+    {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1},
+    {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1},
+    {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1},
+    {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1},
+    {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1},
+    {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1}, {149, 0, 1},
+  },
+  {
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1}, {210, 0, 1},
+    {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1},
+    {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1},
+    {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1},
+    {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1}, {215, 0, 1},
+  },
+  {
+    {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1},
+    {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1},
+    {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1},
+    {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1},
+    {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1},
+    {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1},
+    {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1},
+    {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1},
+    {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1},
+    {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1}, {129, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1},
+    {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1},
+    {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1},
+    {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1},
+    {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1},
+    {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1}, {172, 0, 1},
+    {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1},
+    {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1},
+    {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1},
+    {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1},
+    {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1},
+    {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1},
+    {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1},
+    {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1},
+    {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1},
+    {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1}, {130, 0, 1},
+  },
+  {
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+    {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1}, {95, 0, 1},
+  },
+  {
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1}, {248, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+    {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1}, {213, 0, 1},
+  },
+  {
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1}, {168, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1},
+    {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1},
+    {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1},
+    {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1},
+    {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1},
+    {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1},
+    {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1},
+    {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1},
+    {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1},
+    {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1}, {241, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1},
+    {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1},
+    {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1},
+    {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1},
+    {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1},
+    {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1},
+    {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1},
+    {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1},
+    {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1},
+    {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1}, {1, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+    {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1}, {258, 0, 1},
+  },
+  {
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1},
+    {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1},
+    {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1},
+    {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1},
+    {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1},
+    {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1},
+    {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1},
+    {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1}, {196, 0, 1},
+  },
+  {
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+    {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1}, {62, 0, 1},
+  },
+  {
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+    {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1}, {63, 0, 1},
+  },
+  {
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+  },
+  {
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1}, {76, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+  },
+  {
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1}, {77, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+    {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1}, {4, 0, 1},
+  },
+  {
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+  },
+  {
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1}, {19, 0, 1},
+    {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1},
+    {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1},
+    {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1},
+    {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1},
+    {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1},
+    {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1}, {171, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1},
+    {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1},
+    {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1},
+    {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1},
+    {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1},
+    {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1}, {21, 0, 1},
+  },
+  {
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+  },
+  {
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1}, {194, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+  },
+  {
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1}, {161, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+    {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1}, {119, 0, 1},
+  },
+  {
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+  },
+  {
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1}, {75, 0, 1},
+    {212, 0, 1}, {212, 0, 1}, {212, 0, 1}, {212, 0, 1}, {212, 0, 1}, {212, 0, 1}, {212, 0, 1}, {212, 0, 1},
+    {212, 0, 1}, {212, 0, 1}, {212, 0, 1}, {212, 0, 1}, {212, 0, 1}, {212, 0, 1}, {212, 0, 1}, {212, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+    {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1}, {32, 0, 1},
+  },
+  {
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+    {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0}, {173, 0, 0},
+  },
+  {
+    {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1},
+    {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1},
+    {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1},
+    {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1},
+    {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1},
+    {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1},
+    {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1},
+    {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1},
+    {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1},
+    {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1}, {5, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1}, {240, 0, 1},
+    {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1},
+    {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1},
+    {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1},
+    {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1}, {61, 0, 1},
+  },
+  {
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+    {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1}, {154, 0, 1},
+  },
+  {
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+  },
+  {
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1}, {231, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+  },
+  {
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1}, {158, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+    {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1}, {10, 0, 1},
+  },
+  {
+    {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1},
+    {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1},
+    {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1},
+    {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1},
+    {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1},
+    {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1}, {150, 0, 1},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+  },
+  {
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0}, {74, 0, 0},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+    {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1}, {202, 0, 1},
+  },
+  {
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+    {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1}, {80, 0, 1},
+  },
+  {
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+    {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1}, {83, 0, 1},
+  },
+  {
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+    {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1}, {166, 0, 1},
+  },
+  {
+    {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0},
+    {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0},
+    {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0},
+    {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0},
+    {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0},
+    {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0},
+    {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0},
+    {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0},
+    {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0},
+    {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0}, {79, 0, 0},
+    {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1},
+    {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1},
+    {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1},
+    {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1},
+    {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1},
+    {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1}, {192, 0, 1},
+  },
+  {
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+    {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1}, {249, 0, 1},
+  },
+  {
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+    {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1}, {2, 0, 1},
+  },
+  {
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+    {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1}, {90, 0, 1},
+  },
+  {
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+    {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1}, {225, 0, 1},
+  },
+  {
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+    {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1}, {228, 0, 1},
+  },
+  {
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+  },
+  {
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1}, {42, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+  },
+  {
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1}, {43, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+  },
+  {
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+  },
+  {
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1}, {44, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+  },
+  {
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+  },
+  {
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1}, {45, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+  },
+  {
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1}, {36, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+    {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1}, {236, 0, 1},
+  },
+  {
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+  },
+  {
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1}, {255, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+    {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1}, {262, 0, 1},
+  },
+  {
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+    {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1}, {229, 0, 1},
+  },
+  {
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+    {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1}, {230, 0, 1},
+  },
+};
+
+} // libunicode
+} // relevanced
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include "libunicode/UnicodeBlock.h"
+
+namespace relevanced {
+namespace libunicode {
+
+/**
+ * Everything the tokenizer needs to know about a code point,
+ * packed into four bytes.
+ *
+ * The table is two-level: the high bits of a code point pick a
+ * page, the low bits an entry within it.  Identical pages are
+ * stored once, which keeps the whole thing around 120KB.
+ *
+ * It's generated by `scripts/extract_unicode_blocks.py table`;
+ * see `code_point_table.cpp`.
+ */
+struct CodePointInfo {
+  uint16_t block;
+
+  // added to a code point to get its normalized (lowercase) form.
+  uint8_t lowercaseOffset;
+  uint8_t isLetter;
+};
+
+const uint32_t kCodePointPageBits = 7;
+const uint32_t kMaxCodePoint = 0x10FFFF;
+
+extern const uint16_t kCodePointPageIndex[];
+extern const CodePointInfo kCodePointPages[][1 << kCodePointPageBits];
+
+inline const CodePointInfo& lookupCodePoint(uint32_t codePoint) {
+  static const CodePointInfo outOfRange {
+    (uint16_t) UnicodeBlock::UNKNOWN, 0, 1
+  };
+  if (codePoint > kMaxCodePoint) {
+    return outOfRange;
+  }
+  auto page = kCodePointPageIndex[codePoint >> kCodePointPageBits];
+  return kCodePointPages[page][codePoint & ((1 << kCodePointPageBits) - 1)];
+}
+
+} // libunicode
+} // relevanced
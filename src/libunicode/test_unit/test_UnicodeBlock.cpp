@@ -37,4 +37,20 @@ TEST(TestGetUnicodeBlock, LatinExtendedA) {
     UnicodeBlock::LATIN_EXTENDED_A,
     getUnicodeBlock(codepoint)
   );
-}
\ No newline at end of file
+}
+
+TEST(TestGetUnicodeBlock, MeeteiMayek) {
+  uint32_t codepoint = 43968; // first letter of Meetei Mayek proper
+  EXPECT_EQ(
+    UnicodeBlock::MEETEI_MAYEK,
+    getUnicodeBlock(codepoint)
+  );
+}
+
+TEST(TestGetUnicodeBlock, OutOfRange) {
+  uint32_t codepoint = 0x110000;
+  EXPECT_EQ(
+    UnicodeBlock::UNKNOWN,
+    getUnicodeBlock(codepoint)
+  );
+}
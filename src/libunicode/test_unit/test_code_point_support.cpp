@@ -36,3 +36,27 @@ TEST(TestIsLetterPoint, SpanishLetter) {
   uint32_t codePoint = 209; // capital ene (n with tilde)
   EXPECT_TRUE(isLetterPoint(codePoint));
 }
+
+TEST(TestNormalizeCodePoint, BasicLatin) {
+  EXPECT_EQ((uint32_t) 'a', normalizeCodePoint((uint32_t) 'A'));
+  EXPECT_EQ((uint32_t) 'z', normalizeCodePoint((uint32_t) 'Z'));
+  EXPECT_EQ((uint32_t) 'a', normalizeCodePoint((uint32_t) 'a'));
+  EXPECT_EQ((uint32_t) '[', normalizeCodePoint((uint32_t) '['));
+}
+
+TEST(TestNormalizeCodePoint, Latin1Supplement) {
+  EXPECT_EQ(241, normalizeCodePoint(209)); // capital ene -> small ene
+  EXPECT_EQ(215, normalizeCodePoint(215)); // multiplication sign
+  EXPECT_EQ(223, normalizeCodePoint(223)); // eszett has no capital
+}
+
+TEST(TestNormalizeCodePoint, LatinExtendedA) {
+  EXPECT_EQ(257, normalizeCodePoint(256)); // A with macron
+  EXPECT_EQ(257, normalizeCodePoint(257));
+  EXPECT_EQ(383, normalizeCodePoint(383)); // small long S
+}
+
+TEST(TestNormalizeCodePoint, OtherBlocks) {
+  EXPECT_EQ(1046, normalizeCodePoint(1046)); // cyrillic zhe
+  EXPECT_EQ(0x110000, normalizeCodePoint(0x110000));
+}
@@ -0,0 +1,41 @@
+#include <memory>
+#include <string>
+#include <glog/logging.h>
+#include <gflags/gflags.h>
+#include "commandLineFlags.h"
+#include "buildServerOptions.h"
+#include "persistence/RockHandle.h"
+#include "persistence/SyncPersistence.h"
+#include "util/Clock.h"
+#include "util/util.h"
+using namespace std;
+using namespace relevanced;
+using namespace relevanced::persistence;
+
+// opening a RockHandle moves any keys written before column
+// families were introduced into their new families, and
+// `buildUnusedDocumentIndex` indexes documents written before the
+// unused-document index existed; this lets both happen offline
+// instead of on the server's first start.
+int main(int argc, char *argv[]) {
+  google::SetUsageMessage(
+    "Moves keys written by older relevanced versions into "
+    "their column families, and indexes unused documents");
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  google::InitGoogleLogging(argv[0]);
+  google::InstallFailureSignalHandler();
+  auto options = buildOptions();
+  string rockDir = options->getDataDir() + "/rock";
+  LOG(INFO) << "migrating " << rockDir;
+  util::UniquePointer<RockHandleIf> rockHandle(new RockHandle(rockDir));
+  SyncPersistence persistence(
+    std::make_shared<util::Clock>(), std::move(rockHandle)
+  );
+  auto indexed = persistence.buildUnusedDocumentIndex();
+  if (indexed.hasException()) {
+    LOG(ERROR) << "could not build the unused document index; "
+      << "run this again to retry.";
+    return 1;
+  }
+  LOG(INFO) << "done; the database is up to date.";
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include "gen-cpp2/RelevancedProtocol_types.h"
 
 namespace relevanced {
@@ -17,6 +18,13 @@ class Document {
     thrift_protocol::Language language
   ) : id(idStr), text(textStr), language(language) {}
 
+  // takes over the request's buffer; the document processor
+  // tokenizes `text` in place, so it never needs a copy.
+  Document(const std::string &idStr,
+    std::string &&textStr,
+    thrift_protocol::Language language
+  ) : id(idStr), text(std::move(textStr)), language(language) {}
+
 };
 
 } // models
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include "models/WordVector.h"
@@ -25,7 +26,19 @@ class ProcessedDocument {
   ProcessedDocument(std::string id,
     std::vector<text_util::ScoredWord> scoredWords,
     double magnitude
-  ) : id(id), scoredWords(scoredWords), magnitude(magnitude) {}
+  ) : id(id), scoredWords(scoredWords), magnitude(magnitude) {
+    sortScoredWords();
+  }
+
+  // scoredWords are kept sorted by term id, so that they can
+  // be merge-joined against centroid vectors.
+  void sortScoredWords() {
+    std::sort(scoredWords.begin(), scoredWords.end(),
+      [](const text_util::ScoredWord &w1, const text_util::ScoredWord &w2) {
+        return w1.termId < w2.termId;
+      }
+    );
+  }
 
 };
 
@@ -0,0 +1,258 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "models/SparseVector.h"
+#include "text_util/ScoredWord.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define RELEVANCED_HAVE_AVX2_DOT 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace relevanced {
+namespace models {
+
+using text_util::ScoredWord;
+using sparse_vector_detail::TermWeightView;
+
+static_assert(sizeof(ScoredWord) % sizeof(float) == 0,
+  "ScoredWord records must be strideable as uint32_t and float arrays");
+
+SparseVector::SparseVector(const unordered_map<uint32_t, double> &scores) {
+  reserve(scores.size());
+  for (auto &elem : scores) {
+    add(elem.first, elem.second);
+  }
+  sort();
+}
+
+void SparseVector::reserve(size_t count) {
+  ids.reserve(count);
+  weights.reserve(count);
+}
+
+void SparseVector::clear() {
+  ids.clear();
+  weights.clear();
+}
+
+void SparseVector::add(uint32_t termId, double weight) {
+  ids.push_back(termId);
+  weights.push_back(weight);
+}
+
+void SparseVector::sort() {
+  if (std::is_sorted(ids.begin(), ids.end())) {
+    return;
+  }
+  vector<pair<uint32_t, double>> pairs;
+  pairs.reserve(ids.size());
+  for (size_t i = 0; i < ids.size(); i++) {
+    pairs.push_back(make_pair(ids[i], weights[i]));
+  }
+  std::sort(pairs.begin(), pairs.end(),
+    [](const pair<uint32_t, double> &p1, const pair<uint32_t, double> &p2) {
+      return p1.first < p2.first;
+    }
+  );
+  for (size_t i = 0; i < pairs.size(); i++) {
+    ids[i] = pairs[i].first;
+    weights[i] = pairs[i].second;
+  }
+}
+
+double SparseVector::get(uint32_t termId) const {
+  auto found = std::lower_bound(ids.begin(), ids.end(), termId);
+  if (found == ids.end() || *found != termId) {
+    return 0.0;
+  }
+  return weights[found - ids.begin()];
+}
+
+namespace {
+
+using DotKernel = double (*)(const TermWeightView&, const TermWeightView&);
+
+DotKernel chooseDotKernel() {
+  if (sparse_vector_detail::avx2Supported()) {
+    return sparse_vector_detail::avx2Dot;
+  }
+  return sparse_vector_detail::scalarDot;
+}
+
+double dispatchDot(const TermWeightView &left, const TermWeightView &right) {
+  static const DotKernel kernel = chooseDotKernel();
+  return kernel(left, right);
+}
+
+double mergeFrom(const TermWeightView &left, size_t leftIdx,
+                 const TermWeightView &right, size_t rightIdx,
+                 double sum) {
+  while (leftIdx < left.size && rightIdx < right.size) {
+    uint32_t leftId = left.idAt(leftIdx);
+    uint32_t rightId = right.idAt(rightIdx);
+    if (leftId < rightId) {
+      leftIdx++;
+    } else if (rightId < leftId) {
+      rightIdx++;
+    } else {
+      sum += left.weightAt(leftIdx) * right.weightAt(rightIdx);
+      leftIdx++;
+      rightIdx++;
+    }
+  }
+  return sum;
+}
+
+} // anonymous namespace
+
+double SparseVector::dot(const SparseVector &other) const {
+  return dispatchDot(
+    sparse_vector_detail::viewOf(*this),
+    sparse_vector_detail::viewOf(other)
+  );
+}
+
+double SparseVector::dot(const vector<ScoredWord> &words) const {
+  return dispatchDot(
+    sparse_vector_detail::viewOf(*this),
+    sparse_vector_detail::viewOf(words)
+  );
+}
+
+namespace sparse_vector_detail {
+
+TermWeightView viewOf(const SparseVector &vec) {
+  return TermWeightView {
+    vec.ids.data(), 1, vec.weights.data(), nullptr, 1, vec.size()
+  };
+}
+
+TermWeightView viewOf(const vector<ScoredWord> &words) {
+  if (words.empty()) {
+    return TermWeightView {nullptr, 1, nullptr, nullptr, 1, 0};
+  }
+  return TermWeightView {
+    &words[0].termId, sizeof(ScoredWord) / sizeof(uint32_t),
+    nullptr, &words[0].score, sizeof(ScoredWord) / sizeof(float),
+    words.size()
+  };
+}
+
+double scalarDot(const TermWeightView &left, const TermWeightView &right) {
+  return mergeFrom(left, 0, right, 0, 0.0);
+}
+
+#ifdef RELEVANCED_HAVE_AVX2_DOT
+
+bool avx2Supported() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+}
+
+__attribute__((target("avx2")))
+static inline __m256i loadEightIds(const TermWeightView &view,
+                                   size_t offset,
+                                   __m256i gatherIndex) {
+  if (view.idStride == 1) {
+    return _mm256_loadu_si256((const __m256i*) (view.ids + offset));
+  }
+  return _mm256_i32gather_epi32(
+    (const int*) (view.ids + offset * view.idStride), gatherIndex, 4
+  );
+}
+
+/**
+ * Compares eight ids from each side at a time by rotating the
+ * right-hand block through all eight lane offsets.  Blocks that
+ * share no ids (the common case) cost one pass of compares; the
+ * few matches are then resolved in ascending id order, so the sum
+ * is accumulated in exactly the same order as `scalarDot`.
+ */
+__attribute__((target("avx2")))
+double avx2Dot(const TermWeightView &left, const TermWeightView &right) {
+  const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i ones = _mm256_set1_epi32(1);
+  const __m256i sevens = _mm256_set1_epi32(7);
+  const __m256i leftGather = _mm256_mullo_epi32(
+    lanes, _mm256_set1_epi32((int) left.idStride)
+  );
+  const __m256i rightGather = _mm256_mullo_epi32(
+    lanes, _mm256_set1_epi32((int) right.idStride)
+  );
+  double sum = 0.0;
+  size_t leftIdx = 0;
+  size_t rightIdx = 0;
+  while (leftIdx + 8 <= left.size && rightIdx + 8 <= right.size) {
+    uint32_t leftMax = left.idAt(leftIdx + 7);
+    uint32_t rightMax = right.idAt(rightIdx + 7);
+    if (leftMax < right.idAt(rightIdx)) {
+      leftIdx += 8;
+      continue;
+    }
+    if (rightMax < left.idAt(leftIdx)) {
+      rightIdx += 8;
+      continue;
+    }
+    __m256i leftIds = loadEightIds(left, leftIdx, leftGather);
+    __m256i rightIds = loadEightIds(right, rightIdx, rightGather);
+    __m256i rotation = lanes;
+    int masks[8];
+    int anyMatch = 0;
+    for (size_t rot = 0; rot < 8; rot++) {
+      __m256i rotated = _mm256_permutevar8x32_epi32(rightIds, rotation);
+      masks[rot] = _mm256_movemask_ps(
+        _mm256_castsi256_ps(_mm256_cmpeq_epi32(leftIds, rotated))
+      );
+      anyMatch |= masks[rot];
+      rotation = _mm256_and_si256(_mm256_add_epi32(rotation, ones), sevens);
+    }
+    if (anyMatch) {
+      int partner[8] = {-1, -1, -1, -1, -1, -1, -1, -1};
+      for (size_t rot = 0; rot < 8; rot++) {
+        int mask = masks[rot];
+        while (mask) {
+          int lane = __builtin_ctz(mask);
+          partner[lane] = (lane + (int) rot) & 7;
+          mask &= mask - 1;
+        }
+      }
+      for (size_t lane = 0; lane < 8; lane++) {
+        if (partner[lane] >= 0) {
+          sum += left.weightAt(leftIdx + lane)
+               * right.weightAt(rightIdx + partner[lane]);
+        }
+      }
+    }
+    if (leftMax <= rightMax) {
+      leftIdx += 8;
+    }
+    if (rightMax <= leftMax) {
+      rightIdx += 8;
+    }
+  }
+  return mergeFrom(left, leftIdx, right, rightIdx, sum);
+}
+
+#else
+
+bool avx2Supported() {
+  return false;
+}
+
+double avx2Dot(const TermWeightView &left, const TermWeightView &right) {
+  return scalarDot(left, right);
+}
+
+#endif
+
+} // sparse_vector_detail
+
+} // models
+} // relevanced
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "text_util/ScoredWord.h"
+
+namespace relevanced {
+namespace models {
+
+/**
+ * Term-id keyed vector stored as two parallel arrays, sorted
+ * by term id.
+ *
+ * Keeping the ids contiguous and ordered lets dot products
+ * run as a merge-join instead of a hash probe per term, and
+ * lets the join skip over runs of non-matching ids eight at
+ * a time on hardware that supports AVX2.
+ */
+class SparseVector {
+ public:
+  std::vector<uint32_t> ids;
+  std::vector<double> weights;
+
+  SparseVector() {}
+  explicit SparseVector(const std::unordered_map<uint32_t, double> &scores);
+
+  size_t size() const { return ids.size(); }
+  bool empty() const { return ids.empty(); }
+  void reserve(size_t count);
+  void clear();
+
+  // appends without restoring order; call `sort()` afterwards.
+  void add(uint32_t termId, double weight);
+  void sort();
+
+  // 0.0 if the term is not present.
+  double get(uint32_t termId) const;
+
+  double dot(const SparseVector &other) const;
+
+  // `words` must be sorted by term id.
+  double dot(const std::vector<text_util::ScoredWord> &words) const;
+};
+
+namespace sparse_vector_detail {
+
+/**
+ * Strided view over (term id, weight) pairs, so that the
+ * same kernels can join a structure-of-arrays vector against
+ * an array of `ScoredWord` records.
+ *
+ * Exactly one of `weights` and `floatWeights` is set: vectors
+ * keep double weights, while `ScoredWord` stores floats.
+ */
+struct TermWeightView {
+  const uint32_t *ids;
+  size_t idStride;
+  const double *weights;
+  const float *floatWeights;
+  size_t weightStride;
+  size_t size;
+
+  uint32_t idAt(size_t idx) const { return ids[idx * idStride]; }
+  double weightAt(size_t idx) const {
+    if (weights != nullptr) {
+      return weights[idx * weightStride];
+    }
+    return floatWeights[idx * weightStride];
+  }
+};
+
+TermWeightView viewOf(const SparseVector &vec);
+TermWeightView viewOf(const std::vector<text_util::ScoredWord> &words);
+
+double scalarDot(const TermWeightView &left, const TermWeightView &right);
+
+bool avx2Supported();
+
+// only valid when `avx2Supported()` returns true.
+double avx2Dot(const TermWeightView &left, const TermWeightView &right);
+
+} // sparse_vector_detail
+
+} // models
+} // relevanced
@@ -6,6 +6,7 @@
 #include <folly/DynamicConverter.h>
 
 #include "models/WordVector.h"
+#include "text_util/TermDictionary.h"
 #include "util/util.h"
 
 namespace relevanced {
@@ -13,27 +14,70 @@ namespace models {
 
 using namespace std;
 using namespace folly;
+using text_util::TermDictionary;
 
 WordVector::WordVector() {}
 
-WordVector::WordVector(unordered_map<string, double> scores, double magnitude)
+WordVector::WordVector(SparseVector scores, double magnitude)
+    : scores(std::move(scores)), magnitude(magnitude) {
+  this->scores.sort();
+}
+
+WordVector::WordVector(SparseVector scores,
+                       double magnitude,
+                       double docWeight)
+    : scores(std::move(scores)), magnitude(magnitude), documentWeight(docWeight) {
+  this->scores.sort();
+}
+
+WordVector::WordVector(const unordered_map<uint32_t, double> &scores,
+                       double magnitude)
     : scores(scores), magnitude(magnitude) {}
 
-WordVector::WordVector(unordered_map<string, double> scores,
+WordVector::WordVector(const unordered_map<uint32_t, double> &scores,
                        double magnitude,
                        double docWeight)
     : scores(scores), magnitude(magnitude), documentWeight(docWeight) {}
 
-double WordVector::score(const unordered_map<string, double> &otherScores,
-                         double otherMagnitude) {
-  double dotProd = 0.0;
-  for (auto &elem : otherScores) {
-    auto selfScore = scores.find(elem.first);
-    if (selfScore == scores.end()) {
-      continue;
-    }
-    dotProd += (elem.second * selfScore->second);
+WordVector::WordVector(const unordered_map<string, double> &termScores,
+                       double magnitude)
+    : magnitude(magnitude) {
+  assignTermScores(termScores);
+}
+
+WordVector::WordVector(const unordered_map<string, double> &termScores,
+                       double magnitude,
+                       double docWeight)
+    : magnitude(magnitude), documentWeight(docWeight) {
+  assignTermScores(termScores);
+}
+
+void WordVector::assignTermScores(
+    const unordered_map<string, double> &termScores) {
+  auto dictionary = TermDictionary::getDefault();
+  scores.clear();
+  scores.reserve(termScores.size());
+  for (auto &elem : termScores) {
+    scores.add(dictionary->getId(elem.first), elem.second);
+  }
+  scores.sort();
+}
+
+unordered_map<string, double> WordVector::getTermScores() const {
+  auto dictionary = TermDictionary::getDefault();
+  unordered_map<string, double> result;
+  result.reserve(scores.size());
+  for (size_t i = 0; i < scores.size(); i++) {
+    result.insert(make_pair(
+      dictionary->getTerm(scores.ids[i]), scores.weights[i]
+    ));
   }
+  return result;
+}
+
+double WordVector::score(const SparseVector &otherScores,
+                         double otherMagnitude) {
+  double dotProd = scores.dot(otherScores);
   return dotProd / (magnitude * otherMagnitude);
 }
 
@@ -42,15 +86,7 @@ double WordVector::score(WordVector *other) {
 }
 
 double WordVector::score(ProcessedDocument *other) {
-  double dotProd = 0.0;
-  for (auto &elem: other->scoredWords) {
-    string key = elem.word;
-    auto selfScore = scores.find(key);
-    if (selfScore == scores.end()) {
-      continue;
-    }
-    dotProd += (elem.score * selfScore->second);
-  }
+  double dotProd = scores.dot(other->scoredWords);
   return dotProd / (magnitude * other->magnitude);
 }
 
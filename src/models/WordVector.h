@@ -10,6 +10,7 @@
 #include <folly/DynamicConverter.h>
 
 #include "models/ProcessedDocument.h"
+#include "models/SparseVector.h"
 #include "serialization/serializers.h"
 #include "util/util.h"
 
@@ -18,25 +19,52 @@ namespace models {
 
 class WordVector {
  public:
-  std::unordered_map<std::string, double> scores;
+  // keyed by text_util::TermDictionary id, sorted by id
+  SparseVector scores;
   double magnitude{0.0};
   double documentWeight{1.0};
 
   WordVector();
 
   WordVector(
-    std::unordered_map<std::string, double>,
+    SparseVector,
     double magnitude
   );
 
   WordVector(
-    std::unordered_map<std::string, double>,
+    SparseVector,
     double magnitude,
     double docWeight
   );
 
+  WordVector(
+    const std::unordered_map<uint32_t, double>&,
+    double magnitude
+  );
+
+  WordVector(
+    const std::unordered_map<uint32_t, double>&,
+    double magnitude,
+    double docWeight
+  );
+
+  WordVector(
+    const std::unordered_map<std::string, double>&,
+    double magnitude
+  );
+
+  WordVector(
+    const std::unordered_map<std::string, double>&,
+    double magnitude,
+    double docWeight
+  );
+
+  void assignTermScores(const std::unordered_map<std::string, double>&);
+
+  std::unordered_map<std::string, double> getTermScores() const;
+
   double score(
-    const std::unordered_map<std::string, double> &otherScores,
+    const SparseVector &otherScores,
     double otherMagnitude
   );
 
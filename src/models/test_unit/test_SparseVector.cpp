@@ -0,0 +1,87 @@
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "models/SparseVector.h"
+#include "text_util/ScoredWord.h"
+
+using namespace std;
+using namespace relevanced;
+using namespace relevanced::models;
+using namespace relevanced::text_util;
+using namespace relevanced::models::sparse_vector_detail;
+
+SparseVector makeRandomVector(size_t count, uint32_t maxId) {
+  unordered_map<uint32_t, double> scores;
+  while (scores.size() < count) {
+    uint32_t termId = 1 + (rand() % maxId);
+    scores[termId] = (rand() % 1000) / 100.0;
+  }
+  return SparseVector(scores);
+}
+
+TEST(TestSparseVector, SortsOnConstruction) {
+  SparseVector vec(unordered_map<uint32_t, double> {
+    {17, 1.0}, {3, 2.0}, {9, 3.0}
+  });
+  vector<uint32_t> expectedIds {3, 9, 17};
+  vector<double> expectedWeights {2.0, 3.0, 1.0};
+  EXPECT_EQ(expectedIds, vec.ids);
+  EXPECT_EQ(expectedWeights, vec.weights);
+}
+
+TEST(TestSparseVector, Get) {
+  SparseVector vec(unordered_map<uint32_t, double> {
+    {17, 1.0}, {3, 2.0}, {9, 3.0}
+  });
+  EXPECT_EQ(3.0, vec.get(9));
+  EXPECT_EQ(0.0, vec.get(10));
+  EXPECT_EQ(0.0, vec.get(100));
+}
+
+TEST(TestSparseVector, Dot) {
+  SparseVector vec1(unordered_map<uint32_t, double> {
+    {1, 1.0}, {2, 2.0}, {5, 3.0}
+  });
+  SparseVector vec2(unordered_map<uint32_t, double> {
+    {2, 4.0}, {5, 0.5}, {7, 9.0}
+  });
+  EXPECT_EQ(9.5, vec1.dot(vec2));
+  EXPECT_EQ(9.5, vec2.dot(vec1));
+  EXPECT_EQ(0.0, vec1.dot(SparseVector()));
+}
+
+TEST(TestSparseVector, KernelsAgreeOnSparseVectors) {
+  srand(17);
+  for (size_t i = 0; i < 50; i++) {
+    auto vec1 = makeRandomVector(1 + rand() % 300, 2000);
+    auto vec2 = makeRandomVector(1 + rand() % 300, 2000);
+    double expected = scalarDot(viewOf(vec1), viewOf(vec2));
+    EXPECT_EQ(expected, vec1.dot(vec2));
+    if (avx2Supported()) {
+      EXPECT_EQ(expected, avx2Dot(viewOf(vec1), viewOf(vec2)));
+    }
+  }
+}
+
+TEST(TestSparseVector, KernelsAgreeOnScoredWords) {
+  srand(23);
+  for (size_t i = 0; i < 50; i++) {
+    auto vec = makeRandomVector(1 + rand() % 300, 2000);
+    auto other = makeRandomVector(1 + rand() % 300, 2000);
+    vector<ScoredWord> words(other.size());
+    for (size_t j = 0; j < other.size(); j++) {
+      words[j].termId = other.ids[j];
+      words[j].score = other.weights[j];
+      // records hold float weights; compare against the same values.
+      other.weights[j] = words[j].score;
+    }
+    double expected = scalarDot(viewOf(vec), viewOf(other));
+    EXPECT_EQ(expected, vec.dot(words));
+    if (avx2Supported()) {
+      EXPECT_EQ(expected, avx2Dot(viewOf(vec), viewOf(words)));
+    }
+  }
+}
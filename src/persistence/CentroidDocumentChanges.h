@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace relevanced {
+namespace persistence {
+
+/**
+ * Membership changes made to a centroid since its last update.
+ *
+ * When `needsFullRebuild` is set, `added` and `removed` are
+ * meaningless: the persisted centroid can't be brought up to
+ * date with deltas alone (e.g. the changes weren't tracked
+ * across a restart, or a member document was rewritten), and
+ * it has to be recomputed from all of its documents.
+ */
+struct CentroidDocumentChanges {
+  std::vector<std::string> added;
+  std::vector<std::string> removed;
+  bool needsFullRebuild {true};
+};
+
+} // persistence
+} // relevanced
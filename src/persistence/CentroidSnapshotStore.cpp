@@ -0,0 +1,303 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <glog/logging.h>
+#include <folly/Format.h>
+#include <folly/Optional.h>
+
+#include "persistence/CentroidSnapshotStore.h"
+#include "models/Centroid.h"
+#include "models/SparseVector.h"
+#include "models/WordVector.h"
+#include "text_util/StringView.h"
+#include "text_util/TermDictionary.h"
+#include "util/util.h"
+
+using namespace std;
+using namespace folly;
+
+namespace relevanced {
+namespace persistence {
+
+using models::Centroid;
+using models::SparseVector;
+using text_util::StringView;
+using text_util::TermDictionary;
+using util::UniquePointer;
+
+namespace {
+
+const char kSnapshotMagic[8] = {'R', 'L', 'V', 'C', 'S', 'N', 'A', 'P'};
+const uint32_t kSnapshotVersion = 1;
+
+// written in native byte order; a snapshot copied to a machine
+// with the other byte order reads back as invalid, not garbage.
+const uint32_t kByteOrderMark = 0x01020304;
+
+struct SnapshotHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrderMark;
+  uint64_t termCount;
+  uint64_t termBytes;
+  double magnitude;
+  double documentWeight;
+};
+
+static_assert(sizeof(SnapshotHeader) % sizeof(double) == 0,
+  "snapshot arrays must start double-aligned");
+
+const char *kSnapshotSuffix = ".snapshot";
+
+bool writeAll(int fd, const void *data, size_t len) {
+  const char *current = (const char*) data;
+  while (len > 0) {
+    auto written = ::write(fd, current, len);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    current += written;
+    len -= written;
+  }
+  return true;
+}
+
+bool readAll(int fd, void *data, size_t len) {
+  char *current = (char*) data;
+  while (len > 0) {
+    auto readCount = ::read(fd, current, len);
+    if (readCount < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    if (readCount == 0) {
+      return false;
+    }
+    current += readCount;
+    len -= readCount;
+  }
+  return true;
+}
+
+// makes a rename into the path's directory durable.
+bool syncParentDirectory(const string &path) {
+  auto slash = path.rfind('/');
+  string directory = slash == string::npos ? "." : path.substr(0, slash);
+  int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+  if (fd < 0) {
+    LOG(INFO) << format("could not open directory '{}'", directory);
+    return false;
+  }
+  bool synced = ::fsync(fd) == 0;
+  ::close(fd);
+  if (!synced) {
+    LOG(INFO) << format("could not sync directory '{}'", directory);
+  }
+  return synced;
+}
+
+} // anonymous namespace
+
+bool writeCentroidSnapshot(const string &path, Centroid *centroid) {
+  auto dictionary = TermDictionary::getDefault();
+  auto &scores = centroid->wordVector.scores;
+  vector<pair<string, double>> terms;
+  terms.reserve(scores.size());
+  for (size_t i = 0; i < scores.size(); i++) {
+    terms.push_back(make_pair(
+      dictionary->getTerm(scores.ids[i]), scores.weights[i]
+    ));
+  }
+  std::sort(terms.begin(), terms.end());
+
+  vector<double> weights;
+  vector<uint64_t> offsets;
+  string termBlob;
+  weights.reserve(terms.size());
+  offsets.reserve(terms.size() + 1);
+  for (auto &term : terms) {
+    offsets.push_back(termBlob.size());
+    termBlob.append(term.first);
+    weights.push_back(term.second);
+  }
+  offsets.push_back(termBlob.size());
+
+  SnapshotHeader header;
+  memcpy(header.magic, kSnapshotMagic, sizeof(kSnapshotMagic));
+  header.version = kSnapshotVersion;
+  header.byteOrderMark = kByteOrderMark;
+  header.termCount = terms.size();
+  header.termBytes = termBlob.size();
+  header.magnitude = centroid->wordVector.magnitude;
+  header.documentWeight = centroid->wordVector.documentWeight;
+
+  string tempPath = path + ".tmp";
+  int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    LOG(INFO) << format("could not open '{}' for writing", tempPath);
+    return false;
+  }
+  bool written = writeAll(fd, &header, sizeof(header))
+      && writeAll(fd, weights.data(), weights.size() * sizeof(double))
+      && writeAll(fd, offsets.data(), offsets.size() * sizeof(uint64_t))
+      && writeAll(fd, termBlob.data(), termBlob.size())
+      && ::fsync(fd) == 0;
+  ::close(fd);
+  if (!written || ::rename(tempPath.c_str(), path.c_str()) != 0) {
+    LOG(INFO) << format("could not write centroid snapshot '{}'", path);
+    ::unlink(tempPath.c_str());
+    return false;
+  }
+  return syncParentDirectory(path);
+}
+
+Optional<UniquePointer<Centroid>> readCentroidSnapshot(
+    const string &path, const string &id) {
+  Optional<UniquePointer<Centroid>> result;
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return std::move(result);
+  }
+  struct stat fileStat;
+  string contents;
+  bool readOk = fstat(fd, &fileStat) == 0
+      && (size_t) fileStat.st_size >= sizeof(SnapshotHeader);
+  if (readOk) {
+    contents.resize(fileStat.st_size);
+    readOk = readAll(fd, &contents[0], contents.size());
+  }
+  ::close(fd);
+  if (!readOk) {
+    return std::move(result);
+  }
+  size_t fileSize = contents.size();
+
+  SnapshotHeader header;
+  memcpy(&header, contents.data(), sizeof(header));
+  if (memcmp(header.magic, kSnapshotMagic, sizeof(kSnapshotMagic)) != 0
+      || header.version != kSnapshotVersion
+      || header.byteOrderMark != kByteOrderMark) {
+    LOG(INFO) << format("ignoring invalid centroid snapshot '{}'", path);
+    return std::move(result);
+  }
+  uint64_t termCount = header.termCount;
+  uint64_t arrayBytes = termCount * sizeof(double)
+      + (termCount + 1) * sizeof(uint64_t);
+  if (termCount > fileSize
+      || sizeof(SnapshotHeader) + arrayBytes + header.termBytes != fileSize) {
+    LOG(INFO) << format("ignoring truncated centroid snapshot '{}'", path);
+    return std::move(result);
+  }
+
+  // the arrays are copied out rather than cast, so they
+  // needn't be aligned within the buffer.
+  const char *weights = contents.data() + sizeof(SnapshotHeader);
+  const char *offsets = weights + termCount * sizeof(double);
+  const char *terms = weights + arrayBytes;
+  vector<uint64_t> termOffsets(termCount + 1);
+  memcpy(termOffsets.data(), offsets, termOffsets.size() * sizeof(uint64_t));
+  if (termOffsets[termCount] != header.termBytes) {
+    LOG(INFO) << format("ignoring corrupt centroid snapshot '{}'", path);
+    return std::move(result);
+  }
+  for (size_t i = 0; i < termCount; i++) {
+    if (termOffsets[i] > termOffsets[i + 1]) {
+      LOG(INFO) << format("ignoring corrupt centroid snapshot '{}'", path);
+      return std::move(result);
+    }
+  }
+
+  auto dictionary = TermDictionary::getDefault();
+  UniquePointer<Centroid> centroid(new Centroid(id));
+  auto &wordVector = centroid->wordVector;
+  wordVector.magnitude = header.magnitude;
+  wordVector.documentWeight = header.documentWeight;
+  wordVector.scores.reserve(termCount);
+  for (size_t i = 0; i < termCount; i++) {
+    double weight;
+    memcpy(&weight, weights + i * sizeof(double), sizeof(double));
+    StringView term(
+      terms + termOffsets[i], termOffsets[i + 1] - termOffsets[i]
+    );
+    wordVector.scores.add(dictionary->getId(term), weight);
+  }
+  wordVector.scores.sort();
+  result.assign(std::move(centroid));
+  return std::move(result);
+}
+
+CentroidSnapshotStore::CentroidSnapshotStore(string directory)
+    : directory_(directory) {
+  if (::mkdir(directory_.c_str(), 0755) != 0 && errno != EEXIST) {
+    LOG(INFO) << format(
+      "could not create centroid snapshot directory '{}'", directory_
+    );
+  }
+}
+
+// centroid ids can hold any characters, so file names
+// are their hex encoding.
+string CentroidSnapshotStore::getPath(const string &id) {
+  static const char *hexDigits = "0123456789abcdef";
+  string encoded;
+  encoded.reserve(id.size() * 2);
+  for (unsigned char c : id) {
+    encoded.push_back(hexDigits[c >> 4]);
+    encoded.push_back(hexDigits[c & 0xf]);
+  }
+  return sformat("{}/{}{}", directory_, encoded, kSnapshotSuffix);
+}
+
+bool CentroidSnapshotStore::save(const string &id, Centroid *centroid) {
+  return writeCentroidSnapshot(getPath(id), centroid);
+}
+
+Optional<UniquePointer<Centroid>> CentroidSnapshotStore::loadUniqueOption(
+    const string &id) {
+  return readCentroidSnapshot(getPath(id), id);
+}
+
+void CentroidSnapshotStore::remove(const string &id) {
+  ::unlink(getPath(id).c_str());
+}
+
+void CentroidSnapshotStore::removeAll() {
+  DIR *dir = opendir(directory_.c_str());
+  if (dir == nullptr) {
+    return;
+  }
+  string suffix = kSnapshotSuffix;
+  vector<string> toRemove;
+  while (struct dirent *entry = readdir(dir)) {
+    string name = entry->d_name;
+    if (name.size() > suffix.size()
+        && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+      toRemove.push_back(sformat("{}/{}", directory_, name));
+    }
+  }
+  closedir(dir);
+  for (auto &path : toRemove) {
+    ::unlink(path.c_str());
+  }
+}
+
+} // persistence
+} // relevanced
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <folly/Optional.h>
+
+#include "declarations.h"
+#include "util/util.h"
+
+namespace relevanced {
+namespace persistence {
+
+/**
+ * Flat on-disk copy of a centroid: a fixed header followed by
+ * its weights, the offsets of each term in a term blob, and the
+ * blob itself.  Reading one is a single `read` and a pass over
+ * the arrays, instead of thrift deserialization into a
+ * string-keyed map.
+ *
+ * Terms are stored as strings rather than term ids, since ids
+ * are only meaningful within the process that assigned them;
+ * reading a snapshot interns them again.
+ *
+ * `writeCentroidSnapshot` writes and syncs a temporary file, then
+ * renames it into place and syncs the directory, so neither readers
+ * nor a crash can leave a partial snapshot behind.
+ * `readCentroidSnapshot` comes back empty if the file is missing,
+ * truncated or not a snapshot.
+ */
+bool writeCentroidSnapshot(
+  const std::string &path, models::Centroid *centroid);
+
+folly::Optional<util::UniquePointer<models::Centroid>>
+  readCentroidSnapshot(const std::string &path, const std::string &id);
+
+class CentroidSnapshotStoreIf {
+ public:
+  virtual bool save(const std::string &id, models::Centroid *centroid) = 0;
+
+  virtual folly::Optional<util::UniquePointer<models::Centroid>>
+    loadUniqueOption(const std::string &id) = 0;
+
+  virtual void remove(const std::string &id) = 0;
+  virtual void removeAll() = 0;
+  virtual ~CentroidSnapshotStoreIf() = default;
+};
+
+/**
+ * One snapshot file per centroid under a single directory.
+ *
+ * Snapshots are a cache of what's in RocksDB, never the other
+ * way around: `SyncPersistence` drops a centroid's snapshot
+ * before overwriting the centroid and writes the new one
+ * afterwards, so a snapshot is either current or missing.
+ */
+class CentroidSnapshotStore : public CentroidSnapshotStoreIf {
+ protected:
+  std::string directory_;
+  std::string getPath(const std::string &id);
+
+ public:
+  CentroidSnapshotStore(std::string directory);
+  bool save(const std::string &id, models::Centroid *centroid) override;
+
+  folly::Optional<util::UniquePointer<models::Centroid>>
+    loadUniqueOption(const std::string &id) override;
+
+  void remove(const std::string &id) override;
+  void removeAll() override;
+};
+
+} // persistence
+} // relevanced
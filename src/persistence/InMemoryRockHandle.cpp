@@ -3,7 +3,9 @@
 #include <string>
 #include <functional>
 #include <rocksdb/slice.h>
+#include <rocksdb/write_batch.h>
 #include <folly/Format.h>
+#include <folly/Optional.h>
 #include <folly/Synchronized.h>
 
 using namespace folly;
@@ -42,6 +44,23 @@ bool InMemoryRockHandle::get(const string &key, string &result) {
   return gotten;
 }
 
+vector<Optional<string>> InMemoryRockHandle::multiGet(
+    const vector<string> &keys) {
+  vector<Optional<string>> results;
+  results.reserve(keys.size());
+  SYNCHRONIZED(data_) {
+    for (auto &key: keys) {
+      auto elem = data_.find(key);
+      if (elem == data_.end()) {
+        results.push_back(Optional<string>());
+      } else {
+        results.push_back(elem->second);
+      }
+    }
+  }
+  return results;
+}
+
 bool InMemoryRockHandle::exists(const string &key) {
   bool result = false;
   SYNCHRONIZED(data_) {
@@ -67,6 +86,32 @@ bool InMemoryRockHandle::del(const string &key) {
   return result;
 }
 
+namespace {
+
+// replays a WriteBatch against the already-locked map.
+class MapBatchHandler : public rocksdb::WriteBatch::Handler {
+  map<string, string> &data_;
+ public:
+  MapBatchHandler(map<string, string> &data) : data_(data) {}
+  void Put(const rocksdb::Slice &key, const rocksdb::Slice &val) override {
+    data_[key.ToString()] = val.ToString();
+  }
+  void Delete(const rocksdb::Slice &key) override {
+    data_.erase(key.ToString());
+  }
+};
+
+} // anonymous namespace
+
+bool InMemoryRockHandle::write(rocksdb::WriteBatch &batch, bool) {
+  bool result = false;
+  SYNCHRONIZED(data_) {
+    MapBatchHandler handler(data_);
+    result = batch.Iterate(&handler).ok();
+  }
+  return result;
+}
+
 bool InMemoryRockHandle::iterRange(
     const string &start,
     const string &end,
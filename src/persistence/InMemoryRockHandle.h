@@ -4,7 +4,9 @@
 #include <string>
 #include <functional>
 #include <rocksdb/slice.h>
+#include <rocksdb/write_batch.h>
 #include <folly/Format.h>
+#include <folly/Optional.h>
 #include <folly/Synchronized.h>
 
 namespace relevanced {
@@ -20,8 +22,11 @@ class InMemoryRockHandle : public RockHandleIf {
   bool put(std::string key, rocksdb::Slice) override;
   std::string get(const std::string &key) override;
   bool get(const std::string &key, std::string &result) override;
+  std::vector<folly::Optional<std::string>> multiGet(
+      const std::vector<std::string> &keys) override;
   bool exists(const std::string &key) override;
   bool del(const std::string &key) override;
+  bool write(rocksdb::WriteBatch &batch, bool sync) override;
   bool iterRange(const std::string &start,
                  const std::string &end,
                  std::function<void(const std::string &,
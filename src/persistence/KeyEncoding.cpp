@@ -0,0 +1,174 @@
+#include "persistence/KeyEncoding.h"
+
+#include <cstring>
+#include <string>
+#include <glog/logging.h>
+
+using namespace std;
+
+namespace relevanced {
+namespace persistence {
+
+namespace {
+
+struct OwnedFamily {
+  const char *suffix;
+  size_t suffixLength;
+  KeyFamily family;
+  char tag;
+};
+
+const OwnedFamily kOwnedFamilies[] = {
+  {"__documents", 11, KeyFamily::MAPPINGS, 'D'},
+  {"__centroids", 11, KeyFamily::MAPPINGS, 'C'},
+  {"__document_metadata", 19, KeyFamily::METADATA, 'D'},
+  {"__centroid_metadata", 19, KeyFamily::METADATA, 'C'}
+};
+
+const size_t kOwnerLengthBytes = 4;
+
+bool headIs(const char *head, size_t headLength, const char *name) {
+  size_t nameLength = strlen(name);
+  return headLength == nameLength && memcmp(head, name, nameLength) == 0;
+}
+
+// encodes the part of a key before its ':', leaving room
+// for `extra` more bytes.
+EncodedKey encodeHead(const char *head, size_t headLength, size_t extra) {
+  EncodedKey result;
+  if (headIs(head, headLength, "documents")) {
+    result.family = KeyFamily::DOCUMENTS;
+    result.key.reserve(extra);
+    return result;
+  }
+  if (headIs(head, headLength, "centroids")) {
+    result.family = KeyFamily::CENTROIDS;
+    result.key.reserve(extra);
+    return result;
+  }
+  for (auto &owned : kOwnedFamilies) {
+    if (headLength < owned.suffixLength) {
+      continue;
+    }
+    size_t ownerLength = headLength - owned.suffixLength;
+    if (memcmp(head + ownerLength, owned.suffix, owned.suffixLength) != 0) {
+      continue;
+    }
+    result.family = owned.family;
+    result.key.reserve(1 + kOwnerLengthBytes + ownerLength + extra);
+    result.key.push_back(owned.tag);
+    uint32_t len = (uint32_t) ownerLength;
+    result.key.push_back((char) ((len >> 24) & 0xff));
+    result.key.push_back((char) ((len >> 16) & 0xff));
+    result.key.push_back((char) ((len >> 8) & 0xff));
+    result.key.push_back((char) (len & 0xff));
+    result.key.append(head, ownerLength);
+    return result;
+  }
+  result.family = KeyFamily::DEFAULT;
+  result.key.reserve(headLength + 1 + extra);
+  result.key.append(head, headLength);
+  result.key.push_back(':');
+  return result;
+}
+
+} // anonymous namespace
+
+const char* keyFamilyName(KeyFamily family) {
+  switch (family) {
+    case KeyFamily::DOCUMENTS: return "documents";
+    case KeyFamily::CENTROIDS: return "centroids";
+    case KeyFamily::MAPPINGS: return "mappings";
+    case KeyFamily::METADATA: return "metadata";
+    default: return "default";
+  }
+}
+
+EncodedKey encodeKey(const string &logicalKey) {
+  auto colon = logicalKey.find(':');
+  if (colon == string::npos) {
+    EncodedKey result;
+    result.key = logicalKey;
+    return result;
+  }
+  size_t memberLength = logicalKey.size() - colon - 1;
+  auto result = encodeHead(logicalKey.data(), colon, memberLength);
+  result.key.append(logicalKey.data() + colon + 1, memberLength);
+  return result;
+}
+
+EncodedKey encodeKeyPrefix(const string &prefix) {
+  // a ':' inside the prefix means its keys' heads end earlier,
+  // and none of them can be classified by this prefix.
+  if (prefix.find(':') != string::npos) {
+    EncodedKey result;
+    result.key = prefix + ":";
+    return result;
+  }
+  return encodeHead(prefix.data(), prefix.size(), 0);
+}
+
+size_t encodedOwnerPrefixLength(const char *data, size_t length) {
+  if (length < 1 + kOwnerLengthBytes) {
+    return 0;
+  }
+  const unsigned char *lenBytes = (const unsigned char*) data + 1;
+  size_t ownerLength = (((size_t) lenBytes[0]) << 24)
+    | (((size_t) lenBytes[1]) << 16)
+    | (((size_t) lenBytes[2]) << 8)
+    | ((size_t) lenBytes[3]);
+  size_t prefixLength = 1 + kOwnerLengthBytes + ownerLength;
+  if (prefixLength > length) {
+    return 0;
+  }
+  return prefixLength;
+}
+
+string decodeKey(KeyFamily family, const char *data, size_t length) {
+  string result;
+  switch (family) {
+    case KeyFamily::DOCUMENTS:
+      result.reserve(10 + length);
+      result.append("documents:");
+      result.append(data, length);
+      return result;
+    case KeyFamily::CENTROIDS:
+      result.reserve(10 + length);
+      result.append("centroids:");
+      result.append(data, length);
+      return result;
+    case KeyFamily::MAPPINGS:
+    case KeyFamily::METADATA:
+      break;
+    default:
+      return string(data, length);
+  }
+  size_t prefixLength = encodedOwnerPrefixLength(data, length);
+  DCHECK(prefixLength > 0);
+  if (prefixLength == 0) {
+    return string(data, length);
+  }
+  size_t ownerStart = 1 + kOwnerLengthBytes;
+  size_t ownerLength = prefixLength - ownerStart;
+  const OwnedFamily *owned = nullptr;
+  for (auto &elem : kOwnedFamilies) {
+    if (elem.family == family && elem.tag == data[0]) {
+      owned = &elem;
+      break;
+    }
+  }
+  DCHECK(owned != nullptr);
+  if (owned == nullptr) {
+    return string(data, length);
+  }
+  size_t memberLength = length - ownerStart - ownerLength;
+  result.reserve(ownerLength + owned->suffixLength + 1 + memberLength);
+  result.append(data + ownerStart, ownerLength);
+  result.append(owned->suffix, owned->suffixLength);
+  result.push_back(':');
+  result.append(data + ownerStart + ownerLength, memberLength);
+  return result;
+}
+
+} // persistence
+} // relevanced
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace relevanced {
+namespace persistence {
+
+/**
+ * Physical layout of `SyncPersistence`'s logical keys.
+ *
+ * Callers of `RockHandleIf` keep using the string keys they always
+ * have (`documents:{id}`, `{centroid}__documents:{doc}`, ...).
+ * `RockHandle` routes each one into a column family picked by the
+ * part of the key before its first ':', and stores it there in a
+ * compact form:
+ *
+ *   documents:{id}                 DOCUMENTS  {id}
+ *   centroids:{id}                 CENTROIDS  {id}
+ *   {owner}__documents:{member}    MAPPINGS   'D' len(owner) {owner} {member}
+ *   {owner}__centroids:{member}    MAPPINGS   'C' len(owner) {owner} {member}
+ *   {owner}__document_metadata:{x} METADATA   'D' len(owner) {owner} {x}
+ *   {owner}__centroid_metadata:{x} METADATA   'C' len(owner) {owner} {x}
+ *
+ * where len(owner) is a 4-byte big-endian length.  Anything else is
+ * stored verbatim in the default family.  All keys sharing a logical
+ * prefix share an encoded prefix, so prefix scans stay contiguous,
+ * and the length prefix keeps owners from running into members.
+ */
+enum class KeyFamily : uint8_t {
+  DEFAULT = 0,
+  DOCUMENTS = 1,
+  CENTROIDS = 2,
+  MAPPINGS = 3,
+  METADATA = 4
+};
+
+const size_t kKeyFamilyCount = 5;
+
+// column family name, as stored by RocksDB.
+const char* keyFamilyName(KeyFamily family);
+
+struct EncodedKey {
+  KeyFamily family {KeyFamily::DEFAULT};
+  std::string key;
+};
+
+EncodedKey encodeKey(const std::string &logicalKey);
+
+// the encoding shared by every key `{prefix}:{member}`; appending
+// `member` to the result's key gives that member's encoded key.
+EncodedKey encodeKeyPrefix(const std::string &prefix);
+
+std::string decodeKey(KeyFamily family, const char *data, size_t length);
+
+// length of the tag + owner length + owner prefix of an encoded
+// MAPPINGS or METADATA key, or 0 if `data` is too short to hold one.
+// reads only the first five bytes and never allocates.
+size_t encodedOwnerPrefixLength(const char *data, size_t length);
+
+inline std::string decodeKey(const EncodedKey &encoded) {
+  return decodeKey(encoded.family, encoded.key.data(), encoded.key.size());
+}
+
+} // persistence
+} // relevanced
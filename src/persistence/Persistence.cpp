@@ -96,6 +96,13 @@ Future<Try<shared_ptr<ProcessedDocument>>> Persistence::loadDocument(
   });
 }
 
+Future<vector<Try<shared_ptr<ProcessedDocument>>>> Persistence::loadDocuments(
+    vector<string> ids) {
+  return threadPool_->addFuture([this, ids]() {
+    return syncHandle_->loadDocuments(ids);
+  });
+}
+
 Future<bool> Persistence::doesCentroidExist(string id) {
   return threadPool_->addFuture([this, id]() {
     return syncHandle_->doesCentroidExist(id);
@@ -249,5 +256,26 @@ Future<folly::Unit> Persistence::debugEraseAllData() {
   });
 }
 
+Future<CentroidDocumentChanges> Persistence::takeCentroidDocumentChanges(
+    string centroidId) {
+  return threadPool_->addFuture([this, centroidId]() {
+    return syncHandle_->takeCentroidDocumentChanges(centroidId);
+  });
+}
+
+Future<folly::Unit> Persistence::finishCentroidUpdate(
+    string centroidId, bool succeeded) {
+  return threadPool_->addFuture([this, centroidId, succeeded]() {
+    syncHandle_->finishCentroidUpdate(centroidId, succeeded);
+  });
+}
+
+Future<folly::Unit> Persistence::invalidateCentroidDocumentChanges(
+    string centroidId) {
+  return threadPool_->addFuture([this, centroidId]() {
+    syncHandle_->invalidateCentroidDocumentChanges(centroidId);
+  });
+}
+
 } // persistence
 } // relevanced
@@ -10,6 +10,7 @@
 #include <folly/Optional.h>
 
 #include "declarations.h"
+#include "persistence/CentroidDocumentChanges.h"
 #include "util/util.h"
 
 namespace relevanced {
@@ -46,6 +47,9 @@ class PersistenceIf {
   virtual folly::Future<folly::Try<std::shared_ptr<models::ProcessedDocument>>>
     loadDocument(std::string ) = 0;
 
+  virtual folly::Future<std::vector<folly::Try<std::shared_ptr<models::ProcessedDocument>>>>
+    loadDocuments(std::vector<std::string> ids) = 0;
+
   virtual folly::Future<bool>
     doesCentroidExist(std::string id) = 0;
 
@@ -129,6 +133,15 @@ class PersistenceIf {
   virtual folly::Future<folly::Unit>
     debugEraseAllData() = 0;
 
+  virtual folly::Future<CentroidDocumentChanges>
+    takeCentroidDocumentChanges(std::string) = 0;
+
+  virtual folly::Future<folly::Unit>
+    finishCentroidUpdate(std::string, bool succeeded) = 0;
+
+  virtual folly::Future<folly::Unit>
+    invalidateCentroidDocumentChanges(std::string) = 0;
+
   virtual ~PersistenceIf() = default;
 };
 
@@ -170,6 +183,9 @@ class Persistence : public PersistenceIf {
   folly::Future<folly::Try<std::shared_ptr<models::ProcessedDocument>>>
     loadDocument(std::string ) override;
 
+  folly::Future<std::vector<folly::Try<std::shared_ptr<models::ProcessedDocument>>>>
+    loadDocuments(std::vector<std::string> ids) override;
+
   folly::Future<bool>
     doesCentroidExist(std::string id) override;
 
@@ -253,6 +269,15 @@ class Persistence : public PersistenceIf {
   folly::Future<folly::Unit>
     debugEraseAllData() override;
 
+  folly::Future<CentroidDocumentChanges>
+    takeCentroidDocumentChanges(std::string) override;
+
+  folly::Future<folly::Unit>
+    finishCentroidUpdate(std::string, bool succeeded) override;
+
+  folly::Future<folly::Unit>
+    invalidateCentroidDocumentChanges(std::string) override;
+
 };
 
 
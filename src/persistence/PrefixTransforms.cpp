@@ -0,0 +1,69 @@
+#include <cassert>
+#include <cstring>
+#include <rocksdb/slice.h>
+#include <rocksdb/slice_transform.h>
+
+#include "persistence/KeyEncoding.h"
+#include "persistence/PrefixTransforms.h"
+
+using rocksdb::Slice;
+
+namespace relevanced {
+namespace persistence {
+
+namespace {
+
+const char* findColon(const Slice &src) {
+  return (const char*) memchr(src.data(), ':', src.size());
+}
+
+} // anonymous namespace
+
+const char* ColonPrefixTransform::Name() const {
+  return "ColonPrefixTransform";
+}
+
+Slice ColonPrefixTransform::Transform(const Slice &src) const {
+  auto colon = findColon(src);
+  assert(colon != nullptr);
+  return Slice(src.data(), (colon - src.data()) + 1);
+}
+
+bool ColonPrefixTransform::InDomain(const Slice &src) const {
+  return findColon(src) != nullptr;
+}
+
+bool ColonPrefixTransform::InRange(const Slice &dst) const {
+  auto colon = findColon(dst);
+  return colon != nullptr && colon == dst.data() + dst.size() - 1;
+}
+
+bool ColonPrefixTransform::SameResultWhenAppended(const Slice &prefix) const {
+  return InRange(prefix);
+}
+
+const char* OwnerPrefixTransform::Name() const {
+  return "OwnerPrefixTransform";
+}
+
+Slice OwnerPrefixTransform::Transform(const Slice &src) const {
+  auto prefixLength = encodedOwnerPrefixLength(src.data(), src.size());
+  assert(prefixLength > 0);
+  return Slice(src.data(), prefixLength);
+}
+
+bool OwnerPrefixTransform::InDomain(const Slice &src) const {
+  return encodedOwnerPrefixLength(src.data(), src.size()) > 0;
+}
+
+bool OwnerPrefixTransform::InRange(const Slice &dst) const {
+  return dst.size() > 0 &&
+    encodedOwnerPrefixLength(dst.data(), dst.size()) == dst.size();
+}
+
+bool OwnerPrefixTransform::SameResultWhenAppended(const Slice &prefix) const {
+  return InRange(prefix);
+}
+
+} // persistence
+} // relevanced
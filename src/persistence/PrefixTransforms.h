@@ -0,0 +1,33 @@
+#pragma once
+#include <rocksdb/slice.h>
+#include <rocksdb/slice_transform.h>
+
+namespace relevanced {
+namespace persistence {
+
+// prefix extractors for `RockHandle`'s column families.  they run on
+// every write, read and compaction, so they work on the slice in place.
+
+// default family: everything up to and including the first ':'.
+class ColonPrefixTransform : public rocksdb::SliceTransform {
+ public:
+  const char *Name() const override;
+  rocksdb::Slice Transform(const rocksdb::Slice &src) const override;
+  bool InDomain(const rocksdb::Slice &src) const override;
+  bool InRange(const rocksdb::Slice &dst) const override;
+  bool SameResultWhenAppended(const rocksdb::Slice &prefix) const override;
+};
+
+// mappings and metadata: the tag, owner length and owner
+// (see `encodedOwnerPrefixLength`).
+class OwnerPrefixTransform : public rocksdb::SliceTransform {
+ public:
+  const char *Name() const override;
+  rocksdb::Slice Transform(const rocksdb::Slice &src) const override;
+  bool InDomain(const rocksdb::Slice &src) const override;
+  bool InRange(const rocksdb::Slice &dst) const override;
+  bool SameResultWhenAppended(const rocksdb::Slice &prefix) const override;
+};
+
+} // persistence
+} // relevanced
@@ -1,5 +1,6 @@
 
 #include <cassert>
+#include <cstring>
 #include <vector>
 #include <memory>
 #include <string>
@@ -9,15 +10,16 @@
 #include <rocksdb/db.h>
 #include <rocksdb/slice.h>
 #include <rocksdb/options.h>
+#include <rocksdb/write_batch.h>
 #include <rocksdb/table.h>
 #include <rocksdb/cache.h>
-#include <rocksdb/slice_transform.h>
 #include <rocksdb/filter_policy.h>
 #include <rocksdb/utilities/optimistic_transaction.h>
 #include <rocksdb/utilities/optimistic_transaction_db.h>
 #include <folly/Format.h>
 #include <folly/ScopeGuard.h>
 
+#include "persistence/PrefixTransforms.h"
 #include "persistence/RockHandle.h"
 
 using namespace std;
@@ -27,51 +29,113 @@ using namespace rocksdb;
 namespace relevanced {
 namespace persistence {
 
-class ColonPrefixTransform : public rocksdb::SliceTransform {
+namespace {
+
+bool hasPrefix(const rocksdb::Slice &key, const string &prefix) {
+  return key.size() >= prefix.size() &&
+    memcmp(key.data(), prefix.data(), prefix.size()) == 0;
+}
+
+// re-issues a batch of logical keys against their column families.
+class FamilyRoutingHandler : public rocksdb::WriteBatch::Handler {
+  rocksdb::WriteBatch &target_;
+  function<rocksdb::ColumnFamilyHandle*(KeyFamily)> getFamily_;
  public:
-  const char *Name() const override { return "ColonPrefixTransform"; }
-  rocksdb::Slice Transform(const Slice &src) const override {
-    assert(InDomain(src));
-    auto str = src.ToString();
-    return rocksdb::Slice(src.data(), str.find(':') + 1);
-  }
-  bool InDomain(const Slice &src) const override {
-    auto str = src.ToString();
-    return str.find(':') != string::npos;
-  }
-  bool InRange(const Slice &dst) const override {
-    auto str = dst.ToString();
-    return str.find(':') == (str.size() - 1);
-  }
-  bool SameResultWhenAppended(const Slice &prefix) const override {
-    if (prefix[prefix.size() - 1] == ':') {
-      return true;
-    }
-    return false;
+  FamilyRoutingHandler(rocksdb::WriteBatch &target,
+      function<rocksdb::ColumnFamilyHandle*(KeyFamily)> getFamily)
+    : target_(target), getFamily_(getFamily) {}
+  void Put(const rocksdb::Slice &key, const rocksdb::Slice &val) override {
+    auto encoded = encodeKey(key.ToString());
+    target_.Put(getFamily_(encoded.family), encoded.key, val);
+  }
+  void Delete(const rocksdb::Slice &key) override {
+    auto encoded = encodeKey(key.ToString());
+    target_.Delete(getFamily_(encoded.family), encoded.key);
   }
 };
 
+} // anonymous namespace
+
 RockHandle::RockHandle(string dbPath) : dbPath_(dbPath) {
-  options_.env->SetBackgroundThreads(4);
-  options_.create_if_missing = true;
-  options_.write_buffer_size = 1024 * 1024 * 32;
-  options_.max_write_buffer_number = 5;
-  options_.min_write_buffer_number_to_merge = 2;
-  options_.max_bytes_for_level_base = 1024 * 1024 * 64;
-  options_.max_bytes_for_level_multiplier = 8;
-  options_.target_file_size_base = options_.max_bytes_for_level_base / 10;
-  options_.num_levels = 5;
-  struct BlockBasedTableOptions table_options;
+  // one block cache shared by every column family.
   size_t cacheCapacity = 1024 * 1024 * 64;
   size_t cacheShardBits = 4;
+  blockCache_ = rocksdb::NewLRUCache(cacheCapacity, cacheShardBits);
+  DBOptions dbOptions;
+  dbOptions.create_if_missing = true;
+  dbOptions.create_missing_column_families = true;
+  options_ = rocksdb::Options(dbOptions, getFamilyOptions(KeyFamily::DEFAULT));
+  options_.env->SetBackgroundThreads(4);
+
+  // scans that aren't confined to one prefix have to opt out
+  // of prefix seeking.
+  totalOrderReadOptions_.total_order_seek = true;
+  openDb();
+}
+
+RockHandle::~RockHandle() {
+  closeDb();
+}
+
+ColumnFamilyOptions RockHandle::getFamilyOptions(KeyFamily family) {
+  ColumnFamilyOptions familyOptions;
+  familyOptions.write_buffer_size = 1024 * 1024 * 32;
+  familyOptions.max_write_buffer_number = 5;
+  familyOptions.min_write_buffer_number_to_merge = 2;
+  familyOptions.max_bytes_for_level_base = 1024 * 1024 * 64;
+  familyOptions.max_bytes_for_level_multiplier = 8;
+  familyOptions.target_file_size_base =
+    familyOptions.max_bytes_for_level_base / 10;
+  familyOptions.num_levels = 5;
+  struct BlockBasedTableOptions table_options;
   table_options.cache_index_and_filter_blocks = true;
-  table_options.block_cache = rocksdb::NewLRUCache(cacheCapacity, cacheShardBits);
+  table_options.block_cache = blockCache_;
   table_options.block_size = 1024 * 8;
-  options_.table_factory.reset(NewBlockBasedTableFactory(table_options));
-  openDb();
+
+  // full (not per-block) bloom filters over whole keys, plus over
+  // prefixes where the family has an extractor: a negative exists
+  // check or an empty prefix scan is answered from the cached
+  // filter without reading data blocks.
+  table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(10, false));
+  table_options.whole_key_filtering = true;
+
+  switch (family) {
+    case KeyFamily::DOCUMENTS:
+    case KeyFamily::CENTROIDS:
+      // values are whole serialized documents and centroids,
+      // read one at a time: bigger blocks compress better and
+      // keep the index small.
+      table_options.block_size = 1024 * 32;
+      break;
+    case KeyFamily::MAPPINGS:
+    case KeyFamily::METADATA:
+      // tiny values under long shared key prefixes, which the
+      // block format already delta-encodes; small uncompressed
+      // blocks keep point lookups and short scans cheap.
+      table_options.block_size = 1024 * 4;
+      familyOptions.compression = rocksdb::kNoCompression;
+      familyOptions.write_buffer_size = 1024 * 1024 * 16;
+      familyOptions.prefix_extractor.reset(new OwnerPrefixTransform);
+      break;
+    default:
+      familyOptions.prefix_extractor.reset(new ColonPrefixTransform);
+      break;
+  }
+  familyOptions.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  return familyOptions;
+}
+
+ColumnFamilyHandle* RockHandle::getFamily(KeyFamily family) {
+  size_t idx = (size_t) family;
+  DCHECK(idx < families_.size());
+  return families_[idx];
 }
 
 void RockHandle::closeDb() {
+  for (auto handle : families_) {
+    delete handle;
+  }
+  families_.clear();
   auto db = db_.release();
   if (db != nullptr) {
     delete db;
@@ -80,34 +144,121 @@ void RockHandle::closeDb() {
 
 void RockHandle::openDb() {
   CHECK(db_.get() == nullptr);
+  vector<ColumnFamilyDescriptor> descriptors;
+  for (size_t i = 0; i < kKeyFamilyCount; i++) {
+    auto family = (KeyFamily) i;
+    string name = keyFamilyName(family);
+    if (family == KeyFamily::DEFAULT) {
+      name = rocksdb::kDefaultColumnFamilyName;
+    }
+    descriptors.emplace_back(name, getFamilyOptions(family));
+  }
   rocksdb::DB *dbPtr = nullptr;
   auto status = rocksdb::DB::Open(
-      options_, dbPath_.c_str(), &dbPtr);
+      options_, dbPath_.c_str(), descriptors, &families_, &dbPtr);
   CHECK(status.ok());
   CHECK(dbPtr != nullptr);
+  CHECK(families_.size() == kKeyFamilyCount);
   db_.reset(dbPtr);
+  auto migrated = migrateLegacyKeys();
+  if (migrated > 0) {
+    LOG(INFO) << format(
+      "moved {} legacy keys out of the default column family", migrated);
+  }
+}
+
+size_t RockHandle::migrateLegacyKeys() {
+  const size_t batchSize = 1000;
+  auto defaultFamily = getFamily(KeyFamily::DEFAULT);
+  rocksdb::Iterator *it = db_->NewIterator(
+    totalOrderReadOptions_, defaultFamily);
+  ScopeGuard guard = makeGuard([it]() { delete it; });
+  (void) guard;
+  size_t migrated = 0;
+  rocksdb::WriteBatch batch;
+  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    auto key = it->key().ToString();
+    auto encoded = encodeKey(key);
+    if (encoded.family == KeyFamily::DEFAULT) {
+      continue;
+    }
+    batch.Put(getFamily(encoded.family), encoded.key, it->value());
+    batch.Delete(defaultFamily, key);
+    migrated++;
+    if (migrated % batchSize == 0) {
+      CHECK(db_->Write(writeOptions_, &batch).ok());
+      batch.Clear();
+    }
+  }
+  if (migrated % batchSize != 0) {
+    CHECK(db_->Write(writeOptions_, &batch).ok());
+  }
+  return migrated;
 }
 
 bool RockHandle::put(string key, rocksdb::Slice val) {
-  auto status = db_->Put(writeOptions_, key, val);
+  auto encoded = encodeKey(key);
+  auto status = db_->Put(
+    writeOptions_, getFamily(encoded.family), encoded.key, val);
   return status.ok();
 }
 
 string RockHandle::get(const string &key) {
   string val;
-  auto status = db_->Get(readOptions_, key, &val);
+  auto encoded = encodeKey(key);
+  auto status = db_->Get(
+    readOptions_, getFamily(encoded.family), encoded.key, &val);
   CHECK(status.ok());
   return val;
 }
 
 bool RockHandle::get(const string &key, string &result) {
-  auto status = db_->Get(readOptions_, key, &result);
+  auto encoded = encodeKey(key);
+  auto status = db_->Get(
+    readOptions_, getFamily(encoded.family), encoded.key, &result);
   return status.ok();
 }
 
+vector<Optional<string>> RockHandle::multiGet(const vector<string> &keys) {
+  vector<ColumnFamilyHandle*> keyFamilies;
+  vector<string> encodedKeys;
+  keyFamilies.reserve(keys.size());
+  encodedKeys.reserve(keys.size());
+  for (auto &key: keys) {
+    auto encoded = encodeKey(key);
+    keyFamilies.push_back(getFamily(encoded.family));
+    encodedKeys.push_back(std::move(encoded.key));
+  }
+  vector<rocksdb::Slice> keySlices;
+  keySlices.reserve(keys.size());
+  for (auto &key: encodedKeys) {
+    keySlices.emplace_back(key);
+  }
+  vector<string> values;
+  auto statuses = db_->MultiGet(readOptions_, keyFamilies, keySlices, &values);
+  vector<Optional<string>> results;
+  results.reserve(keys.size());
+  for (size_t i = 0; i < statuses.size(); i++) {
+    if (statuses[i].ok()) {
+      results.push_back(std::move(values[i]));
+    } else {
+      // only a missing key is an expected result; like `get()`,
+      // any other failure (IO error, corruption) is fatal rather
+      // than being mistaken for a missing key.
+      CHECK(statuses[i].IsNotFound()) << format(
+        "multiGet failed for key '{}': {}", keys[i], statuses[i].ToString()
+      );
+      results.push_back(Optional<string>());
+    }
+  }
+  return results;
+}
+
 bool RockHandle::exists(const string &key) {
   string val;
-  auto status = db_->Get(readOptions_, key, &val);
+  auto encoded = encodeKey(key);
+  auto status = db_->Get(
+    readOptions_, getFamily(encoded.family), encoded.key, &val);
   return !status.IsNotFound();
 }
 
@@ -115,16 +266,36 @@ bool RockHandle::del(const string &key) {
   if (!exists(key)) {
     return false;
   }
-  auto status = db_->Delete(writeOptions_, key);
+  auto encoded = encodeKey(key);
+  auto status = db_->Delete(
+    writeOptions_, getFamily(encoded.family), encoded.key);
   return true;
 }
 
-bool RockHandle::iterRange(
+bool RockHandle::write(rocksdb::WriteBatch &batch, bool sync) {
+  rocksdb::WriteBatch routed;
+  FamilyRoutingHandler handler(routed, [this](KeyFamily family) {
+    return getFamily(family);
+  });
+  if (!batch.Iterate(&handler).ok()) {
+    return false;
+  }
+  if (!sync) {
+    return db_->Write(writeOptions_, &routed).ok();
+  }
+  rocksdb::WriteOptions syncOptions = writeOptions_;
+  syncOptions.sync = true;
+  return db_->Write(syncOptions, &routed).ok();
+}
+
+bool RockHandle::iterEncoded(
+    const rocksdb::ReadOptions &iterOptions,
+    KeyFamily family,
     const string &start,
-    const string &end,
+    function<bool (const rocksdb::Slice&)> inRange,
     function<void(const string &, function<void(string &) >, function<void()>) >
         iterFn) {
-  rocksdb::Iterator *it = db_->NewIterator(readOptions_);
+  rocksdb::Iterator *it = db_->NewIterator(iterOptions, getFamily(family));
   ScopeGuard guard = makeGuard([it]() { delete it; });
   (void) guard;
   bool foundAny = false;
@@ -132,9 +303,10 @@ bool RockHandle::iterRange(
   function<void()> escapeFunc([&stop]() { stop = true; });
   function<void(string &) > readValFunc(
       [&it](string &result) { result = it->value().ToString(); });
-  for (it->Seek(start); it->Valid() && it->key().ToString() < end; it->Next()) {
+  for (it->Seek(start); it->Valid() && inRange(it->key()); it->Next()) {
     foundAny = true;
-    iterFn(it->key().ToString(), readValFunc, escapeFunc);
+    auto key = it->key();
+    iterFn(decodeKey(family, key.data(), key.size()), readValFunc, escapeFunc);
     if (stop) {
       break;
     }
@@ -142,13 +314,38 @@ bool RockHandle::iterRange(
   return foundAny;
 }
 
+bool RockHandle::iterRange(
+    const string &start,
+    const string &end,
+    function<void(const string &, function<void(string &) >, function<void()>) >
+        iterFn) {
+  // ranges never span column families: one that ends in
+  // another family runs to the end of its own.
+  auto encodedStart = encodeKey(start);
+  auto encodedEnd = encodeKey(end);
+  if (encodedEnd.family != encodedStart.family) {
+    return iterEncoded(totalOrderReadOptions_,
+      encodedStart.family, encodedStart.key,
+      [](const rocksdb::Slice&) { return true; }, iterFn);
+  }
+  rocksdb::Slice endSlice(encodedEnd.key);
+  return iterEncoded(totalOrderReadOptions_,
+    encodedStart.family, encodedStart.key,
+    [&endSlice](const rocksdb::Slice &key) {
+      return key.compare(endSlice) < 0;
+    }, iterFn);
+}
+
 bool RockHandle::iterPrefix(
     const string &prefix,
     function<void(const string &, function<void(string &) >, function<void()>) >
         iterFn) {
-  string start = prefix + ":";
-  string end = prefix + ";";
-  return iterRange(start, end, iterFn);
+  auto encoded = encodeKeyPrefix(prefix);
+  auto &encodedPrefix = encoded.key;
+  return iterEncoded(readOptions_, encoded.family, encodedPrefix,
+    [&encodedPrefix](const rocksdb::Slice &key) {
+      return hasPrefix(key, encodedPrefix);
+    }, iterFn);
 }
 
 bool RockHandle::iterPrefixFromOffset(
@@ -157,12 +354,10 @@ bool RockHandle::iterPrefixFromOffset(
     size_t limitCount,
     function<void(const string &, function<void(string &) >, function<void()>) >
         iterFn) {
-  string start = prefix + ":";
-  string end = prefix + ";";
   size_t offsetSeen = 0;
   size_t limitSeen = 0;
   bool anySeen = false;
-  iterRange(start, end,
+  iterPrefix(prefix,
             [&anySeen, &offsetSeen, &limitSeen, offset, limitCount, &iterFn](
                 const string &key, function<void(string &) > read,
                 function<void()> escape) {
@@ -187,29 +382,46 @@ bool RockHandle::iterPrefixFromMember(
     size_t limitCount,
     function<void(const string &, function<void(string &) >, function<void()>) >
         iterFn) {
-  string start = sformat("{}:{}", prefix, member);
-  string end = prefix + ";";
+  auto encoded = encodeKeyPrefix(prefix);
+  auto &encodedPrefix = encoded.key;
+  string start = encodedPrefix + member;
   size_t limitSeen = 0;
   bool anySeen = false;
-  iterRange(start, end, [&anySeen, &limitSeen, limitCount, &iterFn](
-                            const string &key, function<void(string &) > read,
-                            function<void()> escape) {
-    anySeen = true;
-    limitSeen++;
-    if (limitSeen > limitCount) {
-      escape();
-      return;
-    }
-    iterFn(key, read, escape);
-  });
+  iterEncoded(readOptions_, encoded.family, start,
+    [&encodedPrefix](const rocksdb::Slice &key) {
+      return hasPrefix(key, encodedPrefix);
+    },
+    [&anySeen, &limitSeen, limitCount, &iterFn](
+        const string &key, function<void(string &) > read,
+        function<void()> escape) {
+      anySeen = true;
+      limitSeen++;
+      if (limitSeen > limitCount) {
+        escape();
+        return;
+      }
+      iterFn(key, read, escape);
+    });
   return anySeen;
 }
 
 bool RockHandle::iterAll(function<void(
     const string &, function<void(string &) >, function<void()>) > iterFn) {
-  string start = "a";
-  string end = "zzz";
-  return iterRange(start, end, iterFn);
+  bool foundAny = false;
+  bool stop = false;
+  for (size_t i = 0; i < kKeyFamilyCount && !stop; i++) {
+    bool found = iterEncoded(totalOrderReadOptions_, (KeyFamily) i, "",
+      [](const rocksdb::Slice&) { return true; },
+      [&stop, &iterFn](const string &key, function<void(string &) > read,
+          function<void()> escape) {
+        iterFn(key, read, [&stop, &escape]() {
+          stop = true;
+          escape();
+        });
+      });
+    foundAny = foundAny || found;
+  }
+  return foundAny;
 }
 
 // this method is only meant for testing purposes.
@@ -9,9 +9,14 @@
 #include <rocksdb/db.h>
 #include <rocksdb/slice.h>
 #include <rocksdb/options.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/write_batch.h>
 #include <rocksdb/utilities/optimistic_transaction.h>
 #include <rocksdb/utilities/optimistic_transaction_db.h>
 #include <folly/Format.h>
+#include <folly/Optional.h>
+
+#include "persistence/KeyEncoding.h"
 
 namespace {
 using namespace std;
@@ -36,10 +41,22 @@ class RockHandleIf {
       std::string &result
     ) = 0;
 
+  // one lookup per key, in the same order as `keys`;
+  // missing keys come back as an empty Optional.  Any other
+  // read error is fatal, as it is for `get()`.
+  virtual std::vector<folly::Optional<std::string>> multiGet(
+      const std::vector<std::string> &keys
+    ) = 0;
+
   virtual bool exists(const std::string &key) = 0;
 
   virtual bool del(const std::string &key) = 0;
 
+  // applies every put and delete in `batch` atomically.
+  // `sync` forces the write-ahead log to disk before returning;
+  // `SyncPersistence` uses it for centroid membership changes.
+  virtual bool write(rocksdb::WriteBatch &batch, bool sync) = 0;
+
   virtual bool iterRange(
     const std::string &start,
     const std::string &end,
@@ -90,15 +107,35 @@ class RockHandle : public RockHandleIf {
  protected:
   rocksdb::Options options_;
   rocksdb::ReadOptions readOptions_;
+  rocksdb::ReadOptions totalOrderReadOptions_;
   rocksdb::WriteOptions writeOptions_;
+  std::shared_ptr<rocksdb::Cache> blockCache_;
   const std::string dbPath_;
-  // std::unique_ptr<rocksdb::OptimisticTransactionDB> txnDb_;
   std::unique_ptr<rocksdb::DB> db_;
-  // rocksdb::DB *db_;
+
+  // indexed by KeyFamily; owned by `db_`, but released
+  // before it in closeDb().
+  std::vector<rocksdb::ColumnFamilyHandle*> families_;
   void openDb();
   void closeDb();
+  rocksdb::ColumnFamilyOptions getFamilyOptions(KeyFamily family);
+  rocksdb::ColumnFamilyHandle* getFamily(KeyFamily family);
+  bool iterEncoded(
+    const rocksdb::ReadOptions &iterOptions,
+    KeyFamily family,
+    const std::string &start,
+    std::function<bool (const rocksdb::Slice&)> inRange,
+    std::function<void(const std::string &,
+       std::function<void(std::string &) >,
+       std::function<void()>) > iterFn
+  );
  public:
   RockHandle(std::string dbPath);
+  ~RockHandle();
+
+  // moves keys written by versions without column families
+  // out of the default family.  returns the number moved.
+  size_t migrateLegacyKeys();
 
   bool put(
       std::string key,
@@ -112,8 +149,13 @@ class RockHandle : public RockHandleIf {
       std::string &result
     ) override;
 
+  std::vector<folly::Optional<std::string>> multiGet(
+      const std::vector<std::string> &keys
+    ) override;
+
   bool exists(const std::string &key) override;
   bool del(const std::string &key) override;
+  bool write(rocksdb::WriteBatch &batch, bool sync) override;
 
   bool iterRange(
     const std::string &start,
@@ -2,7 +2,13 @@
 #include "persistence/SyncPersistence.h"
 
 
+#include <algorithm>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -15,11 +21,13 @@
 #include <folly/futures/Try.h>
 #include <folly/Optional.h>
 #include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
 
 #include "models/Centroid.h"
 #include "models/ProcessedDocument.h"
 #include "models/WordVector.h"
 #include "gen-cpp2/RelevancedProtocol_types.h"
+#include "persistence/CentroidDocumentChanges.h"
 #include "persistence/RockHandle.h"
 #include "serialization/serializers.h"
 #include "util/util.h"
@@ -43,6 +51,14 @@ SyncPersistence::SyncPersistence(
   UniquePointer<RockHandleIf> rockHandle
 ) : clock_(clockPtr), rockHandle_(std::move(rockHandle)) {}
 
+SyncPersistence::SyncPersistence(
+  shared_ptr<ClockIf> clockPtr,
+  UniquePointer<RockHandleIf> rockHandle,
+  shared_ptr<CentroidSnapshotStoreIf> snapshotStore
+) : clock_(clockPtr),
+    rockHandle_(std::move(rockHandle)),
+    snapshotStore_(snapshotStore) {}
+
 
 string SyncPersistence::getCentroidsPrefix() {
   return "centroids";
@@ -74,6 +90,21 @@ string SyncPersistence::getDocumentKey(
 }
 
 
+string SyncPersistence::getUnusedDocumentsPrefix() {
+  return "unused_documents";
+}
+
+
+string SyncPersistence::getUnusedDocumentKey(const string &docId) {
+  return sformat("unused_documents:{}", docId);
+}
+
+
+string SyncPersistence::getUnusedDocumentIndexKey() {
+  return "unused_documents_index:version";
+}
+
+
 string SyncPersistence::getCentroidDocumentPrefix(
     const string &id) {
   return sformat("{}__documents", id);
@@ -126,25 +157,12 @@ Optional<int64_t> SyncPersistence::getDocumentCreatedTime(
 
 
 void SyncPersistence::setDocumentCreatedTime(
-    const string &id, int64_t created) {
+    rocksdb::WriteBatch &batch, const string &id, int64_t created) {
   auto key = getDocumentMetadataKey(id, "created_time");
   string data = folly::to<string>(created);
-  rockHandle_->put(key, data);
-}
-
-bool SyncPersistence::isDocumentInAnyCentroid(
-    const string &documentId) {
-  bool iterated = rockHandle_->iterPrefix(
-    getDocumentCentroidsPrefix(documentId),
-    [](const string&,
-        function<void (string&)>,
-        function<void()> escape) {
-      escape();
-    });
-  return iterated;
+  batch.Put(key, data);
 }
 
-
 vector<string> SyncPersistence::listDocumentCentroids(
     const string &documentId) {
   vector<string> centroids;
@@ -161,6 +179,34 @@ vector<string> SyncPersistence::listDocumentCentroids(
 }
 
 
+size_t SyncPersistence::getDocumentLockIndex(const string &documentId) {
+  return std::hash<string>()(documentId) % kDocumentLockStripes;
+}
+
+
+std::mutex& SyncPersistence::getDocumentLock(const string &documentId) {
+  return documentLocks_[getDocumentLockIndex(documentId)];
+}
+
+
+std::mutex& SyncPersistence::getSnapshotLock(const string &centroidId) {
+  size_t idx = std::hash<string>()(centroidId) % kSnapshotLockStripes;
+  return snapshotLocks_[idx];
+}
+
+
+Try<bool> SyncPersistence::writeBatch(
+    rocksdb::WriteBatch &batch, bool sync) {
+  if (!rockHandle_->write(batch, sync)) {
+    LOG(ERROR) << "RocksDB write failed";
+    return Try<bool>(
+      make_exception_wrapper<std::runtime_error>("RocksDB write failed")
+    );
+  }
+  return Try<bool>(true);
+}
+
+
 bool SyncPersistence::doesDocumentExist(const string &id) {
   auto key = SyncPersistence::getDocumentKey(id);
   return rockHandle_->exists(key);
@@ -185,10 +231,27 @@ Try<bool> SyncPersistence::saveNewDocument(
 Try<bool> SyncPersistence::saveDocument(ProcessedDocument *doc) {
   string data;
   serialization::binarySerialize(data, *doc);
-  rockHandle_->put(
-    SyncPersistence::getDocumentKey(doc->id), data
-  );
-  setDocumentCreatedTime(doc->id, doc->created);
+  vector<string> centroidIds;
+  {
+    std::lock_guard<std::mutex> docGuard(getDocumentLock(doc->id));
+    centroidIds = listDocumentCentroids(doc->id);
+    rocksdb::WriteBatch batch;
+    batch.Put(SyncPersistence::getDocumentKey(doc->id), data);
+    setDocumentCreatedTime(batch, doc->id, doc->created);
+    if (centroidIds.empty()) {
+      markDocumentUnused(batch, doc->id, doc->created);
+    }
+    auto written = writeBatch(batch, false);
+    if (written.hasException()) {
+      return written;
+    }
+  }
+
+  // any centroid this document already contributed to
+  // was computed from its previous contents.  An update that
+  // starts before this runs is followed by a full rebuild.
+  std::lock_guard<std::mutex> guard(journalMutex_);
+  invalidateJournalsForDocument(doc->id, centroidIds);
   return Try<bool>(true);
 }
 
@@ -200,87 +263,213 @@ Try<bool> SyncPersistence::saveDocument(
 
 
 Try<bool> SyncPersistence::deleteDocument(const string &id) {
+  vector<string> centroidIds;
+  auto deleted = deleteDocumentKeys(id, false, centroidIds);
+  if (deleted.hasException()) {
+    return deleted;
+  }
+
+  // centroids still holding this document can no longer
+  // subtract it out.
+  std::lock_guard<std::mutex> guard(journalMutex_);
+  invalidateJournalsForDocument(id, centroidIds);
+  return deleted;
+}
+
+
+Try<bool> SyncPersistence::deleteDocumentKeys(const string &id,
+    bool onlyIfUnused, vector<string> &centroidIds) {
+  std::lock_guard<std::mutex> docGuard(getDocumentLock(id));
   auto mainKey = SyncPersistence::getDocumentKey(id);
-  if (rockHandle_->del(mainKey)) {
-    rockHandle_->iterPrefix(
-      SyncPersistence::getDocumentCentroidsPrefix(id),
-      [this](const string &key,
-          function<void(string&)>,
-          function<void()>) {
-        rockHandle_->del(key);
-      });
-    rockHandle_->iterPrefix(
-      sformat("{}__document_metadata", id),
-      [this](const string &key,
-          function<void(string&)>,
-          function<void()>) {
-        rockHandle_->del(key);
-      });
-    return Try<bool>(true);
+  if (!rockHandle_->exists(mainKey)) {
+    return Try<bool>(
+      make_exception_wrapper<EDocumentDoesNotExist>()
+    );
+  }
+  if (onlyIfUnused
+      && !rockHandle_->exists(SyncPersistence::getUnusedDocumentKey(id))) {
+    return Try<bool>(false);
+  }
+  centroidIds = listDocumentCentroids(id);
+  rocksdb::WriteBatch batch;
+  batch.Delete(mainKey);
+  batch.Delete(SyncPersistence::getUnusedDocumentKey(id));
+  rockHandle_->iterPrefix(
+    SyncPersistence::getDocumentCentroidsPrefix(id),
+    [&batch](const string &key,
+        function<void(string&)>,
+        function<void()>) {
+      batch.Delete(key);
+    });
+  rockHandle_->iterPrefix(
+    sformat("{}__document_metadata", id),
+    [&batch](const string &key,
+        function<void(string&)>,
+        function<void()>) {
+      batch.Delete(key);
+    });
+  auto written = writeBatch(batch, false);
+  if (written.hasException()) {
+    return written;
+  }
+  return Try<bool>(true);
+}
+
+
+void SyncPersistence::markDocumentUnused(
+    rocksdb::WriteBatch &batch, const string &id, int64_t created) {
+  batch.Put(
+    SyncPersistence::getUnusedDocumentKey(id),
+    folly::to<string>(created)
+  );
+}
+
+
+void SyncPersistence::releaseDocumentFromCentroid(
+    rocksdb::WriteBatch &batch,
+    const string &documentId,
+    const string &centroidId) {
+  batch.Delete(
+    SyncPersistence::getDocumentCentroidKey(documentId, centroidId)
+  );
+  if (!doesDocumentExist(documentId)) {
+    return;
   }
-  return Try<bool>(
-    make_exception_wrapper<EDocumentDoesNotExist>()
+  for (auto &otherId : listDocumentCentroids(documentId)) {
+    if (otherId != centroidId) {
+      return;
+    }
+  }
+  auto createdTime = getDocumentCreatedTime(documentId);
+  markDocumentUnused(
+    batch, documentId, createdTime.hasValue() ? createdTime.value() : 0
   );
 }
 
 
-vector<string> SyncPersistence::listUnusedDocuments(
-    size_t limit = 0) {
-  vector<string> docIds;
-  size_t numSeen = 0;
+Try<size_t> SyncPersistence::buildUnusedDocumentIndex() {
+  auto indexKey = SyncPersistence::getUnusedDocumentIndexKey();
+  if (rockHandle_->exists(indexKey)) {
+    return Try<size_t>(0);
+  }
+  const size_t batchSize = 1000;
+  size_t numIndexed = 0;
+  size_t numStale = 0;
+  size_t numPending = 0;
+  Try<bool> written(true);
+  rocksdb::WriteBatch batch;
   rockHandle_->iterPrefix(
     SyncPersistence::getDocumentsPrefix(),
-    [this, &docIds, &numSeen, limit]
+    [this, &batch, &written, &numIndexed, &numStale, &numPending, batchSize]
     (const string &key,
         function<void(string &)>,
         function<void()> escape) {
       auto offset = key.find(':');
       DCHECK(offset != string::npos);
       auto id = key.substr(offset + 1);
-      if (!isDocumentInAnyCentroid(id)) {
-        docIds.push_back(id);
-        if (limit > 0) {
-          numSeen++;
-          if (numSeen >= limit) {
-            escape();
-          }
+      bool used = false;
+      for (auto &centroidId : listDocumentCentroids(id)) {
+        if (doesCentroidExist(centroidId)) {
+          used = true;
+        } else {
+          // left behind by a `deleteCentroid` that didn't
+          // clean up its members' reverse links.
+          batch.Delete(
+            SyncPersistence::getDocumentCentroidKey(id, centroidId)
+          );
+          numStale++;
+          numPending++;
+        }
+      }
+      if (!used) {
+        auto createdTime = getDocumentCreatedTime(id);
+        markDocumentUnused(
+          batch, id, createdTime.hasValue() ? createdTime.value() : 0
+        );
+        numIndexed++;
+        numPending++;
+      }
+      if (numPending >= batchSize) {
+        written = writeBatch(batch, false);
+        batch.Clear();
+        numPending = 0;
+        if (written.hasException()) {
+          escape();
         }
       }
     });
+  if (written.hasException()) {
+    return Try<size_t>(written.exception());
+  }
+
+  // only marked as built once every entry is written.
+  batch.Put(indexKey, "1");
+  written = writeBatch(batch, false);
+  if (written.hasException()) {
+    return Try<size_t>(written.exception());
+  }
+  LOG(INFO) << format(
+    "built unused document index: {} unused documents, "
+    "{} stale centroid links removed", numIndexed, numStale);
+  return Try<size_t>(numIndexed);
+}
+
+
+vector<string> SyncPersistence::listUnusedDocuments(
+    size_t limit = 0) {
+  vector<string> docIds;
+  rockHandle_->iterPrefix(
+    SyncPersistence::getUnusedDocumentsPrefix(),
+    [&docIds, limit]
+    (const string &key,
+        function<void(string &)>,
+        function<void()> escape) {
+      auto offset = key.find(':');
+      DCHECK(offset != string::npos);
+      docIds.push_back(key.substr(offset + 1));
+      if (limit > 0 && docIds.size() >= limit) {
+        escape();
+      }
+    });
   return docIds;
 }
 
 
 size_t SyncPersistence::deleteOldUnusedDocuments(
     int64_t minAge = 3600, size_t limit = 0) {
-
   auto startTime = clock_->getEpochTime();
   auto cutoff = startTime - minAge;
-  size_t numSeen = 0;
+  vector<string> candidates;
   rockHandle_->iterPrefix(
-    SyncPersistence::getDocumentsPrefix(),
-    [this, &numSeen, cutoff, limit]
+    SyncPersistence::getUnusedDocumentsPrefix(),
+    [&candidates, cutoff, limit]
     (const string &key,
-        function<void(string &)>,
+        function<void(string &)> read,
         function<void()> escape) {
+      string created;
+      read(created);
+      if (folly::to<int64_t>(created) >= cutoff) {
+        return;
+      }
       auto offset = key.find(':');
       DCHECK(offset != string::npos);
-      auto id = key.substr(offset + 1);
-      if (!isDocumentInAnyCentroid(id)) {
-        auto createdTime = getDocumentCreatedTime(id);
-        if (!createdTime.hasValue() ||
-              createdTime.value() < cutoff) {
-          deleteDocument(id);
-          if (limit > 0) {
-            numSeen++;
-            if (numSeen >= limit) {
-              escape();
-            }
-          }
-        }
+      candidates.push_back(key.substr(offset + 1));
+      if (limit > 0 && candidates.size() >= limit) {
+        escape();
       }
     });
-  return numSeen;
+  size_t numDeleted = 0;
+  for (auto &id : candidates) {
+    // it may have joined a centroid since it was listed.
+    vector<string> centroidIds;
+    auto deleted = deleteDocumentKeys(id, true, centroidIds);
+    if (deleted.hasValue() && deleted.value()) {
+      std::lock_guard<std::mutex> guard(journalMutex_);
+      invalidateJournalsForDocument(id, centroidIds);
+      numDeleted++;
+    }
+  }
+  return numDeleted;
 }
 
 
@@ -348,6 +537,31 @@ Try<shared_ptr<ProcessedDocument>> SyncPersistence::loadDocument(
   return Try<shared_ptr<ProcessedDocument>>(std::move(processed));
 }
 
+vector<Try<shared_ptr<ProcessedDocument>>> SyncPersistence::loadDocuments(
+    const vector<string> &docIds) {
+  vector<string> keys;
+  keys.reserve(docIds.size());
+  for (auto &docId: docIds) {
+    keys.push_back(SyncPersistence::getDocumentKey(docId));
+  }
+  auto serialized = rockHandle_->multiGet(keys);
+  DCHECK(serialized.size() == docIds.size());
+  vector<Try<shared_ptr<ProcessedDocument>>> results;
+  results.reserve(docIds.size());
+  for (auto &elem: serialized) {
+    if (!elem.hasValue()) {
+      results.push_back(Try<shared_ptr<ProcessedDocument>>(
+        make_exception_wrapper<EDocumentDoesNotExist>()
+      ));
+      continue;
+    }
+    auto processed = std::make_shared<ProcessedDocument>();
+    serialization::binaryDeserialize(elem.value(), processed.get());
+    results.push_back(Try<shared_ptr<ProcessedDocument>>(std::move(processed)));
+  }
+  return results;
+}
+
 
 bool SyncPersistence::doesCentroidExist(const string &id) {
   auto key = SyncPersistence::getCentroidKey(id);
@@ -356,6 +570,7 @@ bool SyncPersistence::doesCentroidExist(const string &id) {
 
 
 Try<bool> SyncPersistence::createNewCentroid(const string &id) {
+  std::lock_guard<std::mutex> guard(journalMutex_);
   auto key = SyncPersistence::getCentroidKey(id);
   if (rockHandle_->exists(key)) {
     return Try<bool>(
@@ -363,32 +578,69 @@ Try<bool> SyncPersistence::createNewCentroid(const string &id) {
     );
   }
   Centroid centroid(id);
+  centroid.wordVector.documentWeight = 0;
   saveCentroid(id, &centroid);
+
+  // an empty centroid is trivially up to date with
+  // its (empty) document set.
+  forgetPendingRemovals(id);
+  changeJournals_[id] = CentroidChangeJournal();
   return Try<bool>(true);
 }
 
 
 Try<bool> SyncPersistence::deleteCentroid(const string &id) {
+  std::lock_guard<std::mutex> guard(journalMutex_);
   auto mainKey = SyncPersistence::getCentroidKey(id);
-  if (!rockHandle_->del(mainKey)) {
+  if (!rockHandle_->exists(mainKey)) {
+    forgetPendingRemovals(id);
+    changeJournals_.erase(id);
     return Try<bool>(
       make_exception_wrapper<ECentroidDoesNotExist>()
     );
   }
-  rockHandle_->iterPrefix(
-    SyncPersistence::getCentroidDocumentPrefix(id),
-    [this] (const string &key,
-        function<void(string &)>,
-        function<void()>) {
-      rockHandle_->del(key);
-    });
+  auto documentIds = listAllDocumentsForCentroidRaw(id);
+
+  // documents are deleted under their own locks alone, so hold
+  // every member's lock (in order, once each) until the write.
+  vector<size_t> lockIndexes;
+  for (auto &documentId : documentIds) {
+    lockIndexes.push_back(getDocumentLockIndex(documentId));
+  }
+  std::sort(lockIndexes.begin(), lockIndexes.end());
+  lockIndexes.erase(
+    std::unique(lockIndexes.begin(), lockIndexes.end()), lockIndexes.end()
+  );
+  vector<std::unique_lock<std::mutex>> docGuards;
+  for (auto index : lockIndexes) {
+    docGuards.emplace_back(documentLocks_[index]);
+  }
+  rocksdb::WriteBatch batch;
+  batch.Delete(mainKey);
+  for (auto &documentId : documentIds) {
+    batch.Delete(SyncPersistence::getCentroidDocumentKey(id, documentId));
+    releaseDocumentFromCentroid(batch, documentId, id);
+  }
   rockHandle_->iterPrefix(
     sformat("{}__centroid_metadata", id),
-    [this](const string &key,
+    [&batch](const string &key,
         function<void(string&)>,
         function<void()>) {
-      rockHandle_->del(key);
+      batch.Delete(key);
     });
+
+  // dropping the snapshot first means a failed write can only
+  // leave the centroid to be loaded from RocksDB.
+  if (snapshotStore_) {
+    std::lock_guard<std::mutex> snapshotGuard(getSnapshotLock(id));
+    snapshotStore_->remove(id);
+  }
+  auto written = writeBatch(batch, true);
+  if (written.hasException()) {
+    return written;
+  }
+  forgetPendingRemovals(id);
+  changeJournals_.erase(id);
   return Try<bool>(true);
 }
 
@@ -397,7 +649,17 @@ Try<bool> SyncPersistence::saveCentroid(const string &id,
     Centroid *centroid) {
   string data;
   serialization::binarySerialize(data, *centroid);
+  if (!snapshotStore_) {
+    rockHandle_->put(SyncPersistence::getCentroidKey(id), data);
+    return Try<bool>(true);
+  }
+
+  // drop the old snapshot first, so that a crash part way
+  // through leaves no snapshot rather than a stale one.
+  std::lock_guard<std::mutex> guard(getSnapshotLock(id));
+  snapshotStore_->remove(id);
   rockHandle_->put(SyncPersistence::getCentroidKey(id), data);
+  snapshotStore_->save(id, centroid);
   return Try<bool>(true);
 }
 
@@ -409,6 +671,13 @@ Try<bool> SyncPersistence::saveCentroid(const string &id,
 
 Try<shared_ptr<Centroid>> SyncPersistence::loadCentroid(
     const string &id) {
+  if (snapshotStore_) {
+    auto fromSnapshot = snapshotStore_->loadUniqueOption(id);
+    if (fromSnapshot.hasValue()) {
+      shared_ptr<Centroid> centroid(fromSnapshot.value().release());
+      return Try<shared_ptr<Centroid>>(centroid);
+    }
+  }
   string serialized;
   string key = SyncPersistence::getCentroidKey(id);
   if (!rockHandle_->get(key, serialized)) {
@@ -423,6 +692,12 @@ Try<shared_ptr<Centroid>> SyncPersistence::loadCentroid(
 
 Optional<util::UniquePointer<Centroid>> SyncPersistence::loadCentroidUniqueOption(
     const string &id) {
+  if (snapshotStore_) {
+    auto fromSnapshot = snapshotStore_->loadUniqueOption(id);
+    if (fromSnapshot.hasValue()) {
+      return std::move(fromSnapshot);
+    }
+  }
   string serialized;
   string key = SyncPersistence::getCentroidKey(id);
   Optional<util::UniquePointer<Centroid>> result;
@@ -489,6 +764,8 @@ vector<string> SyncPersistence::listCentroidRangeFromId(
 
 Try<bool> SyncPersistence::addDocumentToCentroid(
     const string &centroidId, const string &documentId) {
+  std::lock_guard<std::mutex> guard(journalMutex_);
+  std::lock_guard<std::mutex> docGuard(getDocumentLock(documentId));
   if (!doesCentroidExist(centroidId)) {
     return Try<bool>(
       make_exception_wrapper<ECentroidDoesNotExist>()
@@ -507,18 +784,43 @@ Try<bool> SyncPersistence::addDocumentToCentroid(
       make_exception_wrapper<EDocumentAlreadyInCentroid>()
     );
   }
-  string val = "1";
-  rockHandle_->put(centroidKey, val);
   auto documentKey = SyncPersistence::getDocumentCentroidKey(
     documentId, centroidId
   );
-  rockHandle_->put(documentKey, val);
+  rocksdb::WriteBatch batch;
+  batch.Put(centroidKey, "1");
+  batch.Put(documentKey, "1");
+  batch.Delete(SyncPersistence::getUnusedDocumentKey(documentId));
+  auto written = writeBatch(batch, true);
+  if (written.hasException()) {
+    return written;
+  }
+
+  auto journal = changeJournals_.find(centroidId);
+  if (journal != changeJournals_.end()) {
+    if (journal->second.rebuilding) {
+      // the rebuild in progress may or may not have listed it.
+      journal->second.needsFullRebuild = true;
+    } else if (journal->second.removed.erase(documentId) == 0) {
+      journal->second.added.insert(documentId);
+    } else {
+      auto pending = pendingRemovals_.find(documentId);
+      if (pending != pendingRemovals_.end()) {
+        pending->second.erase(centroidId);
+        if (pending->second.empty()) {
+          pendingRemovals_.erase(pending);
+        }
+      }
+    }
+  }
   return Try<bool>(true);
 }
 
 
 Try<bool> SyncPersistence::removeDocumentFromCentroid(
     const string &centroidId, const string &documentId) {
+  std::lock_guard<std::mutex> guard(journalMutex_);
+  std::lock_guard<std::mutex> docGuard(getDocumentLock(documentId));
   if (!doesCentroidExist(centroidId)) {
     return Try<bool>(
       make_exception_wrapper<ECentroidDoesNotExist>()
@@ -535,12 +837,33 @@ Try<bool> SyncPersistence::removeDocumentFromCentroid(
   auto documentKey = SyncPersistence::getDocumentCentroidKey(
     documentId, centroidId
   );
-  rockHandle_->del(documentKey);
-  if (!rockHandle_->del(centroidKey)) {
+  rocksdb::WriteBatch batch;
+  releaseDocumentFromCentroid(batch, documentId, centroidId);
+  if (!rockHandle_->exists(centroidKey)) {
+    // clear out any dangling reverse entry all the same.
+    auto written = writeBatch(batch, true);
+    if (written.hasException()) {
+      return written;
+    }
     return Try<bool>(
       make_exception_wrapper<EDocumentNotInCentroid>()
     );
   }
+  batch.Delete(centroidKey);
+  auto written = writeBatch(batch, true);
+  if (written.hasException()) {
+    return written;
+  }
+
+  auto journal = changeJournals_.find(centroidId);
+  if (journal != changeJournals_.end()) {
+    if (journal->second.rebuilding) {
+      journal->second.needsFullRebuild = true;
+    } else if (journal->second.added.erase(documentId) == 0) {
+      journal->second.removed.insert(documentId);
+      pendingRemovals_[documentId].insert(centroidId);
+    }
+  }
   return Try<bool>(true);
 }
 
@@ -713,8 +1036,102 @@ Try<bool> SyncPersistence::setCentroidMetadata(const string &centroidId,
 }
 
 void SyncPersistence::debugEraseAllData() {
+  std::lock_guard<std::mutex> guard(journalMutex_);
+  changeJournals_.clear();
+  pendingRemovals_.clear();
+  if (snapshotStore_) {
+    snapshotStore_->removeAll();
+  }
   rockHandle_->eraseEverything();
 }
 
+void SyncPersistence::invalidateJournalsForDocument(
+    const string &documentId, const vector<string> &centroidIds) {
+  for (auto &centroidId : centroidIds) {
+    auto journal = changeJournals_.find(centroidId);
+    if (journal != changeJournals_.end()) {
+      journal->second.needsFullRebuild = true;
+    }
+  }
+
+  // a pending removal would need this document's old contents.
+  auto pending = pendingRemovals_.find(documentId);
+  if (pending == pendingRemovals_.end()) {
+    return;
+  }
+  for (auto &centroidId : pending->second) {
+    auto journal = changeJournals_.find(centroidId);
+    if (journal != changeJournals_.end()) {
+      journal->second.needsFullRebuild = true;
+    }
+  }
+}
+
+void SyncPersistence::forgetPendingRemovals(const string &centroidId) {
+  auto journal = changeJournals_.find(centroidId);
+  if (journal == changeJournals_.end()) {
+    return;
+  }
+  for (auto &documentId : journal->second.removed) {
+    auto pending = pendingRemovals_.find(documentId);
+    if (pending == pendingRemovals_.end()) {
+      continue;
+    }
+    pending->second.erase(centroidId);
+    if (pending->second.empty()) {
+      pendingRemovals_.erase(pending);
+    }
+  }
+}
+
+CentroidDocumentChanges SyncPersistence::takeCentroidDocumentChanges(
+    const string &centroidId) {
+  std::lock_guard<std::mutex> guard(journalMutex_);
+  CentroidDocumentChanges changes;
+  auto journal = changeJournals_.find(centroidId);
+  if (journal != changeJournals_.end() && !journal->second.needsFullRebuild) {
+    changes.needsFullRebuild = false;
+    changes.added.assign(
+      journal->second.added.begin(), journal->second.added.end()
+    );
+    changes.removed.assign(
+      journal->second.removed.begin(), journal->second.removed.end()
+    );
+    forgetPendingRemovals(centroidId);
+    journal->second = CentroidChangeJournal();
+    return changes;
+  }
+
+  // untracked or invalidated: start a fresh journal, and note
+  // that anything recorded against it before the rebuild is
+  // finished may or may not be reflected in the result.
+  CentroidChangeJournal rebuildJournal;
+  rebuildJournal.rebuilding = true;
+  forgetPendingRemovals(centroidId);
+  changeJournals_[centroidId] = rebuildJournal;
+  return changes;
+}
+
+void SyncPersistence::finishCentroidUpdate(
+    const string &centroidId, bool succeeded) {
+  std::lock_guard<std::mutex> guard(journalMutex_);
+  auto journal = changeJournals_.find(centroidId);
+  if (journal == changeJournals_.end()) {
+    return;
+  }
+  journal->second.rebuilding = false;
+  if (!succeeded) {
+    // the changes we handed out were never applied.
+    journal->second.needsFullRebuild = true;
+  }
+}
+
+void SyncPersistence::invalidateCentroidDocumentChanges(
+    const string &centroidId) {
+  std::lock_guard<std::mutex> guard(journalMutex_);
+  forgetPendingRemovals(centroidId);
+  changeJournals_.erase(centroidId);
+}
+
 } // persistence
 } // relevanced
@@ -1,5 +1,9 @@
 #pragma once
+#include <array>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 #include <glog/logging.h>
@@ -11,8 +15,14 @@
 
 #include "declarations.h"
 
+#include "persistence/CentroidDocumentChanges.h"
+#include "persistence/CentroidSnapshotStore.h"
 #include "util/util.h"
 
+namespace rocksdb {
+class WriteBatch;
+}
+
 namespace relevanced {
 namespace persistence {
 
@@ -42,6 +52,9 @@ class SyncPersistenceIf {
   virtual folly::Try<std::shared_ptr<models::ProcessedDocument>>
     loadDocument(const std::string &) = 0;
 
+  virtual std::vector<folly::Try<std::shared_ptr<models::ProcessedDocument>>>
+    loadDocuments(const std::vector<std::string> &ids) = 0;
+
   virtual bool
     doesCentroidExist(const std::string &id) = 0;
 
@@ -123,13 +136,91 @@ class SyncPersistenceIf {
   virtual std::vector<std::string>
     listUnusedDocuments(size_t count) = 0;
 
+  // hands the centroid's pending membership changes to an
+  // updater, which must call `finishCentroidUpdate` when done.
+  virtual CentroidDocumentChanges
+    takeCentroidDocumentChanges(const std::string&) = 0;
+
+  virtual void
+    finishCentroidUpdate(const std::string&, bool succeeded) = 0;
+
+  // forces the next update of the centroid to be a full rebuild.
+  virtual void
+    invalidateCentroidDocumentChanges(const std::string&) = 0;
+
   virtual ~SyncPersistenceIf() = default;
 };
 
+/**
+ * Besides the RocksDB-backed storage, `SyncPersistence` keeps an
+ * in-memory journal of the documents added to and removed from each
+ * centroid since that centroid was last updated.  This lets the
+ * centroid updater apply small membership changes as deltas against
+ * the persisted centroid, instead of re-reading every document.
+ *
+ * Journal entries are written under the same lock as the membership
+ * keys they describe, so an updater never sees a membership change
+ * in RocksDB without also seeing it in the journal (or vice versa).
+ *
+ * The journal does not survive a restart; a centroid with no journal
+ * entry is always fully rebuilt on its next update.
+ *
+ * When given a `CentroidSnapshotStoreIf`, centroids are also written
+ * out as snapshots and loaded from them in preference to RocksDB,
+ * which skips deserializing them at startup.
+ *
+ * Documents that belong to no centroid are indexed under
+ * `unused_documents:{id}` (with their creation time as the value),
+ * in the same write batch and under the same document lock as the
+ * change that made them unused, so listing and garbage-collecting
+ * them only touches the unused documents themselves.  Databases
+ * written before the index existed are indexed by
+ * `buildUnusedDocumentIndex` at startup.
+ */
 class SyncPersistence : public SyncPersistenceIf {
  protected:
+  struct CentroidChangeJournal {
+    std::set<std::string> added;
+    std::set<std::string> removed;
+    bool needsFullRebuild {false};
+    bool rebuilding {false};
+  };
+
   std::shared_ptr<util::ClockIf> clock_;
   util::UniquePointer<RockHandleIf> rockHandle_;
+  std::mutex journalMutex_;
+  std::map<std::string, CentroidChangeJournal> changeJournals_;
+
+  // the centroids whose journals list each document as removed,
+  // so saving or deleting a document needn't walk every journal.
+  // guarded by `journalMutex_`.
+  std::map<std::string, std::set<std::string>> pendingRemovals_;
+  std::shared_ptr<CentroidSnapshotStoreIf> snapshotStore_;
+
+  // keeps a centroid's snapshot in step with its stored copy,
+  // striped by centroid ID so unrelated saves don't wait on
+  // each other's file I/O.
+  static const size_t kSnapshotLockStripes = 64;
+  std::array<std::mutex, kSnapshotLockStripes> snapshotLocks_;
+  std::mutex& getSnapshotLock(const std::string&);
+
+  // serializes changes to a single document's contents and
+  // membership, striped by document ID.  Taken after
+  // `journalMutex_` when both are needed, never before it.
+  static const size_t kDocumentLockStripes = 64;
+  std::array<std::mutex, kDocumentLockStripes> documentLocks_;
+
+  size_t getDocumentLockIndex(const std::string&);
+  std::mutex& getDocumentLock(const std::string&);
+
+  // the methods below expect `journalMutex_` to be held.
+  void invalidateJournalsForDocument(
+    const std::string &documentId,
+    const std::vector<std::string> &centroidIds
+  );
+
+  // call before replacing or dropping a centroid's journal.
+  void forgetPendingRemovals(const std::string &centroidId);
 
   std::vector<std::string>
     listAllDocumentsForCentroidRaw(const std::string &);
@@ -148,15 +239,45 @@ class SyncPersistence : public SyncPersistenceIf {
       size_t
     );
 
-  bool isDocumentInAnyCentroid(const std::string&);
-
   std::vector<std::string>
     listDocumentCentroids(const std::string&);
 
   folly::Optional<int64_t>
     getDocumentCreatedTime(const std::string&);
 
-  void setDocumentCreatedTime(const std::string&, int64_t);
+  void setDocumentCreatedTime(
+    rocksdb::WriteBatch&, const std::string&, int64_t
+  );
+
+  // writes the batch, or returns an error if RocksDB refused it.
+  // membership changes pass `sync` so that they are on disk before
+  // the in-memory journals record them.
+  folly::Try<bool> writeBatch(rocksdb::WriteBatch&, bool sync);
+
+  // deletes the document's keys under its document lock, and sets
+  // `centroidIds` to the centroids it still belonged to, whose
+  // journals the caller must invalidate.  With `onlyIfUnused`, a
+  // document that has since joined a centroid is left alone and
+  // `false` is returned.
+  folly::Try<bool> deleteDocumentKeys(
+    const std::string&,
+    bool onlyIfUnused,
+    std::vector<std::string> &centroidIds
+  );
+
+  // expects the document's lock to be held.
+  void markDocumentUnused(
+    rocksdb::WriteBatch&, const std::string&, int64_t created
+  );
+
+  // drops the document's link to the centroid, and indexes the
+  // document as unused if that was its last centroid.  Expects
+  // `journalMutex_` and the document's lock to be held.
+  void releaseDocumentFromCentroid(
+    rocksdb::WriteBatch&,
+    const std::string &documentId,
+    const std::string &centroidId
+  );
 
   static std::string
     getCentroidsPrefix();
@@ -176,6 +297,15 @@ class SyncPersistence : public SyncPersistenceIf {
   static std::string
     getDocumentCentroidKey(const std::string&, const std::string&);
 
+  static std::string
+    getUnusedDocumentsPrefix();
+
+  static std::string
+    getUnusedDocumentKey(const std::string&);
+
+  static std::string
+    getUnusedDocumentIndexKey();
+
   static std::string
     getCentroidDocumentPrefix(const std::string&);
 
@@ -194,9 +324,22 @@ class SyncPersistence : public SyncPersistenceIf {
     util::UniquePointer<RockHandleIf>
   );
 
+  SyncPersistence(
+    std::shared_ptr<util::ClockIf>,
+    util::UniquePointer<RockHandleIf>,
+    std::shared_ptr<CentroidSnapshotStoreIf>
+  );
+
   SyncPersistence(SyncPersistence const &) = delete;
   void operator=(SyncPersistence const &) = delete;
 
+  // indexes every document that belongs to no centroid, for
+  // databases written before the unused-document index existed,
+  // and drops reverse links to centroids that no longer exist.
+  // Does nothing once the index has been built.  Takes no locks,
+  // so it must run before anything else uses this instance.
+  folly::Try<size_t> buildUnusedDocumentIndex();
+
   bool doesDocumentExist(const std::string &id) override;
 
   folly::Try<bool>
@@ -235,6 +378,9 @@ class SyncPersistence : public SyncPersistenceIf {
   folly::Try<std::shared_ptr<models::ProcessedDocument>>
     loadDocument(const std::string&) override;
 
+  std::vector<folly::Try<std::shared_ptr<models::ProcessedDocument>>>
+    loadDocuments(const std::vector<std::string> &ids) override;
+
   bool doesCentroidExist(const std::string &id) override;
 
   folly::Try<bool>
@@ -338,6 +484,13 @@ class SyncPersistence : public SyncPersistenceIf {
       std::string
     ) override;
 
+  CentroidDocumentChanges
+    takeCentroidDocumentChanges(const std::string&) override;
+
+  void finishCentroidUpdate(const std::string&, bool succeeded) override;
+
+  void invalidateCentroidDocumentChanges(const std::string&) override;
+
   void debugEraseAllData() override;
 };
 
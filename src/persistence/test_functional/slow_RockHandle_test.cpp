@@ -11,6 +11,10 @@
 #include <atomic>
 #include <folly/Format.h>
 #include <glog/logging.h>
+#include <rocksdb/db.h>
+#include <rocksdb/options.h>
+#include <rocksdb/write_batch.h>
+#include "persistence/KeyEncoding.h"
 
 using namespace std;
 using namespace folly;
@@ -24,6 +28,58 @@ string getDataDir() {
   return dirName;
 }
 
+namespace {
+
+// reads encoded keys straight out of a column family.
+class InspectableRockHandle : public RockHandle {
+ public:
+  InspectableRockHandle(string dbPath) : RockHandle(dbPath) {}
+  bool getEncoded(KeyFamily family, const string &key, string &result) {
+    return db_->Get(readOptions_, getFamily(family), key, &result).ok();
+  }
+  bool existsEncoded(KeyFamily family, const string &key) {
+    string result;
+    return getEncoded(family, key, result);
+  }
+};
+
+// writes keys the way versions without column families did:
+// verbatim, into the default family.
+void writeLegacyKeys(const string &dbPath, const map<string, string> &keys) {
+  rocksdb::Options options;
+  options.create_if_missing = true;
+  rocksdb::DB *db = nullptr;
+  CHECK(rocksdb::DB::Open(options, dbPath, &db).ok());
+  for (auto &elem : keys) {
+    CHECK(db->Put(rocksdb::WriteOptions(), elem.first, elem.second).ok());
+  }
+  delete db;
+}
+
+void putOwnedKeys(RockHandleIf &handle) {
+  handle.put("x:key1", "x-val");
+  handle.put("documents:doc-1", "doc-val");
+  handle.put("centroids:c1", "centroid-val");
+  handle.put("c1__documents:doc-1", "1");
+  handle.put("c1__documents:doc-2", "1");
+  handle.put("c1__documents:doc-3", "1");
+  handle.put("c10__documents:doc-4", "1");
+  handle.put("doc-1__centroids:c1", "1");
+  handle.put("c1__centroid_metadata:last_calculated", "5");
+  handle.put("doc-1__document_metadata:created_time", "7");
+}
+
+vector<string> collectKeys(
+    function<void(function<void(const string &, function<void(string &) >,
+      function<void()>)>)> iterate) {
+  vector<string> keys;
+  iterate([&keys](const string &key, function<void(string &) >,
+      function<void()>) { keys.push_back(key); });
+  return keys;
+}
+
+} // anonymous namespace
+
 TEST(TestRockHandle, TestPutGet) {
   RockHandle handle(getDataDir());
   handle.put("x", "x-val");
@@ -496,6 +552,149 @@ TEST(TestRockHandle, TestEraseEverythingStillGood) {
   EXPECT_EQ("val2", val);
 }
 
+TEST(TestRockHandle, TestMigratesLegacyKeys) {
+  auto dataDir = getDataDir();
+  map<string, string> legacy {
+    {"documents:doc-1", "doc-val"},
+    {"centroids:c1", "centroid-val"},
+    {"c1__documents:doc-1", "1"},
+    {"doc-1__centroids:c1", "1"},
+    {"doc-1__document_metadata:created_time", "7"},
+    {"c1__centroid_metadata:last_calculated", "5"},
+    {"x:key1", "x-val"}
+  };
+  writeLegacyKeys(dataDir, legacy);
+  {
+    InspectableRockHandle handle(dataDir);
+    for (auto &elem : legacy) {
+      EXPECT_EQ(elem.second, handle.get(elem.first));
+    }
+    EXPECT_FALSE(handle.existsEncoded(KeyFamily::DEFAULT, "documents:doc-1"));
+    EXPECT_FALSE(handle.existsEncoded(
+      KeyFamily::DEFAULT, "c1__documents:doc-1"));
+    EXPECT_TRUE(handle.existsEncoded(KeyFamily::DEFAULT, "x:key1"));
+    string val;
+    EXPECT_TRUE(handle.getEncoded(KeyFamily::DOCUMENTS, "doc-1", val));
+    EXPECT_EQ("doc-val", val);
+    auto mapping = encodeKey("c1__documents:doc-1");
+    EXPECT_TRUE(handle.existsEncoded(KeyFamily::MAPPINGS, mapping.key));
+    auto meta = encodeKey("doc-1__document_metadata:created_time");
+    EXPECT_TRUE(handle.getEncoded(KeyFamily::METADATA, meta.key, val));
+    EXPECT_EQ("7", val);
+    EXPECT_EQ(0, handle.migrateLegacyKeys());
+  }
+  // reopening finds everything in place and nothing left to move.
+  InspectableRockHandle reopened(dataDir);
+  EXPECT_EQ(0, reopened.migrateLegacyKeys());
+  for (auto &elem : legacy) {
+    EXPECT_EQ(elem.second, reopened.get(elem.first));
+  }
+  EXPECT_FALSE(reopened.existsEncoded(KeyFamily::DEFAULT, "centroids:c1"));
+  EXPECT_TRUE(reopened.existsEncoded(KeyFamily::CENTROIDS, "c1"));
+}
+
+TEST(TestRockHandle, TestWriteRoutesBatch) {
+  InspectableRockHandle handle(getDataDir());
+  handle.put("centroids:c1", "centroid-val");
+  rocksdb::WriteBatch batch;
+  batch.Put("documents:doc-1", "doc-val");
+  batch.Put("c1__documents:doc-1", "1");
+  batch.Put("doc-1__document_metadata:created_time", "7");
+  batch.Put("x:key1", "x-val");
+  batch.Delete("centroids:c1");
+  EXPECT_TRUE(handle.write(batch, false));
+
+  string val;
+  EXPECT_TRUE(handle.getEncoded(KeyFamily::DOCUMENTS, "doc-1", val));
+  EXPECT_EQ("doc-val", val);
+  EXPECT_TRUE(handle.existsEncoded(
+    KeyFamily::MAPPINGS, encodeKey("c1__documents:doc-1").key));
+  EXPECT_TRUE(handle.existsEncoded(KeyFamily::METADATA,
+    encodeKey("doc-1__document_metadata:created_time").key));
+  EXPECT_TRUE(handle.getEncoded(KeyFamily::DEFAULT, "x:key1", val));
+  EXPECT_EQ("x-val", val);
+  EXPECT_FALSE(handle.existsEncoded(KeyFamily::DEFAULT, "documents:doc-1"));
+  EXPECT_FALSE(handle.existsEncoded(KeyFamily::CENTROIDS, "c1"));
+  EXPECT_FALSE(handle.exists("centroids:c1"));
+
+  rocksdb::WriteBatch syncBatch;
+  syncBatch.Delete("c1__documents:doc-1");
+  syncBatch.Put("doc-1__centroids:c1", "1");
+  EXPECT_TRUE(handle.write(syncBatch, true));
+  EXPECT_FALSE(handle.exists("c1__documents:doc-1"));
+  EXPECT_TRUE(handle.existsEncoded(
+    KeyFamily::MAPPINGS, encodeKey("doc-1__centroids:c1").key));
+}
+
+TEST(TestRockHandle, TestIterPrefixDecodesKeys) {
+  RockHandle handle(getDataDir());
+  putOwnedKeys(handle);
+  auto keys = collectKeys([&handle](
+      function<void(const string &, function<void(string &) >,
+        function<void()>)> iterFn) {
+    handle.iterPrefix("c1__documents", iterFn);
+  });
+  vector<string> expected {
+    "c1__documents:doc-1", "c1__documents:doc-2", "c1__documents:doc-3"
+  };
+  EXPECT_EQ(expected, keys);
+  keys = collectKeys([&handle](
+      function<void(const string &, function<void(string &) >,
+        function<void()>)> iterFn) {
+    handle.iterPrefix("documents", iterFn);
+  });
+  expected = {"documents:doc-1"};
+  EXPECT_EQ(expected, keys);
+}
+
+TEST(TestRockHandle, TestIterPrefixFromMemberDecodesKeys) {
+  RockHandle handle(getDataDir());
+  putOwnedKeys(handle);
+  auto keys = collectKeys([&handle](
+      function<void(const string &, function<void(string &) >,
+        function<void()>)> iterFn) {
+    handle.iterPrefixFromMember("c1__documents", "doc-2", 5, iterFn);
+  });
+  vector<string> expected {"c1__documents:doc-2", "c1__documents:doc-3"};
+  EXPECT_EQ(expected, keys);
+}
+
+TEST(TestRockHandle, TestIterRangeDecodesKeys) {
+  RockHandle handle(getDataDir());
+  putOwnedKeys(handle);
+  auto keys = collectKeys([&handle](
+      function<void(const string &, function<void(string &) >,
+        function<void()>)> iterFn) {
+    handle.iterRange("c1__documents:doc-1", "c1__documents:doc-3", iterFn);
+  });
+  vector<string> expected {"c1__documents:doc-1", "c1__documents:doc-2"};
+  EXPECT_EQ(expected, keys);
+}
+
+TEST(TestRockHandle, TestIterAllDecodesKeys) {
+  RockHandle handle(getDataDir());
+  putOwnedKeys(handle);
+  auto keys = collectKeys([&handle](
+      function<void(const string &, function<void(string &) >,
+        function<void()>)> iterFn) {
+    handle.iterAll(iterFn);
+  });
+  // one family after another, each in encoded order.
+  vector<string> expected {
+    "x:key1",
+    "documents:doc-1",
+    "centroids:c1",
+    "doc-1__centroids:c1",
+    "c1__documents:doc-1",
+    "c1__documents:doc-2",
+    "c1__documents:doc-3",
+    "c10__documents:doc-4",
+    "c1__centroid_metadata:last_calculated",
+    "doc-1__document_metadata:created_time"
+  };
+  EXPECT_EQ(expected, keys);
+}
+
 int main(int argc, char* argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,98 @@
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <unistd.h>
+
+#include "models/Centroid.h"
+#include "persistence/CentroidSnapshotStore.h"
+#include "util/util.h"
+
+using namespace std;
+using namespace relevanced;
+using namespace relevanced::persistence;
+using namespace relevanced::models;
+
+struct SnapshotDirCtx {
+  string directory;
+  SnapshotDirCtx() {
+    char dirTemplate[] = "/tmp/relevanced_snapshot_test_XXXXXX";
+    directory = mkdtemp(dirTemplate);
+  }
+  ~SnapshotDirCtx() {
+    CentroidSnapshotStore(directory).removeAll();
+    rmdir(directory.c_str());
+  }
+};
+
+TEST(CentroidSnapshotStore, RoundTrip) {
+  SnapshotDirCtx ctx;
+  CentroidSnapshotStore store(ctx.directory);
+  unordered_map<string, double> scores {
+    {"foo", 1.5}, {"bar", 2.5}, {"baz", -0.5}
+  };
+  Centroid centroid("some/centroid id", scores, 3.0);
+  centroid.wordVector.documentWeight = 7;
+  EXPECT_TRUE(store.save(centroid.id, &centroid));
+
+  auto loaded = store.loadUniqueOption("some/centroid id");
+  EXPECT_TRUE(loaded.hasValue());
+  auto &result = loaded.value();
+  EXPECT_EQ("some/centroid id", result->id);
+  EXPECT_EQ(3.0, result->wordVector.magnitude);
+  EXPECT_EQ(7, result->wordVector.documentWeight);
+  EXPECT_EQ(scores, result->wordVector.getTermScores());
+}
+
+TEST(CentroidSnapshotStore, Missing) {
+  SnapshotDirCtx ctx;
+  CentroidSnapshotStore store(ctx.directory);
+  EXPECT_FALSE(store.loadUniqueOption("missing").hasValue());
+}
+
+TEST(CentroidSnapshotStore, Remove) {
+  SnapshotDirCtx ctx;
+  CentroidSnapshotStore store(ctx.directory);
+  unordered_map<string, double> scores {{"foo", 1.5}};
+  Centroid centroid1("c1", scores, 1.5);
+  Centroid centroid2("c2", scores, 1.5);
+  store.save("c1", &centroid1);
+  store.save("c2", &centroid2);
+  store.remove("c1");
+  EXPECT_FALSE(store.loadUniqueOption("c1").hasValue());
+  EXPECT_TRUE(store.loadUniqueOption("c2").hasValue());
+  store.removeAll();
+  EXPECT_FALSE(store.loadUniqueOption("c2").hasValue());
+}
+
+TEST(CentroidSnapshot, SortedTermsRoundTrip) {
+  SnapshotDirCtx ctx;
+  unordered_map<string, double> scores {
+    {"zebra", 1.0}, {"apple", 2.0}, {"mango", 3.0}, {"app", 4.0}
+  };
+  Centroid centroid("c1", scores, 1.0);
+  string path = ctx.directory + "/c1.snapshot";
+  EXPECT_TRUE(writeCentroidSnapshot(path, &centroid));
+  auto loaded = readCentroidSnapshot(path, "c1");
+  EXPECT_TRUE(loaded.hasValue());
+  auto &result = loaded.value();
+  EXPECT_EQ("c1", result->id);
+  EXPECT_EQ(4, result->wordVector.scores.size());
+  EXPECT_EQ(scores, result->wordVector.getTermScores());
+  unlink(path.c_str());
+}
+
+TEST(CentroidSnapshot, RejectsTruncated) {
+  SnapshotDirCtx ctx;
+  unordered_map<string, double> scores {{"foo", 1.0}, {"bar", 2.0}};
+  Centroid centroid("c1", scores, 1.0);
+  string path = ctx.directory + "/c1.snapshot";
+  EXPECT_TRUE(writeCentroidSnapshot(path, &centroid));
+  EXPECT_EQ(0, truncate(path.c_str(), 60));
+  EXPECT_FALSE(readCentroidSnapshot(path, "c1").hasValue());
+  unlink(path.c_str());
+}
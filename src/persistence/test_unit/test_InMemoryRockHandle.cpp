@@ -7,6 +7,7 @@
 #include <memory>
 #include <rocksdb/db.h>
 #include <rocksdb/slice.h>
+#include <rocksdb/write_batch.h>
 #include "util/util.h"
 #include "testing/TestHelpers.h"
 #include "persistence/InMemoryRockHandle.h"
@@ -36,6 +37,37 @@ TEST(InMemoryRockHandle, TestGetMissing) {
   EXPECT_EQ("", gottenInPlace);
 }
 
+TEST(InMemoryRockHandle, TestMultiGet) {
+  InMemoryRockHandle rockHandle("foo");
+  string xVal{"x-val"};
+  string zVal{"z-val"};
+  EXPECT_TRUE(rockHandle.put("x-key", xVal));
+  EXPECT_TRUE(rockHandle.put("z-key", zVal));
+  auto result = rockHandle.multiGet(
+    vector<string> {"z-key", "y-key", "x-key"}
+  );
+  EXPECT_EQ(3, result.size());
+  EXPECT_TRUE(result.at(0).hasValue());
+  EXPECT_EQ("z-val", result.at(0).value());
+  EXPECT_FALSE(result.at(1).hasValue());
+  EXPECT_TRUE(result.at(2).hasValue());
+  EXPECT_EQ("x-val", result.at(2).value());
+}
+
+TEST(InMemoryRockHandle, TestWriteBatch) {
+  InMemoryRockHandle rockHandle("foo");
+  string xVal{"x-val"};
+  EXPECT_TRUE(rockHandle.put("x-key", xVal));
+  rocksdb::WriteBatch batch;
+  batch.Put("y-key", "y-val");
+  batch.Put("z-key", "z-val");
+  batch.Delete("x-key");
+  EXPECT_TRUE(rockHandle.write(batch, false));
+  EXPECT_FALSE(rockHandle.exists("x-key"));
+  EXPECT_EQ("y-val", rockHandle.get("y-key"));
+  EXPECT_EQ("z-val", rockHandle.get("z-key"));
+}
+
 TEST(InMemoryRockHandle, TestExistsMissing) {
   InMemoryRockHandle rockHandle("foo");
   EXPECT_FALSE(rockHandle.exists("x-key"));
@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+#include <string>
+#include <vector>
+
+#include "persistence/KeyEncoding.h"
+
+using namespace std;
+using namespace relevanced;
+using namespace relevanced::persistence;
+
+namespace {
+
+string ownedKey(char tag, const string &owner, const string &member) {
+  string result;
+  result.push_back(tag);
+  result.push_back(0);
+  result.push_back(0);
+  result.push_back(0);
+  result.push_back((char) owner.size());
+  result += owner;
+  result += member;
+  return result;
+}
+
+} // anonymous namespace
+
+TEST(KeyEncoding, TestDocumentsAndCentroids) {
+  auto doc = encodeKey("documents:doc-1");
+  EXPECT_EQ(KeyFamily::DOCUMENTS, doc.family);
+  EXPECT_EQ("doc-1", doc.key);
+  auto centroid = encodeKey("centroids:centroid-1");
+  EXPECT_EQ(KeyFamily::CENTROIDS, centroid.family);
+  EXPECT_EQ("centroid-1", centroid.key);
+}
+
+TEST(KeyEncoding, TestMappingsAndMetadata) {
+  auto centroidDocs = encodeKey("c1__documents:doc-1");
+  EXPECT_EQ(KeyFamily::MAPPINGS, centroidDocs.family);
+  EXPECT_EQ(ownedKey('D', "c1", "doc-1"), centroidDocs.key);
+  auto docCentroids = encodeKey("doc-1__centroids:c1");
+  EXPECT_EQ(KeyFamily::MAPPINGS, docCentroids.family);
+  EXPECT_EQ(ownedKey('C', "doc-1", "c1"), docCentroids.key);
+  auto docMeta = encodeKey("doc-1__document_metadata:created_time");
+  EXPECT_EQ(KeyFamily::METADATA, docMeta.family);
+  EXPECT_EQ(ownedKey('D', "doc-1", "created_time"), docMeta.key);
+  auto centroidMeta = encodeKey("c1__centroid_metadata:last_calculated");
+  EXPECT_EQ(KeyFamily::METADATA, centroidMeta.family);
+  EXPECT_EQ(ownedKey('C', "c1", "last_calculated"), centroidMeta.key);
+}
+
+TEST(KeyEncoding, TestOtherKeysStayInDefault) {
+  auto noColon = encodeKey("x");
+  EXPECT_EQ(KeyFamily::DEFAULT, noColon.family);
+  EXPECT_EQ("x", noColon.key);
+  auto unknown = encodeKey("x:key1");
+  EXPECT_EQ(KeyFamily::DEFAULT, unknown.family);
+  EXPECT_EQ("x:key1", unknown.key);
+  auto colonInOwner = encodeKey("a:b__documents:doc-1");
+  EXPECT_EQ(KeyFamily::DEFAULT, colonInOwner.family);
+  EXPECT_EQ("a:b__documents:doc-1", colonInOwner.key);
+}
+
+TEST(KeyEncoding, TestPrefixMatchesKeys) {
+  vector<string> prefixes {
+    "documents", "centroids", "c1__documents", "doc-1__centroids",
+    "doc-1__document_metadata", "c1__centroid_metadata", "x", "a:b"
+  };
+  for (auto &prefix : prefixes) {
+    auto encodedPrefix = encodeKeyPrefix(prefix);
+    auto encodedKey = encodeKey(prefix + ":member:with:colons");
+    EXPECT_EQ(encodedPrefix.family, encodedKey.family);
+    EXPECT_EQ(encodedPrefix.key + "member:with:colons", encodedKey.key);
+  }
+}
+
+TEST(KeyEncoding, TestOwnersDoNotRunIntoMembers) {
+  // without a length prefix, these would share a prefix.
+  auto shortOwner = encodeKey("c__documents:1");
+  auto longOwner = encodeKey("c1__documents:");
+  EXPECT_NE(shortOwner.key, longOwner.key);
+  auto prefix = encodeKeyPrefix("c");
+  EXPECT_NE(0, longOwner.key.compare(0, prefix.key.size(), prefix.key));
+}
+
+TEST(KeyEncoding, TestRoundTrip) {
+  vector<string> keys {
+    "documents:doc-1", "centroids:c1", "c1__documents:doc-1",
+    "doc-1__centroids:c1", "doc-1__document_metadata:created_time",
+    "c1__centroid_metadata:x", "x", "x:key1", "a:b__documents:doc-1",
+    "__documents:", "documents:"
+  };
+  for (auto &key : keys) {
+    EXPECT_EQ(key, decodeKey(encodeKey(key)));
+  }
+}
+
+TEST(KeyEncoding, TestFamilyNames) {
+  EXPECT_EQ(string("default"), keyFamilyName(KeyFamily::DEFAULT));
+  EXPECT_EQ(string("documents"), keyFamilyName(KeyFamily::DOCUMENTS));
+  EXPECT_EQ(string("centroids"), keyFamilyName(KeyFamily::CENTROIDS));
+  EXPECT_EQ(string("mappings"), keyFamilyName(KeyFamily::MAPPINGS));
+  EXPECT_EQ(string("metadata"), keyFamilyName(KeyFamily::METADATA));
+}
+
+TEST(KeyEncoding, TestOwnerPrefixLength) {
+  auto encoded = encodeKey("c1__documents:doc-1");
+  auto prefix = encodeKeyPrefix("c1__documents");
+  EXPECT_EQ(prefix.key.size(),
+    encodedOwnerPrefixLength(encoded.key.data(), encoded.key.size()));
+  EXPECT_EQ(prefix.key.size(),
+    encodedOwnerPrefixLength(prefix.key.data(), prefix.key.size()));
+  EXPECT_EQ(0, encodedOwnerPrefixLength(prefix.key.data(), 4));
+  EXPECT_EQ(0, encodedOwnerPrefixLength(prefix.key.data(), 6));
+}
@@ -0,0 +1,91 @@
+#include "gtest/gtest.h"
+#include <string>
+#include <rocksdb/slice.h>
+
+#include "persistence/KeyEncoding.h"
+#include "persistence/PrefixTransforms.h"
+
+using namespace std;
+using namespace relevanced;
+using namespace relevanced::persistence;
+using rocksdb::Slice;
+
+TEST(ColonPrefixTransform, TestTransform) {
+  ColonPrefixTransform transform;
+  EXPECT_EQ("x:", transform.Transform(Slice("x:key1")).ToString());
+  EXPECT_EQ("x:", transform.Transform(Slice("x:key:with:colons")).ToString());
+  EXPECT_EQ(":", transform.Transform(Slice(":key")).ToString());
+}
+
+TEST(ColonPrefixTransform, TestInDomain) {
+  ColonPrefixTransform transform;
+  EXPECT_TRUE(transform.InDomain(Slice("x:key1")));
+  EXPECT_TRUE(transform.InDomain(Slice("x:")));
+  EXPECT_TRUE(transform.InDomain(Slice(":")));
+  EXPECT_FALSE(transform.InDomain(Slice("x")));
+  EXPECT_FALSE(transform.InDomain(Slice("")));
+}
+
+TEST(ColonPrefixTransform, TestInRange) {
+  ColonPrefixTransform transform;
+  EXPECT_TRUE(transform.InRange(Slice("x:")));
+  EXPECT_TRUE(transform.InRange(Slice(":")));
+  EXPECT_FALSE(transform.InRange(Slice("x:key1")));
+  EXPECT_FALSE(transform.InRange(Slice("x:key:")));
+  EXPECT_FALSE(transform.InRange(Slice("x")));
+  EXPECT_FALSE(transform.InRange(Slice("")));
+}
+
+TEST(ColonPrefixTransform, TestSameResultWhenAppended) {
+  ColonPrefixTransform transform;
+  EXPECT_TRUE(transform.SameResultWhenAppended(Slice("x:")));
+  EXPECT_FALSE(transform.SameResultWhenAppended(Slice("x")));
+  EXPECT_FALSE(transform.SameResultWhenAppended(Slice("x:key1")));
+  EXPECT_FALSE(transform.SameResultWhenAppended(Slice("")));
+}
+
+TEST(OwnerPrefixTransform, TestTransform) {
+  OwnerPrefixTransform transform;
+  auto key = encodeKey("c1__documents:doc-1").key;
+  auto prefix = encodeKeyPrefix("c1__documents").key;
+  EXPECT_EQ(prefix, transform.Transform(Slice(key)).ToString());
+  EXPECT_EQ(prefix, transform.Transform(Slice(prefix)).ToString());
+}
+
+TEST(OwnerPrefixTransform, TestInDomain) {
+  OwnerPrefixTransform transform;
+  auto key = encodeKey("c1__documents:doc-1").key;
+  auto prefix = encodeKeyPrefix("c1__documents").key;
+  EXPECT_TRUE(transform.InDomain(Slice(key)));
+  EXPECT_TRUE(transform.InDomain(Slice(prefix)));
+
+  // truncated inside the length header, and inside the owner.
+  EXPECT_FALSE(transform.InDomain(Slice(prefix.data(), 1)));
+  EXPECT_FALSE(transform.InDomain(Slice(prefix.data(), 4)));
+  EXPECT_FALSE(transform.InDomain(Slice(prefix.data(), prefix.size() - 1)));
+  EXPECT_FALSE(transform.InDomain(Slice("")));
+}
+
+TEST(OwnerPrefixTransform, TestInRange) {
+  OwnerPrefixTransform transform;
+  auto key = encodeKey("c1__documents:doc-1").key;
+  auto prefix = encodeKeyPrefix("c1__documents").key;
+  EXPECT_TRUE(transform.InRange(Slice(prefix)));
+  EXPECT_TRUE(transform.InRange(Slice(encodeKeyPrefix("__documents").key)));
+  EXPECT_FALSE(transform.InRange(Slice(key)));
+  EXPECT_FALSE(transform.InRange(Slice(prefix.data(), 4)));
+  EXPECT_FALSE(transform.InRange(Slice(prefix.data(), prefix.size() - 1)));
+  EXPECT_FALSE(transform.InRange(Slice("")));
+}
+
+TEST(OwnerPrefixTransform, TestSameResultWhenAppended) {
+  OwnerPrefixTransform transform;
+  auto key = encodeKey("c1__documents:doc-1").key;
+  auto prefix = encodeKeyPrefix("c1__documents").key;
+  EXPECT_TRUE(transform.SameResultWhenAppended(Slice(prefix)));
+  EXPECT_FALSE(transform.SameResultWhenAppended(Slice(key)));
+  EXPECT_FALSE(transform.SameResultWhenAppended(Slice(prefix.data(), 4)));
+  EXPECT_FALSE(transform.SameResultWhenAppended(
+    Slice(prefix.data(), prefix.size() - 1)));
+  EXPECT_FALSE(transform.SameResultWhenAppended(Slice("")));
+}
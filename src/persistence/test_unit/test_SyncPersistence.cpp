@@ -2,10 +2,13 @@
 #include "gmock/gmock.h"
 #include <functional>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
+#include <unistd.h>
+
 
 #include <rocksdb/db.h>
 #include <rocksdb/slice.h>
@@ -13,6 +16,7 @@
 #include "models/Centroid.h"
 #include "models/Document.h"
 #include "models/ProcessedDocument.h"
+#include "persistence/CentroidSnapshotStore.h"
 #include "persistence/InMemoryRockHandle.h"
 #include "persistence/RockHandle.h"
 #include "persistence/SyncPersistence.h"
@@ -36,6 +40,21 @@ using util::ClockIf;
 using ::testing::Return;
 using ::testing::_;
 
+namespace {
+
+class FailingWriteRockHandle : public InMemoryRockHandle {
+ public:
+  bool failWrites {false};
+  FailingWriteRockHandle() : InMemoryRockHandle("/some-path") {}
+  bool write(rocksdb::WriteBatch &batch, bool sync) override {
+    if (failWrites) {
+      return false;
+    }
+    return InMemoryRockHandle::write(batch, sync);
+  }
+};
+
+} // anonymous namespace
 
 TEST(SyncPersistence, DoesDocumentExistTrue) {
   MockRock mockRock;
@@ -73,6 +92,26 @@ TEST(SyncPersistence, DeleteDocumentExists) {
   EXPECT_FALSE(mockRock.exists("documents:doc-id"));
 }
 
+TEST(SyncPersistence, DeleteDocumentRemovesCentroidLinks) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  mockRock.put("documents:doc-id", "something");
+  mockRock.put("doc-id__centroids:centroid-1", "1");
+  mockRock.put("doc-id__centroids:centroid-2", "1");
+  mockRock.put("doc-id__document_metadata:created_time", "5");
+  mockRock.put("other-doc__centroids:centroid-1", "1");
+  auto res = dbHandle.deleteDocument("doc-id");
+  EXPECT_TRUE(res.hasValue());
+  EXPECT_FALSE(mockRock.exists("documents:doc-id"));
+  EXPECT_FALSE(mockRock.exists("doc-id__centroids:centroid-1"));
+  EXPECT_FALSE(mockRock.exists("doc-id__centroids:centroid-2"));
+  EXPECT_FALSE(mockRock.exists("doc-id__document_metadata:created_time"));
+  EXPECT_TRUE(mockRock.exists("other-doc__centroids:centroid-1"));
+}
+
 TEST(SyncPersistence, DeleteDocumentDoesNotExist) {
   InMemoryRockHandle mockRock("/some-path");
   UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
@@ -135,6 +174,38 @@ TEST(SyncPersistence, LoadDocumentDoesNotExist) {
   EXPECT_TRUE(res.hasException());
 }
 
+TEST(SyncPersistence, LoadDocumentsMixed) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  ProcessedDocument doc1("doc-1",
+    vector<ScoredWord> { ScoredWord("dog", 3, 1.3), ScoredWord("cat", 3, 2.6) },
+    5.8
+  );
+  ProcessedDocument doc2("doc-2",
+    vector<ScoredWord> { ScoredWord("fish", 4, 1.1) },
+    1.1
+  );
+  string serialized1, serialized2;
+  serialization::binarySerialize(serialized1, doc1);
+  mockRock.put("documents:doc-1", serialized1);
+  serialization::binarySerialize(serialized2, doc2);
+  mockRock.put("documents:doc-2", serialized2);
+  auto result = dbHandle.loadDocuments(
+    vector<string> {"doc-2", "missing", "doc-1"}
+  );
+  EXPECT_EQ(3, result.size());
+  EXPECT_TRUE(result.at(0).hasValue());
+  EXPECT_EQ("doc-2", result.at(0).value()->id);
+  EXPECT_EQ(1, result.at(0).value()->scoredWords.size());
+  EXPECT_TRUE(result.at(1).hasException());
+  EXPECT_TRUE(result.at(2).hasValue());
+  EXPECT_EQ("doc-1", result.at(2).value()->id);
+  EXPECT_EQ(2, result.at(2).value()->scoredWords.size());
+}
+
 TEST(SyncPersistence, DoesCentroidExistTrue) {
   InMemoryRockHandle mockRock("/some-path");
   UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
@@ -270,7 +341,41 @@ TEST(SyncPersistence, SaveCentroid) {
   EXPECT_EQ("centroid-id", deserialized.id);
   EXPECT_EQ(5.8, deserialized.wordVector.magnitude);
   EXPECT_EQ(2, deserialized.wordVector.scores.size());
-  EXPECT_EQ(2.21, deserialized.wordVector.scores["blarg"]);
+  EXPECT_EQ(2.21, deserialized.wordVector.getTermScores()["blarg"]);
+}
+
+TEST(SyncPersistence, SaveAndLoadCentroidWithSnapshots) {
+  char dirTemplate[] = "/tmp/relevanced_snapshot_test_XXXXXX";
+  string snapshotDir = mkdtemp(dirTemplate);
+  auto snapshotStore = make_shared<CentroidSnapshotStore>(snapshotDir);
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle), snapshotStore);
+  Centroid centroid(
+      "centroid-id", unordered_map<string, double>{{"moose", 1.7}, {"blarg", 2.21}}, 5.8);
+  auto res = dbHandle.saveCentroid("centroid-id", &centroid);
+  EXPECT_FALSE(res.hasException());
+  EXPECT_TRUE(mockRock.exists("centroids:centroid-id"));
+  EXPECT_TRUE(snapshotStore->loadUniqueOption("centroid-id").hasValue());
+
+  // the snapshot is preferred over the stored copy.
+  Centroid stale(
+      "centroid-id", unordered_map<string, double>{{"moose", 1.0}}, 1.0);
+  string data;
+  serialization::binarySerialize(data, stale);
+  mockRock.put("centroids:centroid-id", data);
+  auto loaded = dbHandle.loadCentroid("centroid-id");
+  EXPECT_FALSE(loaded.hasException());
+  EXPECT_EQ(5.8, loaded.value()->wordVector.magnitude);
+  EXPECT_EQ(2.21, loaded.value()->wordVector.getTermScores()["blarg"]);
+
+  dbHandle.deleteCentroid("centroid-id");
+  EXPECT_FALSE(snapshotStore->loadUniqueOption("centroid-id").hasValue());
+  EXPECT_FALSE(dbHandle.loadCentroidUniqueOption("centroid-id").hasValue());
+  snapshotStore->removeAll();
+  rmdir(snapshotDir.c_str());
 }
 
 TEST(SyncPersistence, LoadCentroidDoesNotExist) {
@@ -300,7 +405,7 @@ TEST(SyncPersistence, LoadCentroidExists) {
   EXPECT_EQ("centroid-id", centroidPtr->id);
   EXPECT_EQ(5.8, centroidPtr->wordVector.magnitude);
   EXPECT_EQ(2, centroidPtr->wordVector.scores.size());
-  EXPECT_EQ(2.21, centroidPtr->wordVector.scores["blarg"]);
+  EXPECT_EQ(2.21, centroidPtr->wordVector.getTermScores()["blarg"]);
 }
 
 TEST(SyncPersistence, LoadCentroidUniqueOptionHappy) {
@@ -369,6 +474,7 @@ TEST(SyncPersistence, AddDocumentToCentroidHappy) {
   EXPECT_FALSE(res.hasException());
   EXPECT_TRUE(res.value());
   EXPECT_TRUE(mockRock.exists("centroid-id__documents:document-id"));
+  EXPECT_TRUE(mockRock.exists("document-id__centroids:centroid-id"));
 }
 
 TEST(SyncPersistence, AddDocumentToCentroidMissingCentroid) {
@@ -1067,3 +1173,310 @@ TEST(SyncPersistence,
   vector<string> expected{};
   EXPECT_EQ(expected, result.value());
 }
+
+TEST(SyncPersistence, CentroidDocumentChangesUntrackedNeedsFullRebuild) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  mockRock.put("centroids:centroid-id", "x");
+  mockRock.put("documents:doc1", "x");
+  mockRock.put("documents:doc2", "x");
+
+  auto changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_TRUE(changes.needsFullRebuild);
+  dbHandle.finishCentroidUpdate("centroid-id", true);
+
+  dbHandle.addDocumentToCentroid("centroid-id", "doc1");
+  dbHandle.addDocumentToCentroid("centroid-id", "doc2");
+  changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_FALSE(changes.needsFullRebuild);
+  vector<string> expectedAdded {"doc1", "doc2"};
+  EXPECT_EQ(expectedAdded, changes.added);
+  EXPECT_TRUE(changes.removed.empty());
+  dbHandle.finishCentroidUpdate("centroid-id", true);
+
+  dbHandle.removeDocumentFromCentroid("centroid-id", "doc1");
+  changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_FALSE(changes.needsFullRebuild);
+  EXPECT_TRUE(changes.added.empty());
+  vector<string> expectedRemoved {"doc1"};
+  EXPECT_EQ(expectedRemoved, changes.removed);
+}
+
+TEST(SyncPersistence, CentroidDocumentChangesAddThenRemoveCancels) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  mockRock.put("centroids:centroid-id", "x");
+  mockRock.put("documents:doc1", "x");
+  dbHandle.takeCentroidDocumentChanges("centroid-id");
+  dbHandle.finishCentroidUpdate("centroid-id", true);
+
+  dbHandle.addDocumentToCentroid("centroid-id", "doc1");
+  dbHandle.removeDocumentFromCentroid("centroid-id", "doc1");
+  auto changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_FALSE(changes.needsFullRebuild);
+  EXPECT_TRUE(changes.added.empty());
+  EXPECT_TRUE(changes.removed.empty());
+}
+
+TEST(SyncPersistence, CentroidDocumentChangesDuringRebuild) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  mockRock.put("centroids:centroid-id", "x");
+  mockRock.put("documents:doc1", "x");
+
+  auto changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_TRUE(changes.needsFullRebuild);
+  dbHandle.addDocumentToCentroid("centroid-id", "doc1");
+  dbHandle.finishCentroidUpdate("centroid-id", true);
+  changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_TRUE(changes.needsFullRebuild);
+}
+
+TEST(SyncPersistence, CentroidDocumentChangesFailedUpdate) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  mockRock.put("centroids:centroid-id", "x");
+  mockRock.put("documents:doc1", "x");
+  dbHandle.takeCentroidDocumentChanges("centroid-id");
+  dbHandle.finishCentroidUpdate("centroid-id", true);
+
+  dbHandle.addDocumentToCentroid("centroid-id", "doc1");
+  auto changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_FALSE(changes.needsFullRebuild);
+  dbHandle.finishCentroidUpdate("centroid-id", false);
+  changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_TRUE(changes.needsFullRebuild);
+}
+
+TEST(SyncPersistence, CentroidDocumentChangesDeletedDocument) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  mockRock.put("centroids:centroid-id", "x");
+  mockRock.put("documents:doc1", "x");
+  dbHandle.addDocumentToCentroid("centroid-id", "doc1");
+  dbHandle.takeCentroidDocumentChanges("centroid-id");
+  dbHandle.finishCentroidUpdate("centroid-id", true);
+
+  dbHandle.deleteDocument("doc1");
+  auto changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_TRUE(changes.needsFullRebuild);
+}
+
+TEST(SyncPersistence, CentroidDocumentChangesRemovedDocumentChanged) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  ProcessedDocument doc1("doc1");
+  dbHandle.saveDocument(&doc1);
+  dbHandle.createNewCentroid("centroid-1");
+  dbHandle.createNewCentroid("centroid-2");
+  dbHandle.addDocumentToCentroid("centroid-1", "doc1");
+  dbHandle.addDocumentToCentroid("centroid-2", "doc1");
+  dbHandle.takeCentroidDocumentChanges("centroid-1");
+  dbHandle.finishCentroidUpdate("centroid-1", true);
+  dbHandle.takeCentroidDocumentChanges("centroid-2");
+  dbHandle.finishCentroidUpdate("centroid-2", true);
+
+  // only centroid-1 has a pending removal of doc1 once it's
+  // been applied to centroid-2.
+  dbHandle.removeDocumentFromCentroid("centroid-1", "doc1");
+  dbHandle.removeDocumentFromCentroid("centroid-2", "doc1");
+  auto changes = dbHandle.takeCentroidDocumentChanges("centroid-2");
+  EXPECT_FALSE(changes.needsFullRebuild);
+  dbHandle.finishCentroidUpdate("centroid-2", true);
+
+  dbHandle.saveDocument(&doc1);
+  changes = dbHandle.takeCentroidDocumentChanges("centroid-1");
+  EXPECT_TRUE(changes.needsFullRebuild);
+  dbHandle.finishCentroidUpdate("centroid-1", true);
+  changes = dbHandle.takeCentroidDocumentChanges("centroid-2");
+  EXPECT_FALSE(changes.needsFullRebuild);
+  dbHandle.finishCentroidUpdate("centroid-2", true);
+
+  // a removal cancelled by re-adding is no longer pending,
+  // but the document is a member again.
+  dbHandle.removeDocumentFromCentroid("centroid-2", "doc1");
+  dbHandle.addDocumentToCentroid("centroid-2", "doc1");
+  dbHandle.deleteDocument("doc1");
+  changes = dbHandle.takeCentroidDocumentChanges("centroid-1");
+  EXPECT_FALSE(changes.needsFullRebuild);
+  changes = dbHandle.takeCentroidDocumentChanges("centroid-2");
+  EXPECT_TRUE(changes.needsFullRebuild);
+}
+
+TEST(SyncPersistence, InvalidateCentroidDocumentChanges) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  mockRock.put("centroids:centroid-id", "x");
+  dbHandle.takeCentroidDocumentChanges("centroid-id");
+  dbHandle.finishCentroidUpdate("centroid-id", true);
+  dbHandle.invalidateCentroidDocumentChanges("centroid-id");
+  auto changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_TRUE(changes.needsFullRebuild);
+}
+
+TEST(SyncPersistence, FailedWritesLeaveJournalsAlone) {
+  FailingWriteRockHandle mockRock;
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  mockRock.put("centroids:centroid-id", "x");
+  mockRock.put("documents:doc1", "x");
+  mockRock.put("documents:doc2", "x");
+  dbHandle.addDocumentToCentroid("centroid-id", "doc2");
+  dbHandle.takeCentroidDocumentChanges("centroid-id");
+  dbHandle.finishCentroidUpdate("centroid-id", true);
+
+  mockRock.failWrites = true;
+  EXPECT_TRUE(dbHandle.addDocumentToCentroid("centroid-id", "doc1")
+    .hasException<std::runtime_error>());
+  EXPECT_TRUE(dbHandle.removeDocumentFromCentroid("centroid-id", "doc2")
+    .hasException<std::runtime_error>());
+  EXPECT_TRUE(dbHandle.deleteDocument("doc2")
+    .hasException<std::runtime_error>());
+  EXPECT_TRUE(dbHandle.deleteCentroid("centroid-id")
+    .hasException<std::runtime_error>());
+  ProcessedDocument doc2("doc2");
+  EXPECT_TRUE(dbHandle.saveDocument(&doc2)
+    .hasException<std::runtime_error>());
+  EXPECT_FALSE(mockRock.exists("centroid-id__documents:doc1"));
+  EXPECT_TRUE(mockRock.exists("centroid-id__documents:doc2"));
+  EXPECT_TRUE(mockRock.exists("centroids:centroid-id"));
+
+  auto changes = dbHandle.takeCentroidDocumentChanges("centroid-id");
+  EXPECT_FALSE(changes.needsFullRebuild);
+  EXPECT_TRUE(changes.added.empty());
+  EXPECT_TRUE(changes.removed.empty());
+}
+
+TEST(SyncPersistence, UnusedDocumentIndexFollowsMembership) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  ProcessedDocument doc1("doc-1");
+  ProcessedDocument doc2("doc-2");
+  EXPECT_TRUE(dbHandle.saveDocument(&doc1).hasValue());
+  EXPECT_TRUE(dbHandle.saveDocument(&doc2).hasValue());
+  EXPECT_TRUE(dbHandle.createNewCentroid("centroid-1").hasValue());
+  EXPECT_TRUE(dbHandle.createNewCentroid("centroid-2").hasValue());
+  vector<string> both {"doc-1", "doc-2"};
+  EXPECT_EQ(both, dbHandle.listUnusedDocuments(0));
+
+  dbHandle.addDocumentToCentroid("centroid-1", "doc-1");
+  dbHandle.addDocumentToCentroid("centroid-2", "doc-1");
+  vector<string> onlyDoc2 {"doc-2"};
+  EXPECT_EQ(onlyDoc2, dbHandle.listUnusedDocuments(0));
+
+  // still held by centroid-2.
+  dbHandle.removeDocumentFromCentroid("centroid-1", "doc-1");
+  EXPECT_EQ(onlyDoc2, dbHandle.listUnusedDocuments(0));
+
+  dbHandle.deleteCentroid("centroid-2");
+  EXPECT_FALSE(mockRock.exists("doc-1__centroids:centroid-2"));
+  EXPECT_EQ(both, dbHandle.listUnusedDocuments(0));
+
+  vector<string> onlyDoc1 {"doc-1"};
+  EXPECT_EQ(onlyDoc1, dbHandle.listUnusedDocuments(1));
+  dbHandle.deleteDocument("doc-1");
+  EXPECT_EQ(onlyDoc2, dbHandle.listUnusedDocuments(0));
+}
+
+TEST(SyncPersistence, BuildUnusedDocumentIndex) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  mockRock.put("centroids:centroid-1", "x");
+  mockRock.put("documents:doc-1", "x");
+  mockRock.put("documents:doc-2", "x");
+  mockRock.put("documents:doc-3", "x");
+  mockRock.put("doc-2__centroids:centroid-1", "1");
+  mockRock.put("centroid-1__documents:doc-2", "1");
+
+  // left behind by a deleted centroid.
+  mockRock.put("doc-3__centroids:centroid-gone", "1");
+  auto indexed = dbHandle.buildUnusedDocumentIndex();
+  EXPECT_TRUE(indexed.hasValue());
+  EXPECT_EQ(2, indexed.value());
+  vector<string> expected {"doc-1", "doc-3"};
+  EXPECT_EQ(expected, dbHandle.listUnusedDocuments(0));
+  EXPECT_FALSE(mockRock.exists("unused_documents:doc-2"));
+  EXPECT_FALSE(mockRock.exists("doc-3__centroids:centroid-gone"));
+  EXPECT_TRUE(mockRock.exists("doc-2__centroids:centroid-1"));
+
+  // built once.
+  mockRock.put("documents:doc-4", "x");
+  indexed = dbHandle.buildUnusedDocumentIndex();
+  EXPECT_TRUE(indexed.hasValue());
+  EXPECT_EQ(0, indexed.value());
+  EXPECT_FALSE(mockRock.exists("unused_documents:doc-4"));
+}
+
+TEST(SyncPersistence, BuildUnusedDocumentIndexWriteFailure) {
+  FailingWriteRockHandle mockRock;
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  mockRock.put("documents:doc-1", "x");
+  mockRock.failWrites = true;
+  EXPECT_TRUE(dbHandle.buildUnusedDocumentIndex()
+    .hasException<std::runtime_error>());
+  EXPECT_FALSE(mockRock.exists("unused_documents_index:version"));
+
+  mockRock.failWrites = false;
+  auto indexed = dbHandle.buildUnusedDocumentIndex();
+  EXPECT_TRUE(indexed.hasValue());
+  EXPECT_EQ(1, indexed.value());
+  EXPECT_TRUE(mockRock.exists("unused_documents:doc-1"));
+}
+
+TEST(SyncPersistence, DeleteOldUnusedDocuments) {
+  InMemoryRockHandle mockRock("/some-path");
+  UniquePointer<RockHandleIf> rockHandle(&mockRock, NonDeleter<RockHandleIf>());
+  MockClock mockClock;
+  shared_ptr<ClockIf> clockPtr(&mockClock, NonDeleter<ClockIf>());
+  SyncPersistence dbHandle(clockPtr, std::move(rockHandle));
+  ProcessedDocument oldDoc("old-doc");
+  oldDoc.created = 100;
+  ProcessedDocument newDoc("new-doc");
+  newDoc.created = 950;
+  ProcessedDocument usedDoc("used-doc");
+  usedDoc.created = 100;
+  dbHandle.saveDocument(&oldDoc);
+  dbHandle.saveDocument(&newDoc);
+  dbHandle.saveDocument(&usedDoc);
+  dbHandle.createNewCentroid("centroid-1");
+  dbHandle.addDocumentToCentroid("centroid-1", "used-doc");
+  EXPECT_CALL(mockClock, getEpochTime()).WillOnce(Return(1000));
+  EXPECT_EQ(1, dbHandle.deleteOldUnusedDocuments(500, 0));
+  EXPECT_FALSE(dbHandle.doesDocumentExist("old-doc"));
+  EXPECT_TRUE(dbHandle.doesDocumentExist("new-doc"));
+  EXPECT_TRUE(dbHandle.doesDocumentExist("used-doc"));
+  vector<string> expected {"new-doc"};
+  EXPECT_EQ(expected, dbHandle.listUnusedDocuments(0));
+}
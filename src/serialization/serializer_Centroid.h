@@ -46,7 +46,7 @@ struct BinarySerializer<Centroid> {
   static void serialize(std::string &result, Centroid &target) {
     thrift_protocol::CentroidDTO docDto;
     docDto.id = target.id;
-    docDto.wordVector.scores = target.wordVector.scores;
+    docDto.wordVector.scores = target.wordVector.getTermScores();
     docDto.wordVector.magnitude = target.wordVector.magnitude;
     docDto.wordVector.documentWeight = target.wordVector.documentWeight;
     serialization::thriftBinarySerialize(result, docDto);
@@ -59,7 +59,7 @@ struct BinaryDeserializer<Centroid> {
     thrift_protocol::CentroidDTO docDto;
     serialization::thriftBinaryDeserialize(data, docDto);
     result->id = docDto.id;
-    result->wordVector.scores = docDto.wordVector.scores;
+    result->wordVector.assignTermScores(docDto.wordVector.scores);
     result->wordVector.magnitude = docDto.wordVector.magnitude;
     result->wordVector.documentWeight = docDto.wordVector.documentWeight;
   }
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <map>
 #include <folly/dynamic.h>
@@ -10,6 +12,7 @@
 #include "serialization/serializer_details.h"
 #include "gen-cpp2/RelevancedProtocol_types.h"
 #include "text_util/ScoredWord.h"
+#include "text_util/TermDictionary.h"
 namespace folly {
 
 using namespace std;
@@ -22,8 +25,7 @@ struct DynamicConstructor<ProcessedDocument> {
   static folly::dynamic construct(const ProcessedDocument &doc) {
     WordVector wordVec;
     for (auto &elem: doc.scoredWords) {
-      string k = elem.word;
-      wordVec.scores.insert(make_pair(k, elem.score));
+      wordVec.scores.add(elem.termId, elem.score);
     }
     wordVec.magnitude = doc.magnitude;
     auto dWordVec = folly::toDynamic(wordVec);
@@ -66,6 +68,31 @@ namespace serialization {
 using models::WordVector;
 using models::ProcessedDocument;
 using text_util::ScoredWord;
+using text_util::TermDictionary;
+
+namespace processed_document_detail {
+
+// weights are packed as little-endian float32 regardless of host
+// byte order, four bytes per term.
+inline void appendWeight(std::string &buff, float weight) {
+  uint32_t bits;
+  memcpy(&bits, &weight, sizeof(bits));
+  for (size_t i = 0; i < 4; i++) {
+    buff.push_back((char) ((bits >> (8 * i)) & 0xff));
+  }
+}
+
+inline float readWeight(const std::string &buff, size_t idx) {
+  uint32_t bits = 0;
+  for (size_t i = 0; i < 4; i++) {
+    bits |= ((uint32_t) (uint8_t) buff[4 * idx + i]) << (8 * i);
+  }
+  float weight;
+  memcpy(&weight, &bits, sizeof(weight));
+  return weight;
+}
+
+} // processed_document_detail
 
 template <>
 struct BinarySerializer<ProcessedDocument> {
@@ -73,12 +100,18 @@ struct BinarySerializer<ProcessedDocument> {
     thrift_protocol::ProcessedDocumentPersistenceDTO docDto;
     thrift_protocol::ProcessedDocumentMetadataDTO metadataDto;
 
+    // term ids don't survive a restart, so terms are written as
+    // strings; weights go into one packed buffer instead of a
+    // struct per term.
+    auto dictionary = TermDictionary::getDefault();
+    docDto.terms.reserve(target.scoredWords.size());
+    docDto.weights.reserve(4 * target.scoredWords.size());
     for (auto &elem: target.scoredWords) {
-      thrift_protocol::ScoredWordDTO wordDto;
-      wordDto.wordBuff = elem.word;
-      wordDto.score = elem.score;
-      docDto.scoredWords.push_back(wordDto);
+      docDto.terms.push_back(dictionary->getTerm(elem.termId));
+      processed_document_detail::appendWeight(docDto.weights, elem.score);
     }
+    docDto.__isset.terms = true;
+    docDto.__isset.weights = true;
     docDto.magnitude = target.magnitude;
 
     metadataDto.id = target.id;
@@ -99,10 +132,27 @@ struct BinaryDeserializer<ProcessedDocument> {
   static void deserialize(std::string &data, ProcessedDocument *result) {
     thrift_protocol::ProcessedDocumentPersistenceDTO docDto;
     serialization::thriftBinaryDeserialize(data, docDto);
-    for (auto &elem: docDto.scoredWords) {
-      uint8_t buffSize = (uint8_t) elem.wordBuff.size();
-      result->scoredWords.push_back(ScoredWord{elem.wordBuff.c_str(), buffSize, elem.score});
+    if (docDto.__isset.terms) {
+      size_t count = std::min(docDto.terms.size(), docDto.weights.size() / 4);
+      result->scoredWords.reserve(count);
+      for (size_t i = 0; i < count; i++) {
+        auto &term = docDto.terms[i];
+        result->scoredWords.push_back(ScoredWord(
+          term.c_str(), term.size(),
+          processed_document_detail::readWeight(docDto.weights, i)
+        ));
+      }
+    } else {
+      // written before weights were packed.
+      for (auto &elem: docDto.scoredWords) {
+        result->scoredWords.push_back(ScoredWord(
+          elem.wordBuff.c_str(), elem.wordBuff.size(), elem.score
+        ));
+      }
     }
+    // term ids are assigned per process, so the persisted
+    // order can't be trusted.
+    result->sortScoredWords();
     result->magnitude = docDto.magnitude;
     result->updated = docDto.metadata.updated;
     result->created = docDto.metadata.created;
@@ -17,7 +17,7 @@ using relevanced::models::WordVector;
 template <>
 struct DynamicConstructor<WordVector> {
   static folly::dynamic construct(const WordVector &wordVec) {
-    auto scores = folly::toDynamic(wordVec.scores);
+    auto scores = folly::toDynamic(wordVec.getTermScores());
     folly::dynamic self = folly::dynamic::object;
     self["magnitude"] = wordVec.magnitude;
     self["scores"] = scores;
@@ -33,7 +33,7 @@ struct DynamicConverter<WordVector> {
         folly::convertTo<std::unordered_map<std::string, double>>(dyn["scores"]);
     auto magnitude = folly::convertTo<double>(dyn["magnitude"]);
     auto weight = folly::convertTo<double>(dyn["documentWeight"]);
-    return WordVector(std::move(scores), magnitude, weight);
+    return WordVector(scores, magnitude, weight);
   }
 };
 } // folly
@@ -48,7 +48,7 @@ template <>
 struct BinarySerializer<WordVector> {
   static void serialize(std::string &result, WordVector &target) {
     thrift_protocol::WordVectorDTO vecDto;
-    vecDto.scores = target.scores;
+    vecDto.scores = target.getTermScores();
     vecDto.documentWeight = target.documentWeight;
     vecDto.magnitude = target.magnitude;
     serialization::thriftBinarySerialize(result, vecDto);
@@ -62,7 +62,7 @@ struct BinaryDeserializer<WordVector> {
     serialization::thriftBinaryDeserialize(data, vecDto);
     result->magnitude = vecDto.magnitude;
     result->documentWeight = vecDto.documentWeight;
-    result->scores = std::move(vecDto.scores);
+    result->assignTermScores(vecDto.scores);
   }
 };
 
@@ -32,6 +32,6 @@ TEST(TestCentroidSerialization, TestBinarySerialization) {
     {"cats", 0.5},
     {"dogs", 1.6}
   };
-  EXPECT_EQ(expectedScores, result.wordVector.scores);
+  EXPECT_EQ(expectedScores, result.wordVector.getTermScores());
   EXPECT_EQ(22.8, result.wordVector.magnitude);
 }
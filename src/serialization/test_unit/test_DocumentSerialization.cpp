@@ -7,6 +7,8 @@
 #include <cstdio>
 #include <cstring>
 #include "serialization/serializers.h"
+#include "serialization/serializer_details.h"
+#include "gen-cpp2/RelevancedProtocol_types.h"
 #include "models/ProcessedDocument.h"
 #include "text_util/ScoredWord.h"
 
@@ -32,3 +34,41 @@ TEST(TestDocumentSerialization, TestBinarySerialization) {
   EXPECT_EQ(2, result.scoredWords.size());
   EXPECT_EQ(15.3, result.magnitude);
 }
+
+TEST(TestDocumentSerialization, TestBinaryRoundTripKeepsTerms) {
+  string longWord = "donaudampfschifffahrtsgesellschaftskapitaen";
+  vector<ScoredWord> scores {
+    ScoredWord("foo", 3, 0.25),
+    ScoredWord(longWord.c_str(), longWord.size(), 0.75)
+  };
+  ProcessedDocument doc("doc-id", scores, 0.8);
+  string data;
+  serialization::binarySerialize(data, doc);
+  ProcessedDocument result("");
+  serialization::binaryDeserialize(data, &result);
+  map<string, float> resultScores;
+  for (auto &word : result.scoredWords) {
+    resultScores[word.getWord()] = word.score;
+  }
+  map<string, float> expected {{"foo", 0.25}, {longWord, 0.75}};
+  EXPECT_EQ(expected, resultScores);
+}
+
+TEST(TestDocumentSerialization, TestReadsUnpackedScoredWords) {
+  thrift_protocol::ProcessedDocumentPersistenceDTO docDto;
+  docDto.metadata.id = "doc-id";
+  thrift_protocol::ScoredWordDTO wordDto;
+  wordDto.wordBuff = "bar";
+  wordDto.score = 0.5;
+  docDto.scoredWords.push_back(wordDto);
+  docDto.__isset.scoredWords = true;
+  docDto.magnitude = 0.5;
+  string data;
+  serialization::thriftBinarySerialize(data, docDto);
+  ProcessedDocument result("");
+  serialization::binaryDeserialize(data, &result);
+  EXPECT_EQ("doc-id", result.id);
+  ASSERT_EQ(1, result.scoredWords.size());
+  EXPECT_EQ("bar", result.scoredWords[0].getWord());
+  EXPECT_EQ(0.5, result.scoredWords[0].score);
+}
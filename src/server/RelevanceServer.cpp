@@ -5,6 +5,7 @@
 #include <folly/futures/helpers.h>
 #include <folly/futures/Try.h>
 #include <folly/Optional.h>
+#include <folly/Conv.h>
 #include <folly/Format.h>
 #include <folly/ExceptionWrapper.h>
 
@@ -13,6 +14,7 @@
 #include "centroid_update_worker/CentroidUpdateWorker.h"
 #include "document_processing_worker/DocumentProcessor.h"
 #include "document_processing_worker/DocumentProcessingWorker.h"
+#include "document_processing_worker/DocumentUpload.h"
 #include "models/Document.h"
 #include "models/Centroid.h"
 #include "models/ProcessedDocument.h"
@@ -35,6 +37,7 @@ using namespace relevanced::thrift_protocol;
 using similarity_score_worker::SimilarityScoreWorkerIf;
 using centroid_update_worker::CentroidUpdateWorkerIf;
 using document_processing_worker::DocumentProcessingWorkerIf;
+using document_processing_worker::DocumentUpload;
 using models::Document;
 using models::ProcessedDocument;
 using models::Centroid;
@@ -68,6 +71,15 @@ void RelevanceServer::initialize() {
     });
 }
 
+void RelevanceServer::initializeInBackground() {
+  centroidUpdateWorker_->initialize();
+  scoreWorker_->initializeInBackground();
+  centroidUpdateWorker_->onUpdate(
+    [this](const string &id) {
+      scoreWorker_->reloadCentroid(id);
+    });
+}
+
 
 Future<Try<double>> RelevanceServer::getDocumentSimilarity(
     unique_ptr<string> centroidId, unique_ptr<string> docId) {
@@ -99,38 +111,7 @@ Future<Try<unique_ptr<map<string, double>>>>
 RelevanceServer::internalMultiGetDocumentSimilarity(
     shared_ptr<vector<string>> centroidIds,
     shared_ptr<ProcessedDocument> doc) {
-  vector<Future<Try<double>>> scores;
-  for (size_t i = 0; i < centroidIds->size(); i++) {
-    scores.push_back(
-      scoreWorker_->getDocumentSimilarity(
-        centroidIds->at(i), doc
-      )
-    );
-  }
-  return collect(scores)
-    .then([this, centroidIds](Try<vector<Try<double>>> scores) {
-      if (scores.hasException()) {
-        return Try<unique_ptr<map<string, double>>>(
-          scores.exception()
-        );
-      }
-      auto scoreVals = scores.value();
-      auto response = folly::make_unique<map<string, double>>();
-      for (size_t i = 0; i < centroidIds->size(); i++) {
-        auto currentScoreVal = scoreVals.at(i);
-        if (currentScoreVal.hasException()) {
-          return Try<unique_ptr<map<string, double>>>(
-            currentScoreVal.exception()
-          );
-        }
-        response->insert(make_pair(
-          centroidIds->at(i), currentScoreVal.value()
-        ));
-      }
-      return Try<unique_ptr<map<string, double>>>(
-        std::move(response)
-      );
-    });
+  return scoreWorker_->multiGetDocumentSimilarity(centroidIds, doc);
 }
 
 
@@ -139,9 +120,9 @@ RelevanceServer::multiGetTextSimilarity(
     unique_ptr<vector<string>> centroidIds,
     unique_ptr<string> text,
     Language lang) {
-  auto doc = std::make_shared<Document>("no-id", *text, lang);
-  auto cIds = std::make_shared<vector<string>>(*centroidIds);
-  return processingWorker_->processNew(doc)
+  auto doc = std::make_shared<Document>("no-id", std::move(*text), lang);
+  auto cIds = std::make_shared<vector<string>>(std::move(*centroidIds));
+  return processingWorker_->processForScoring(doc)
     .then([this, cIds](shared_ptr<ProcessedDocument> processed) {
       return internalMultiGetDocumentSimilarity(cIds, processed);
     });
@@ -151,7 +132,7 @@ RelevanceServer::multiGetTextSimilarity(
 Future<Try<unique_ptr<map<string, double>>>>
 RelevanceServer::multiGetDocumentSimilarity(
     unique_ptr<vector<string>> centroidIds, unique_ptr<string> docId) {
-  auto cIds = std::make_shared<vector<string>>(*centroidIds);
+  auto cIds = std::make_shared<vector<string>>(std::move(*centroidIds));
   return persistence_->loadDocument(*docId)
     .then([this, cIds](Try<shared_ptr<ProcessedDocument>> doc)  {
       if (doc.hasException()) {
@@ -167,13 +148,72 @@ RelevanceServer::multiGetDocumentSimilarity(
 }
 
 
+Future<Try<unique_ptr<vector<map<string, double>>>>>
+RelevanceServer::multiGetTextSimilarityBatch(
+    unique_ptr<vector<string>> texts,
+    unique_ptr<vector<string>> centroidIds,
+    Language lang) {
+  // the documents are never persisted, so there's no point
+  // in hashing them or interning their terms.
+  vector<Future<shared_ptr<ProcessedDocument>>> processed;
+  processed.reserve(texts->size());
+  for (auto &text : *texts) {
+    auto doc = std::make_shared<Document>("no-id", std::move(text), lang);
+    processed.push_back(processingWorker_->processForScoring(doc));
+  }
+  auto cIds = std::make_shared<vector<string>>(std::move(*centroidIds));
+  return collect(processed)
+    .then([this, cIds](vector<shared_ptr<ProcessedDocument>> docs) {
+      auto docPtrs = std::make_shared<vector<shared_ptr<ProcessedDocument>>>(
+        std::move(docs)
+      );
+      return scoreWorker_->multiGetDocumentSimilarityBatch(cIds, docPtrs);
+    });
+}
+
+
+Future<Try<unique_ptr<vector<pair<string, double>>>>>
+RelevanceServer::getTextBestMatchingCentroids(
+    unique_ptr<string> text, Language lang, size_t count) {
+  auto doc = std::make_shared<Document>("no-id", std::move(*text), lang);
+  return processingWorker_->processForScoring(doc)
+    .then([this, count](shared_ptr<ProcessedDocument> processed) {
+      return scoreWorker_->getBestMatchingCentroids(processed, count);
+    })
+    .then([](unique_ptr<vector<pair<string, double>>> matches) {
+      return Try<unique_ptr<vector<pair<string, double>>>>(
+        std::move(matches)
+      );
+    });
+}
+
+
+Future<Try<unique_ptr<vector<pair<string, double>>>>>
+RelevanceServer::getDocumentBestMatchingCentroids(
+    unique_ptr<string> docId, size_t count) {
+  typedef Try<unique_ptr<vector<pair<string, double>>>> TResult;
+  return persistence_->loadDocument(*docId)
+    .then([this, count](Try<shared_ptr<ProcessedDocument>> doc) {
+      if (doc.hasException()) {
+        return makeFuture<TResult>(TResult(doc.exception()));
+      }
+      return scoreWorker_->getBestMatchingCentroids(doc.value(), count)
+        .then([](unique_ptr<vector<pair<string, double>>> matches) {
+          return TResult(std::move(matches));
+        });
+    });
+}
+
+
 Future<Try<double>> RelevanceServer::getTextSimilarity(
     unique_ptr<string> centroidId,
     unique_ptr<string> text,
     Language lang) {
-  auto doc = std::make_shared<Document>("no-id", *text, lang);
-  auto cId = *centroidId;
-  return processingWorker_->processNew(doc)
+  // the text is moved rather than copied all the way into the
+  // tokenizer, and since it's never persisted it isn't hashed.
+  auto doc = std::make_shared<Document>("no-id", std::move(*text), lang);
+  auto cId = std::move(*centroidId);
+  return processingWorker_->processForScoring(doc)
     .then([this, cId](shared_ptr<ProcessedDocument> processed) {
       return scoreWorker_->getDocumentSimilarity(cId, processed);
     });
@@ -182,36 +222,172 @@ Future<Try<double>> RelevanceServer::getTextSimilarity(
 
 Future<Try<unique_ptr<string>>> RelevanceServer::createDocument(
     unique_ptr<string> text, Language lang) {
-  return internalCreateDocumentWithID(util::getUuid(), *text, lang);
+  return internalCreateDocumentWithID(util::getUuid(), std::move(*text), lang);
 }
 
 
 Future<Try<unique_ptr<string>>> RelevanceServer::internalCreateDocumentWithID(
     string id, string text, Language lang) {
-  auto doc = std::make_shared<Document>(id, text, lang);
+  auto doc = std::make_shared<Document>(id, std::move(text), lang);
   return processingWorker_->processNew(doc)
-    .then([this, id](shared_ptr<ProcessedDocument> processed) {
-      return persistence_->saveNewDocument(processed)
-        .then([this, id](Try<bool> result) {
-          if (result.hasException()) {
-            return Try<unique_ptr<string>>(
-              result.exception()
-            );
-          }
-          return Try<unique_ptr<string>>(
-            folly::make_unique<string>(id)
-          );
-        });
+    .then([this](shared_ptr<ProcessedDocument> processed) {
+      return saveNewDocument(processed);
+    });
+}
+
+Future<Try<unique_ptr<string>>> RelevanceServer::saveNewDocument(
+    shared_ptr<ProcessedDocument> processed) {
+  auto id = processed->id;
+  return persistence_->saveNewDocument(processed)
+    .then([id](Try<bool> result) {
+      if (result.hasException()) {
+        return Try<unique_ptr<string>>(
+          result.exception()
+        );
+      }
+      return Try<unique_ptr<string>>(
+        folly::make_unique<string>(id)
+      );
     });
 }
 
 
 Future<Try<unique_ptr<string>>> RelevanceServer::createDocumentWithID(
     unique_ptr<string> id, unique_ptr<string> text, Language lang) {
-  return internalCreateDocumentWithID(*id, *text, lang);
+  return internalCreateDocumentWithID(*id, std::move(*text), lang);
 }
 
 
+void RelevanceServer::setUploadLimits(size_t maxUploads, int64_t idleSeconds) {
+  maxUploads_ = maxUploads;
+  uploadIdleSeconds_ = idleSeconds;
+}
+
+size_t RelevanceServer::expireIdleUploads() {
+  auto now = clock_->getEpochTime();
+  lastUploadSweep_ = now;
+  size_t expired = 0;
+  SYNCHRONIZED(uploads_) {
+    for (auto it = uploads_.begin(); it != uploads_.end();) {
+      if (now - it->second->lastActivity >= uploadIdleSeconds_) {
+        it = uploads_.erase(it);
+        expired++;
+      } else {
+        ++it;
+      }
+    }
+  }
+  if (expired > 0) {
+    LOG(INFO) << "expired " << expired << " idle document uploads";
+  }
+  return expired;
+}
+
+Try<unique_ptr<string>> RelevanceServer::addUpload(
+    string documentId, Language lang) {
+  auto now = clock_->getEpochTime();
+  if (now - lastUploadSweep_ >= kUploadSweepIntervalSeconds) {
+    expireIdleUploads();
+  }
+  auto uploadId = util::getUuid();
+  auto upload = std::make_shared<DocumentUpload>(documentId, lang);
+  upload->lastActivity = now;
+  for (size_t attempt = 0; attempt < 2; attempt++) {
+    bool added = false;
+    SYNCHRONIZED(uploads_) {
+      if (uploads_.size() < maxUploads_) {
+        uploads_.insert(make_pair(uploadId, upload));
+        added = true;
+      }
+    }
+    if (added) {
+      return Try<unique_ptr<string>>(folly::make_unique<string>(uploadId));
+    }
+    if (attempt == 0) {
+      // some of the uploads holding the cap may be abandoned.
+      expireIdleUploads();
+    }
+  }
+  ETooManyUploads err;
+  err.message = folly::to<string>(
+    "at most ", maxUploads_, " document uploads can be in progress"
+  );
+  return Try<unique_ptr<string>>(make_exception_wrapper<ETooManyUploads>(err));
+}
+
+shared_ptr<DocumentUpload> RelevanceServer::findUpload(
+    const string &uploadId, bool take) {
+  shared_ptr<DocumentUpload> upload;
+  SYNCHRONIZED(uploads_) {
+    auto found = uploads_.find(uploadId);
+    if (found != uploads_.end()) {
+      upload = found->second;
+      if (take) {
+        uploads_.erase(found);
+      } else {
+        upload->lastActivity = clock_->getEpochTime();
+      }
+    }
+  }
+  return upload;
+}
+
+Future<Try<unique_ptr<string>>> RelevanceServer::beginDocumentUpload(
+    Language lang) {
+  return makeFuture(addUpload(util::getUuid(), lang));
+}
+
+Future<Try<unique_ptr<string>>> RelevanceServer::beginDocumentUploadWithID(
+    unique_ptr<string> id, Language lang) {
+  // checked again on commit; this just fails fast.
+  string documentId = *id;
+  return persistence_->doesDocumentExist(documentId)
+    .then([this, documentId, lang](bool exists) {
+      if (exists) {
+        return Try<unique_ptr<string>>(
+          make_exception_wrapper<EDocumentAlreadyExists>()
+        );
+      }
+      return addUpload(documentId, lang);
+    });
+}
+
+Future<Try<bool>> RelevanceServer::appendDocumentUpload(
+    unique_ptr<string> uploadId, unique_ptr<string> text) {
+  auto upload = findUpload(*uploadId, false);
+  if (!upload) {
+    return makeFuture<Try<bool>>(Try<bool>(
+      make_exception_wrapper<EUploadDoesNotExist>()
+    ));
+  }
+  shared_ptr<string> chunk(text.release());
+  return processingWorker_->appendToUpload(upload, chunk);
+}
+
+Future<Try<unique_ptr<string>>> RelevanceServer::commitDocumentUpload(
+    unique_ptr<string> uploadId) {
+  auto upload = findUpload(*uploadId, true);
+  if (!upload) {
+    return makeFuture<Try<unique_ptr<string>>>(Try<unique_ptr<string>>(
+      make_exception_wrapper<EUploadDoesNotExist>()
+    ));
+  }
+  return processingWorker_->finishUpload(upload)
+    .then([this](shared_ptr<ProcessedDocument> processed) {
+      return saveNewDocument(processed);
+    });
+}
+
+Future<Try<bool>> RelevanceServer::abortDocumentUpload(
+    unique_ptr<string> uploadId) {
+  if (!findUpload(*uploadId, true)) {
+    return makeFuture<Try<bool>>(Try<bool>(
+      make_exception_wrapper<EUploadDoesNotExist>()
+    ));
+  }
+  return makeFuture<Try<bool>>(Try<bool>(true));
+}
+
 Future<Try<bool>> RelevanceServer::deleteDocument(
     unique_ptr<string> id, bool ignoreMissing) {
   return persistence_->deleteDocument(*id)
@@ -280,11 +456,18 @@ Future<Try<bool>> RelevanceServer::deleteCentroid(
     unique_ptr<string> centroidId, bool ignoreMissing) {
   auto cId = *centroidId;
   return persistence_->deleteCentroid(cId)
-    .then([ignoreMissing](Try<bool> result) {
+    .then([this, cId, ignoreMissing](Try<bool> result) {
       if (result.hasException<ECentroidDoesNotExist>() && ignoreMissing) {
-        return Try<bool>(false);
+        return makeFuture(Try<bool>(false));
       }
-      return result;
+      if (result.hasException()) {
+        return makeFuture(result);
+      }
+      // otherwise best-match queries, which walk every loaded
+      // centroid, would keep returning it.
+      return scoreWorker_->removeCentroid(cId).then([result](bool) {
+        return result;
+      });
     });
 }
 
@@ -505,6 +688,33 @@ Future<unique_ptr<vector<Try<bool>>>> RelevanceServer::multiJoinCentroids(
   });
 }
 
+Future<Try<bool>> RelevanceServer::rebuildCentroid(
+    unique_ptr<string> centroidId) {
+  string cId = *centroidId;
+  return persistence_->doesCentroidExist(cId)
+    .then([this, cId](bool exists) {
+      if (!exists) {
+        Try<bool> result(make_exception_wrapper<ECentroidDoesNotExist>());
+        return makeFuture(result);
+      }
+      // dropping the tracked changes forces the next
+      // update onto the full recalculation path.
+      return persistence_->invalidateCentroidDocumentChanges(cId)
+        .then([this, cId]() {
+          return centroidUpdateWorker_->joinUpdate(cId);
+        })
+        .then([this, cId](Try<string> result) {
+          if (result.hasException()) {
+            Try<bool> toReturn(result.exception());
+            return makeFuture(toReturn);
+          }
+          return scoreWorker_->reloadCentroid(cId).then([](){
+            return Try<bool>(true);
+          });
+        });
+    });
+}
+
 Future<unique_ptr<vector<string>>> RelevanceServer::listAllCentroids() {
   return persistence_->listAllCentroids()
     .then([](vector<string> centroidIds) {
@@ -591,6 +801,28 @@ Future<unique_ptr<map<string, string>>> RelevanceServer::getServerMetadata() {
     "relevanced_utc_build_timestamp",
     release_metadata::getUtcBuildTimestamp()
   ));
+  auto progress = scoreWorker_->getLoadProgress();
+  metadata->insert(make_pair(
+    "centroids_loaded",
+    folly::to<string>(progress.loaded)
+  ));
+  metadata->insert(make_pair(
+    "centroids_total",
+    folly::to<string>(progress.total)
+  ));
+  metadata->insert(make_pair(
+    "centroid_loading_complete",
+    progress.complete ? "true" : "false"
+  ));
+  auto stemCache = processingWorker_->getStemCacheStats();
+  metadata->insert(make_pair(
+    "stem_cache_hits",
+    folly::to<string>(stemCache.hits)
+  ));
+  metadata->insert(make_pair(
+    "stem_cache_misses",
+    folly::to<string>(stemCache.misses)
+  ));
   return makeFuture(std::move(metadata));
 }
 
@@ -1,6 +1,12 @@
 #pragma once
+#include <atomic>
+#include <cstdint>
+#include <map>
 #include <string>
 #include <memory>
+#include <utility>
+#include <vector>
+#include <folly/Synchronized.h>
 #include <folly/futures/Future.h>
 #include <folly/futures/helpers.h>
 #include <folly/futures/Try.h>
@@ -18,6 +24,10 @@ class RelevanceServerIf {
   virtual void ping() = 0;
   virtual void initialize() = 0;
 
+  // starts serving before all centroids are loaded; see
+  // `SimilarityScoreWorkerIf::initializeInBackground`.
+  virtual void initializeInBackground() = 0;
+
   virtual folly::Future<std::unique_ptr<std::map<std::string, std::string>>>
     getServerMetadata() = 0;
 
@@ -40,6 +50,26 @@ class RelevanceServerIf {
       std::unique_ptr<std::string> docId
     ) = 0;
 
+  virtual folly::Future<folly::Try<std::unique_ptr<std::vector<std::map<std::string, double>>>>>
+    multiGetTextSimilarityBatch(
+      std::unique_ptr<std::vector<std::string>> texts,
+      std::unique_ptr<std::vector<std::string>> centroidIds,
+      thrift_protocol::Language
+    ) = 0;
+
+  virtual folly::Future<folly::Try<std::unique_ptr<std::vector<std::pair<std::string, double>>>>>
+    getTextBestMatchingCentroids(
+      std::unique_ptr<std::string> text,
+      thrift_protocol::Language,
+      size_t count
+    ) = 0;
+
+  virtual folly::Future<folly::Try<std::unique_ptr<std::vector<std::pair<std::string, double>>>>>
+    getDocumentBestMatchingCentroids(
+      std::unique_ptr<std::string> docId,
+      size_t count
+    ) = 0;
+
   virtual folly::Future<folly::Try<double>>
     getTextSimilarity(
       std::unique_ptr<std::string> centroidId,
@@ -66,6 +96,32 @@ class RelevanceServerIf {
       thrift_protocol::Language
     ) = 0;
 
+  // `createDocument` for texts too large to send in one call.  The
+  // text follows in any number of `appendDocumentUpload` calls, each
+  // tokenized as it arrives, and the document is saved on commit.
+  // Both return the new upload's ID, or raise `ETooManyUploads`.
+  virtual folly::Future<folly::Try<std::unique_ptr<std::string>>>
+    beginDocumentUpload(thrift_protocol::Language) = 0;
+
+  virtual folly::Future<folly::Try<std::unique_ptr<std::string>>>
+    beginDocumentUploadWithID(
+      std::unique_ptr<std::string> id,
+      thrift_protocol::Language
+    ) = 0;
+
+  virtual folly::Future<folly::Try<bool>>
+    appendDocumentUpload(
+      std::unique_ptr<std::string> uploadId,
+      std::unique_ptr<std::string> text
+    ) = 0;
+
+  // returns the ID of the created document.
+  virtual folly::Future<folly::Try<std::unique_ptr<std::string>>>
+    commitDocumentUpload(std::unique_ptr<std::string> uploadId) = 0;
+
+  virtual folly::Future<folly::Try<bool>>
+    abortDocumentUpload(std::unique_ptr<std::string> uploadId) = 0;
+
   virtual folly::Future<folly::Try<bool>>
     deleteDocument(std::unique_ptr<std::string> id, bool ignoreMissing) = 0;
 
@@ -112,6 +168,11 @@ class RelevanceServerIf {
       bool ignoreMissing
     ) = 0;
 
+  // recomputes a centroid from every one of its documents,
+  // ignoring any incrementally tracked changes.
+  virtual folly::Future<folly::Try<bool>>
+    rebuildCentroid(std::unique_ptr<std::string> centroidId) = 0;
+
   virtual folly::Future<std::unique_ptr<std::vector<std::string>>>
     listAllCentroids() = 0;
 
@@ -216,6 +277,29 @@ class RelevanceServer : public RelevanceServerIf {
       thrift_protocol::Language
     );
 
+  folly::Future<folly::Try<std::unique_ptr<std::string>>>
+    saveNewDocument(std::shared_ptr<models::ProcessedDocument>);
+
+  // uploads in progress, by upload ID.
+  folly::Synchronized<std::map<
+    std::string, std::shared_ptr<document_processing_worker::DocumentUpload>
+  >> uploads_;
+  size_t maxUploads_ {kDefaultMaxUploads};
+  int64_t uploadIdleSeconds_ {kDefaultUploadIdleSeconds};
+
+  // idle uploads are swept from `addUpload`, at most this often
+  // (and always before an upload is refused for the cap).
+  static const int64_t kUploadSweepIntervalSeconds = 60;
+  std::atomic<int64_t> lastUploadSweep_ {0};
+
+  folly::Try<std::unique_ptr<std::string>>
+    addUpload(std::string documentId, thrift_protocol::Language);
+
+  // removes the upload from `uploads_` if `take` is true, and
+  // otherwise marks it active.
+  std::shared_ptr<document_processing_worker::DocumentUpload>
+    findUpload(const std::string &uploadId, bool take);
+
   folly::Future<folly::Try<std::unique_ptr<std::map<std::string, double>>>>
     internalMultiGetDocumentSimilarity(
       std::shared_ptr<std::vector<std::string>> centroidIds,
@@ -223,6 +307,9 @@ class RelevanceServer : public RelevanceServerIf {
     );
 
  public:
+  static const size_t kDefaultMaxUploads = 1000;
+  static const int64_t kDefaultUploadIdleSeconds = 600;
+
   RelevanceServer(
     std::shared_ptr<persistence::PersistenceIf>,
     std::shared_ptr<persistence::CentroidMetadataDbIf>,
@@ -234,6 +321,16 @@ class RelevanceServer : public RelevanceServerIf {
 
   void initialize() override;
 
+  void initializeInBackground() override;
+
+  // at most `maxUploads` uploads can be in progress at once, and an
+  // upload with no appends for `idleSeconds` is discarded.  Call
+  // before serving.
+  void setUploadLimits(size_t maxUploads, int64_t idleSeconds);
+
+  // discards idle uploads now, returning how many there were.
+  size_t expireIdleUploads();
+
   void ping() override;
 
   folly::Future<std::unique_ptr<std::map<std::string, std::string>>>
@@ -258,6 +355,26 @@ class RelevanceServer : public RelevanceServerIf {
       std::unique_ptr<std::string> docId
     ) override;
 
+  folly::Future<folly::Try<std::unique_ptr<std::vector<std::map<std::string, double>>>>>
+    multiGetTextSimilarityBatch(
+      std::unique_ptr<std::vector<std::string>> texts,
+      std::unique_ptr<std::vector<std::string>> centroidIds,
+      thrift_protocol::Language lang
+    ) override;
+
+  folly::Future<folly::Try<std::unique_ptr<std::vector<std::pair<std::string, double>>>>>
+    getTextBestMatchingCentroids(
+      std::unique_ptr<std::string> text,
+      thrift_protocol::Language lang,
+      size_t count
+    ) override;
+
+  folly::Future<folly::Try<std::unique_ptr<std::vector<std::pair<std::string, double>>>>>
+    getDocumentBestMatchingCentroids(
+      std::unique_ptr<std::string> docId,
+      size_t count
+    ) override;
+
   folly::Future<folly::Try<double>>
     getTextSimilarity(
       std::unique_ptr<std::string> centroidId,
@@ -284,6 +401,27 @@ class RelevanceServer : public RelevanceServerIf {
       thrift_protocol::Language
     ) override;
 
+  folly::Future<folly::Try<std::unique_ptr<std::string>>>
+    beginDocumentUpload(thrift_protocol::Language) override;
+
+  folly::Future<folly::Try<std::unique_ptr<std::string>>>
+    beginDocumentUploadWithID(
+      std::unique_ptr<std::string> id,
+      thrift_protocol::Language
+    ) override;
+
+  folly::Future<folly::Try<bool>>
+    appendDocumentUpload(
+      std::unique_ptr<std::string> uploadId,
+      std::unique_ptr<std::string> text
+    ) override;
+
+  folly::Future<folly::Try<std::unique_ptr<std::string>>>
+    commitDocumentUpload(std::unique_ptr<std::string> uploadId) override;
+
+  folly::Future<folly::Try<bool>>
+    abortDocumentUpload(std::unique_ptr<std::string> uploadId) override;
+
   folly::Future<folly::Try<bool>>
     deleteDocument(std::unique_ptr<std::string> id, bool ignoreMissing) override;
 
@@ -349,6 +487,9 @@ class RelevanceServer : public RelevanceServerIf {
       bool ignoreMissing
     ) override;
 
+  folly::Future<folly::Try<bool>>
+    rebuildCentroid(std::unique_ptr<std::string> centroidId) override;
+
   folly::Future<std::unique_ptr<std::vector<std::string>>>
     listAllCentroids() override;
 
@@ -16,8 +16,11 @@ RelevanceServerOptions::RelevanceServerOptions()
       integrationTestMode_(false),
       rocksdbThreads_(8),
       centroidUpdateThreads_(4),
+      centroidAccumulationThreads_(4),
       similarityScoreThreads_(4),
-      documentProcessingThreads_(4) {}
+      documentProcessingThreads_(4),
+      backgroundCentroidLoading_(false),
+      bigramBits_(0) {}
 
 string RelevanceServerOptions::getDataDir() {
   LOG(INFO) << "getDataDir() -> " << dataDir_;
@@ -74,5 +77,29 @@ void RelevanceServerOptions::setCentroidUpdateThreadCount(int n) {
   centroidUpdateThreads_ = n;
 }
 
+int RelevanceServerOptions::getCentroidAccumulationThreadCount() {
+  return centroidAccumulationThreads_;
+}
+
+void RelevanceServerOptions::setCentroidAccumulationThreadCount(int n) {
+  centroidAccumulationThreads_ = n;
+}
+
+bool RelevanceServerOptions::getBackgroundCentroidLoading() {
+  return backgroundCentroidLoading_;
+}
+
+void RelevanceServerOptions::setBackgroundCentroidLoading(bool background) {
+  backgroundCentroidLoading_ = background;
+}
+
+int RelevanceServerOptions::getBigramBits() {
+  return bigramBits_;
+}
+
+void RelevanceServerOptions::setBigramBits(int bits) {
+  bigramBits_ = bits;
+}
+
 } // server
 } // relevanced
\ No newline at end of file
@@ -22,8 +22,11 @@ class RelevanceServerOptions {
   bool integrationTestMode_{false};
   int rocksdbThreads_{8};
   int centroidUpdateThreads_{4};
+  int centroidAccumulationThreads_{4};
   int similarityScoreThreads_{4};
   int documentProcessingThreads_{4};
+  bool backgroundCentroidLoading_{false};
+  int bigramBits_{0};
 
  public:
   RelevanceServerOptions();
@@ -42,6 +45,12 @@ class RelevanceServerOptions {
   void setSimilarityScoreThreadCount(int n);
   int getCentroidUpdateThreadCount();
   void setCentroidUpdateThreadCount(int n);
+  int getCentroidAccumulationThreadCount();
+  void setCentroidAccumulationThreadCount(int n);
+  bool getBackgroundCentroidLoading();
+  void setBackgroundCentroidLoading(bool background);
+  int getBigramBits();
+  void setBigramBits(int bits);
 };
 
 } // server
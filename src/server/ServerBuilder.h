@@ -16,6 +16,7 @@
 #include "persistence/SyncPersistence.h"
 #include "persistence/RockHandle.h"
 #include "persistence/CentroidMetadataDb.h"
+#include "persistence/CentroidSnapshotStore.h"
 #include "server/RelevanceServer.h"
 #include "server/ThriftRelevanceServer.h"
 #include "util/util.h"
@@ -78,8 +79,14 @@ class ServerBuilder {
     assert(clock_.get() != nullptr);
     string rockDir = options_->getDataDir() + "/rock";
     UniquePointer<RockHandleIf> rockHandle(new RockHandleT(rockDir));
-    UniquePointer<SyncPersistenceIf> syncPersistence(
-        new SyncPersistenceT(clock_, std::move(rockHandle)));
+    shared_ptr<CentroidSnapshotStoreIf> snapshotStore(
+        new CentroidSnapshotStore(options_->getDataDir() + "/centroid_snapshots"));
+    auto syncImpl =
+        new SyncPersistenceT(clock_, std::move(rockHandle), snapshotStore);
+    UniquePointer<SyncPersistenceIf> syncPersistence(syncImpl);
+
+    // before anything else can reach the database.
+    syncImpl->buildUnusedDocumentIndex().throwIfFailed();
     persistence_.reset(
         new PersistenceT(std::move(syncPersistence),
                          make_shared<FutureExecutor<CPUThreadPoolExecutor>>(
@@ -102,8 +109,12 @@ class ServerBuilder {
     assert(clock_.get() != nullptr);
     shared_ptr<StemmerManagerIf> stemmerManager(new StemmerManagerT);
     shared_ptr<StopwordFilterIf> stopwordFilter(new StopwordFilterT);
-    shared_ptr<DocumentProcessorIf> processor(
-        new ProcessorT(stemmerManager, stopwordFilter, clock_));
+    auto processorImpl = std::make_shared<ProcessorT>(
+        stemmerManager, stopwordFilter, clock_);
+    if (options_->getBigramBits() > 0) {
+      processorImpl->setBigramBits(options_->getBigramBits());
+    }
+    shared_ptr<DocumentProcessorIf> processor = processorImpl;
     auto threadPool = make_shared<FutureExecutor<CPUThreadPoolExecutor>>(
         options_->getDocumentProcessingThreadCount());
     shared_ptr<util::Sha1HasherIf> hasher(new HasherT);
@@ -122,8 +133,11 @@ class ServerBuilder {
     shared_ptr<DocumentAccumulatorFactoryIf> accumulator(
       new DocumentAccumulatorFactoryT
     );
+    auto accumulationPool = make_shared<FutureExecutor<CPUThreadPoolExecutor>>(
+        options_->getCentroidAccumulationThreadCount());
     shared_ptr<CentroidUpdaterFactoryIf> updaterFactory(
-        new CentroidUpdaterFactoryT(persistence_, centroidMetadataDb_, accumulator, clock_));
+        new CentroidUpdaterFactoryT(persistence_, centroidMetadataDb_,
+                                    accumulator, clock_, accumulationPool));
     auto threadPool = make_shared<FutureExecutor<CPUThreadPoolExecutor>>(
         options_->getCentroidUpdateThreadCount());
     centroidUpdater_.reset(
@@ -149,7 +163,11 @@ class ServerBuilder {
     auto server = make_shared<RelevanceServerT>(
         persistence_, centroidMetadataDb_, clock_, similarityWorker_,
         processor_, centroidUpdater_);
-    server->initialize();
+    if (options_->getBackgroundCentroidLoading()) {
+      server->initializeInBackground();
+    } else {
+      server->initialize();
+    }
     return server;
   }
 
@@ -2,6 +2,7 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <utility>
 
 
 #include <folly/futures/Future.h>
@@ -77,8 +78,7 @@ ThriftRelevanceServer::future_multiGetTextSimilarity(
   ).then([this](Try<unique_ptr<map<string, double>>> result) {
     result.throwIfFailed();
     auto response = folly::make_unique<MultiSimilarityResponse>();
-    map<string, double> scores = *result.value();
-    response->scores = std::move(scores);
+    response->scores = std::move(*result.value());
     return std::move(response);
   });
 }
@@ -93,11 +93,74 @@ ThriftRelevanceServer::future_multiGetDocumentSimilarity(
   ).then([this](Try<unique_ptr<map<string, double>>> result) {
     result.throwIfFailed();
     auto response = folly::make_unique<MultiSimilarityResponse>();
-    map<string, double> scores = *result.value();
-    response->scores = std::move(scores);
+    response->scores = std::move(*result.value());
     return std::move(response);
   });
 }
+Future<unique_ptr<MultiSimilarityBatchResponse>>
+ThriftRelevanceServer::future_multiGetTextSimilarityBatch(
+    unique_ptr<vector<string>> texts,
+    unique_ptr<vector<string>> centroidIds,
+    Language lang) {
+  return server_->multiGetTextSimilarityBatch(
+    std::move(texts), std::move(centroidIds), lang
+  ).then([this](Try<unique_ptr<vector<map<string, double>>>> result) {
+    result.throwIfFailed();
+    auto response = folly::make_unique<MultiSimilarityBatchResponse>();
+    auto &rows = *result.value();
+    response->responses.reserve(rows.size());
+    for (auto &row : rows) {
+      MultiSimilarityResponse scores;
+      scores.scores = std::move(row);
+      response->responses.push_back(std::move(scores));
+    }
+    return std::move(response);
+  });
+}
+
+namespace {
+
+unique_ptr<BestMatchingCentroidsResponse> makeBestMatchingResponse(
+    const vector<pair<string, double>> &matches) {
+  auto response = folly::make_unique<BestMatchingCentroidsResponse>();
+  response->centroids.reserve(matches.size());
+  for (auto &match : matches) {
+    ScoredCentroidDTO scored;
+    scored.id = match.first;
+    scored.score = match.second;
+    response->centroids.push_back(std::move(scored));
+  }
+  return response;
+}
+
+} // anonymous namespace
+
+Future<unique_ptr<BestMatchingCentroidsResponse>>
+ThriftRelevanceServer::future_getTextBestMatchingCentroids(
+    unique_ptr<string> text,
+    Language lang,
+    int32_t count) {
+  size_t requested = count > 0 ? (size_t) count : 0;
+  return server_->getTextBestMatchingCentroids(
+    std::move(text), lang, requested
+  ).then([this](Try<unique_ptr<vector<pair<string, double>>>> result) {
+    result.throwIfFailed();
+    return makeBestMatchingResponse(*result.value());
+  });
+}
+
+Future<unique_ptr<BestMatchingCentroidsResponse>>
+ThriftRelevanceServer::future_getDocumentBestMatchingCentroids(
+    unique_ptr<string> docId,
+    int32_t count) {
+  size_t requested = count > 0 ? (size_t) count : 0;
+  return server_->getDocumentBestMatchingCentroids(
+    std::move(docId), requested
+  ).then([this](Try<unique_ptr<vector<pair<string, double>>>> result) {
+    result.throwIfFailed();
+    return makeBestMatchingResponse(*result.value());
+  });
+}
 
 
 Future<unique_ptr<CreateDocumentResponse>>
@@ -129,6 +192,62 @@ ThriftRelevanceServer::future_createDocumentWithID(
   });
 }
 
+Future<unique_ptr<BeginDocumentUploadResponse>>
+ThriftRelevanceServer::future_beginDocumentUpload(Language lang) {
+  return server_->beginDocumentUpload(lang).then(
+    [](Try<unique_ptr<string>> result) {
+      result.throwIfFailed();
+      auto response = folly::make_unique<BeginDocumentUploadResponse>();
+      response->uploadId = *result.value();
+      return std::move(response);
+    }
+  );
+}
+
+Future<unique_ptr<BeginDocumentUploadResponse>>
+ThriftRelevanceServer::future_beginDocumentUploadWithID(
+    unique_ptr<string> id, Language lang) {
+  return server_->beginDocumentUploadWithID(
+    std::move(id), lang
+  ).then([](Try<unique_ptr<string>> result) {
+    result.throwIfFailed();
+    auto response = folly::make_unique<BeginDocumentUploadResponse>();
+    response->uploadId = *result.value();
+    return std::move(response);
+  });
+}
+
+Future<folly::Unit> ThriftRelevanceServer::future_appendDocumentUpload(
+    unique_ptr<string> uploadId, unique_ptr<string> text) {
+  return server_->appendDocumentUpload(
+    std::move(uploadId), std::move(text)
+  ).then([](Try<bool> result) {
+    result.throwIfFailed();
+  });
+}
+
+Future<unique_ptr<CreateDocumentResponse>>
+ThriftRelevanceServer::future_commitDocumentUpload(
+    unique_ptr<string> uploadId) {
+  return server_->commitDocumentUpload(
+    std::move(uploadId)
+  ).then([](Try<unique_ptr<string>> result) {
+    result.throwIfFailed();
+    auto response = folly::make_unique<CreateDocumentResponse>();
+    response->id = *result.value();
+    return std::move(response);
+  });
+}
+
+Future<folly::Unit> ThriftRelevanceServer::future_abortDocumentUpload(
+    unique_ptr<string> uploadId) {
+  return server_->abortDocumentUpload(
+    std::move(uploadId)
+  ).then([](Try<bool> result) {
+    result.throwIfFailed();
+  });
+}
+
 Future<unique_ptr<DeleteDocumentResponse>>
 ThriftRelevanceServer::future_deleteDocument(
     unique_ptr<DeleteDocumentRequest> request) {
@@ -355,6 +474,28 @@ ThriftRelevanceServer::future_joinCentroid(
   });
 }
 
+Future<unique_ptr<JoinCentroidResponse>>
+ThriftRelevanceServer::future_rebuildCentroid(
+    unique_ptr<JoinCentroidRequest> request) {
+  auto cId = request->id;
+  bool ignoreMissing = request->ignoreMissing;
+  return server_->rebuildCentroid(
+    folly::make_unique<string>(request->id)
+  ).then([cId, ignoreMissing](Try<bool> result) {
+    auto response = folly::make_unique<JoinCentroidResponse>();
+    response->id = cId;
+    if (result.hasException()) {
+      if (!ignoreMissing || !result.hasException<ECentroidDoesNotExist>()) {
+        result.throwIfFailed();
+      }
+      response->recalculated = false;
+      return std::move(response);
+    }
+    response->recalculated = result.value();
+    return std::move(response);
+  });
+}
+
 Future<unique_ptr<MultiJoinCentroidsResponse>>
 ThriftRelevanceServer::future_multiJoinCentroids(
     unique_ptr<MultiJoinCentroidsRequest> request) {
@@ -477,7 +618,7 @@ ThriftRelevanceServer::future_debugGetFullCentroid(unique_ptr<string> centroidId
     response->id = centroid->id;
     response->wordVector.magnitude = centroid->wordVector.magnitude;
     response->wordVector.documentWeight = centroid->wordVector.documentWeight;
-    response->wordVector.scores = centroid->wordVector.scores;
+    response->wordVector.scores = centroid->wordVector.getTermScores();
     return std::move(response);
   });
 }
@@ -496,8 +637,7 @@ ThriftRelevanceServer::future_debugGetFullProcessedDocument(unique_ptr<string> d
     }
     response->wordVector.magnitude = document->magnitude;
     for (auto &elem: document->scoredWords) {
-      string k = elem.word;
-      response->wordVector.scores[k] = elem.score;
+      response->wordVector.scores[elem.getWord()] = elem.score;
     }
     return std::move(response);
   });
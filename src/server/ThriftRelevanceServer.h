@@ -45,6 +45,23 @@ class ThriftRelevanceServer : public thrift_protocol::RelevancedSvIf {
       std::unique_ptr<std::vector<std::string>> centroidIds,
       std::unique_ptr<std::string> docId) override;
 
+  folly::Future<std::unique_ptr<thrift_protocol::MultiSimilarityBatchResponse>>
+  future_multiGetTextSimilarityBatch(
+      std::unique_ptr<std::vector<std::string>> texts,
+      std::unique_ptr<std::vector<std::string>> centroidIds,
+      thrift_protocol::Language) override;
+
+  folly::Future<std::unique_ptr<thrift_protocol::BestMatchingCentroidsResponse>>
+  future_getTextBestMatchingCentroids(
+      std::unique_ptr<std::string> text,
+      thrift_protocol::Language,
+      int32_t count) override;
+
+  folly::Future<std::unique_ptr<thrift_protocol::BestMatchingCentroidsResponse>>
+  future_getDocumentBestMatchingCentroids(
+      std::unique_ptr<std::string> docId,
+      int32_t count) override;
+
   folly::Future<double> future_getTextSimilarity(
       std::unique_ptr<std::string> centroidId,
       std::unique_ptr<std::string> text,
@@ -67,6 +84,26 @@ class ThriftRelevanceServer : public thrift_protocol::RelevancedSvIf {
     thrift_protocol::Language lang
   ) override;
 
+  folly::Future<std::unique_ptr<thrift_protocol::BeginDocumentUploadResponse>>
+  future_beginDocumentUpload(thrift_protocol::Language lang) override;
+
+  folly::Future<std::unique_ptr<thrift_protocol::BeginDocumentUploadResponse>>
+  future_beginDocumentUploadWithID(
+    std::unique_ptr<std::string> id,
+    thrift_protocol::Language lang
+  ) override;
+
+  folly::Future<folly::Unit> future_appendDocumentUpload(
+    std::unique_ptr<std::string> uploadId,
+    std::unique_ptr<std::string> text
+  ) override;
+
+  folly::Future<std::unique_ptr<thrift_protocol::CreateDocumentResponse>>
+  future_commitDocumentUpload(std::unique_ptr<std::string> uploadId) override;
+
+  folly::Future<folly::Unit>
+  future_abortDocumentUpload(std::unique_ptr<std::string> uploadId) override;
+
   folly::Future<std::unique_ptr<thrift_protocol::DeleteDocumentResponse>>
   future_deleteDocument(std::unique_ptr<thrift_protocol::DeleteDocumentRequest> request) override;
 
@@ -115,6 +152,11 @@ class ThriftRelevanceServer : public thrift_protocol::RelevancedSvIf {
       std::unique_ptr<thrift_protocol::MultiJoinCentroidsRequest> request
     ) override;
 
+  folly::Future<std::unique_ptr<thrift_protocol::JoinCentroidResponse>>
+    future_rebuildCentroid(
+        std::unique_ptr<thrift_protocol::JoinCentroidRequest> request
+    ) override;
+
   folly::Future<std::unique_ptr<thrift_protocol::ListCentroidsResponse>>
   future_listAllCentroids() override;
   folly::Future<std::unique_ptr<thrift_protocol::ListCentroidsResponse>>
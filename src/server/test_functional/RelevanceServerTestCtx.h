@@ -80,6 +80,7 @@ struct RelevanceServerTestCtx {
   shared_ptr<FutureExecutor<CPUThreadPoolExecutor>> processingThreads;
   shared_ptr<FutureExecutor<CPUThreadPoolExecutor>> scoringThreads;
   shared_ptr<FutureExecutor<CPUThreadPoolExecutor>> updatingThreads;
+  shared_ptr<FutureExecutor<CPUThreadPoolExecutor>> accumulationThreads;
   shared_ptr<SimilarityScoreWorker> scoreWorker;
   shared_ptr<DocumentProcessingWorker> processingWorker;
   shared_ptr<CentroidUpdateWorker> updateWorker;
@@ -90,6 +91,7 @@ struct RelevanceServerTestCtx {
     processingThreads.reset(new wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>(2));
     scoringThreads.reset(new wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>(2));
     updatingThreads.reset(new wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>(2));
+    accumulationThreads.reset(new wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>(2));
     UniquePointer<RockHandleIf> rockHandle(new InMemoryRockHandle("foo"));
     sysClock.reset(new Clock);
     UniquePointer<SyncPersistenceIf> syncPersistence(
@@ -105,7 +107,7 @@ struct RelevanceServerTestCtx {
     );
     accumulatorFactory.reset(new DocumentAccumulatorFactory);
     updaterFactory.reset(new CentroidUpdaterFactory(
-      persistence, metadb, accumulatorFactory, sysClock
+      persistence, metadb, accumulatorFactory, sysClock, accumulationThreads
     ));
     processingWorker.reset(new DocumentProcessingWorker(
       processor, hasher, processingThreads
@@ -14,6 +14,7 @@
 #include <folly/futures/Try.h>
 #include <folly/futures/Future.h>
 #include <folly/futures/helpers.h>
+#include <folly/Conv.h>
 #include <folly/Optional.h>
 
 #include <wangle/concurrent/CPUThreadPoolExecutor.h>
@@ -76,3 +77,17 @@ TEST(RelevanceServer, TestInitialize) {
   EXPECT_TRUE(loaded.hasValue());
   EXPECT_EQ("some-id", loaded.value()->id);
 }
+
+TEST(RelevanceServer, TestServerMetadataStemCacheStats) {
+  RelevanceServerTestCtx ctx;
+  ctx.server->createDocumentWithID(
+    folly::make_unique<string>("doc-id"),
+    folly::make_unique<string>("cats and dogs and cats and dogs"),
+    Language::EN
+  ).get();
+  auto metadata = ctx.server->getServerMetadata().get();
+  EXPECT_EQ(1, metadata->count("stem_cache_hits"));
+  EXPECT_EQ(1, metadata->count("stem_cache_misses"));
+  EXPECT_LT(0, folly::to<int>(metadata->at("stem_cache_misses")));
+  EXPECT_LT(0, folly::to<int>(metadata->at("stem_cache_hits")));
+}
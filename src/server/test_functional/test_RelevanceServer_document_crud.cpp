@@ -94,6 +94,131 @@ TEST(RelevanceServer, TestCreateDocumentWithIDAlreadyExists) {
   EXPECT_TRUE(response2.hasException<EDocumentAlreadyExists>());
 }
 
+TEST(RelevanceServer, TestDocumentUpload) {
+  RelevanceServerTestCtx ctx;
+  auto uploadId = ctx.server->beginDocumentUploadWithID(
+    folly::make_unique<string>("doc-id"), Language::EN
+  ).get();
+  EXPECT_TRUE(uploadId.hasValue());
+  vector<string> chunks {
+    "some text ab", "out cats and dogs ", "and fish and so forth"
+  };
+  for (auto &chunk : chunks) {
+    auto appended = ctx.server->appendDocumentUpload(
+      folly::make_unique<string>(*uploadId.value()),
+      folly::make_unique<string>(chunk)
+    ).get();
+    EXPECT_TRUE(appended.hasValue());
+  }
+  auto response = ctx.server->commitDocumentUpload(
+    folly::make_unique<string>(*uploadId.value())
+  ).get();
+  EXPECT_TRUE(response.hasValue());
+  EXPECT_EQ("doc-id", *response.value());
+
+  auto uploaded = ctx.persistence->loadDocument("doc-id").get();
+  EXPECT_TRUE(uploaded.hasValue());
+  ctx.server->createDocumentWithID(
+    folly::make_unique<string>("doc-id-2"),
+    folly::make_unique<string>(
+      "some text about cats and dogs and fish and so forth"
+    ),
+    Language::EN
+  ).get();
+  auto created = ctx.persistence->loadDocument("doc-id-2").get();
+  EXPECT_EQ(
+    created.value()->sha1Hash.value(),
+    uploaded.value()->sha1Hash.value()
+  );
+  EXPECT_EQ(
+    created.value()->scoredWords.size(),
+    uploaded.value()->scoredWords.size()
+  );
+
+  // the upload is gone once committed
+  auto appended = ctx.server->appendDocumentUpload(
+    folly::make_unique<string>(*uploadId.value()),
+    folly::make_unique<string>("more")
+  ).get();
+  EXPECT_TRUE(appended.hasException<EUploadDoesNotExist>());
+}
+
+TEST(RelevanceServer, TestDocumentUploadAlreadyExists) {
+  RelevanceServerTestCtx ctx;
+  ctx.server->createDocumentWithID(
+    folly::make_unique<string>("doc-id"),
+    folly::make_unique<string>("some text"),
+    Language::EN
+  ).get();
+  auto uploadId = ctx.server->beginDocumentUploadWithID(
+    folly::make_unique<string>("doc-id"), Language::EN
+  ).get();
+  EXPECT_TRUE(uploadId.hasException<EDocumentAlreadyExists>());
+}
+
+TEST(RelevanceServer, TestAbortDocumentUpload) {
+  RelevanceServerTestCtx ctx;
+  auto uploadId = ctx.server->beginDocumentUpload(Language::EN).get();
+  EXPECT_TRUE(uploadId.hasValue());
+  ctx.server->appendDocumentUpload(
+    folly::make_unique<string>(*uploadId.value()),
+    folly::make_unique<string>("some text")
+  ).get();
+  auto aborted = ctx.server->abortDocumentUpload(
+    folly::make_unique<string>(*uploadId.value())
+  ).get();
+  EXPECT_TRUE(aborted.hasValue());
+  auto response = ctx.server->commitDocumentUpload(
+    folly::make_unique<string>(*uploadId.value())
+  ).get();
+  EXPECT_TRUE(response.hasException<EUploadDoesNotExist>());
+  auto documents = ctx.server->listAllDocuments().get();
+  EXPECT_EQ(0, documents->size());
+}
+
+TEST(RelevanceServer, TestTooManyDocumentUploads) {
+  RelevanceServerTestCtx ctx;
+  ctx.server->setUploadLimits(2, 600);
+  auto first = ctx.server->beginDocumentUpload(Language::EN).get();
+  EXPECT_TRUE(first.hasValue());
+  auto second = ctx.server->beginDocumentUploadWithID(
+    folly::make_unique<string>("doc-id"), Language::EN
+  ).get();
+  EXPECT_TRUE(second.hasValue());
+  auto third = ctx.server->beginDocumentUpload(Language::EN).get();
+  EXPECT_TRUE(third.hasException<ETooManyUploads>());
+  auto thirdWithId = ctx.server->beginDocumentUploadWithID(
+    folly::make_unique<string>("doc-id-2"), Language::EN
+  ).get();
+  EXPECT_TRUE(thirdWithId.hasException<ETooManyUploads>());
+
+  // finishing an upload frees its slot
+  ctx.server->abortDocumentUpload(
+    folly::make_unique<string>(*first.value())
+  ).get();
+  auto fourth = ctx.server->beginDocumentUpload(Language::EN).get();
+  EXPECT_TRUE(fourth.hasValue());
+}
+
+TEST(RelevanceServer, TestIdleDocumentUploadsExpire) {
+  RelevanceServerTestCtx ctx;
+  ctx.server->setUploadLimits(1, 0);
+  auto uploadId = ctx.server->beginDocumentUpload(Language::EN).get();
+  EXPECT_TRUE(uploadId.hasValue());
+  EXPECT_EQ(1, ctx.server->expireIdleUploads());
+  auto appended = ctx.server->appendDocumentUpload(
+    folly::make_unique<string>(*uploadId.value()),
+    folly::make_unique<string>("some text")
+  ).get();
+  EXPECT_TRUE(appended.hasException<EUploadDoesNotExist>());
+
+  // an idle upload holding the cap doesn't block a new one
+  auto held = ctx.server->beginDocumentUpload(Language::EN).get();
+  EXPECT_TRUE(held.hasValue());
+  auto next = ctx.server->beginDocumentUpload(Language::EN).get();
+  EXPECT_TRUE(next.hasValue());
+}
+
 TEST(RelevanceServer, TestListAllDocuments) {
   RelevanceServerTestCtx ctx;
   vector<Future<Try<unique_ptr<string>>>> creations;
@@ -107,6 +107,43 @@ TEST(RelevanceServer, TestMultiGetTextSimilarityHappy) {
 }
 
 
+TEST(RelevanceServer, TestMultiGetTextSimilarityBatchHappy) {
+  RelevanceServerTestCtx ctx;
+  SimilarityTestCtx testCtx(&ctx);
+  testCtx.init();
+  auto scoreResponse = ctx.server->multiGetTextSimilarityBatch(
+    folly::make_unique<vector<string>>(vector<string> {
+      "This is some dog related text which is also about a cat.",
+      "This text is about a fish and a wombat."
+    }),
+    folly::make_unique<vector<string>>(
+      vector<string> {"centroid-1-id", "centroid-2-id"}
+    ),
+    Language::EN
+  ).get();
+  EXPECT_FALSE(scoreResponse.hasException());
+  auto &rows = *scoreResponse.value();
+  EXPECT_EQ(2, rows.size());
+  EXPECT_TRUE(rows.at(0)["centroid-1-id"] > rows.at(0)["centroid-2-id"]);
+  EXPECT_TRUE(rows.at(1)["centroid-2-id"] > rows.at(1)["centroid-1-id"]);
+}
+
+TEST(RelevanceServer, TestMultiGetTextSimilarityBatchMissingCentroid) {
+  RelevanceServerTestCtx ctx;
+  SimilarityTestCtx testCtx(&ctx);
+  testCtx.init();
+  auto scoreResponse = ctx.server->multiGetTextSimilarityBatch(
+    folly::make_unique<vector<string>>(vector<string> {
+      "This is some dog related text which is also about a cat."
+    }),
+    folly::make_unique<vector<string>>(
+      vector<string> {"centroid-1-id", "unrelated-centroid-id"}
+    ),
+    Language::EN
+  ).get();
+  EXPECT_TRUE(scoreResponse.hasException<ECentroidDoesNotExist>());
+}
+
 TEST(RelevanceServer, TestGetDocumentSimilarityHappy) {
   RelevanceServerTestCtx ctx;
   SimilarityTestCtx testCtx(&ctx);
@@ -183,4 +220,63 @@ TEST(RelevanceServer, TestMultiGetDocumentSimilarityMissingCentroid) {
     folly::make_unique<string>("doc-1-id")
   ).get();
   EXPECT_TRUE(result.hasException<ECentroidDoesNotExist>());
-}
\ No newline at end of file
+}
+TEST(RelevanceServer, TestGetDocumentBestMatchingCentroidsHappy) {
+  RelevanceServerTestCtx ctx;
+  SimilarityTestCtx testCtx(&ctx);
+  testCtx.init();
+  auto result = ctx.server->getDocumentBestMatchingCentroids(
+    folly::make_unique<string>("doc-1-id"), 1
+  ).get();
+  EXPECT_FALSE(result.hasException());
+  auto &matches = *result.value();
+  EXPECT_EQ(1, matches.size());
+  EXPECT_EQ("centroid-1-id", matches.at(0).first);
+  EXPECT_TRUE(matches.at(0).second > 0.0);
+}
+
+TEST(RelevanceServer, TestGetDocumentBestMatchingCentroidsMissingDocument) {
+  RelevanceServerTestCtx ctx;
+  SimilarityTestCtx testCtx(&ctx);
+  testCtx.init();
+  auto result = ctx.server->getDocumentBestMatchingCentroids(
+    folly::make_unique<string>("bad-doc-id"), 1
+  ).get();
+  EXPECT_TRUE(result.hasException<EDocumentDoesNotExist>());
+}
+
+TEST(RelevanceServer, TestGetTextBestMatchingCentroidsHappy) {
+  RelevanceServerTestCtx ctx;
+  SimilarityTestCtx testCtx(&ctx);
+  testCtx.init();
+  auto result = ctx.server->getTextBestMatchingCentroids(
+    folly::make_unique<string>("This is some text about a fish and a wombat."),
+    Language::EN,
+    5
+  ).get();
+  EXPECT_FALSE(result.hasException());
+  auto &matches = *result.value();
+  EXPECT_EQ(2, matches.size());
+  EXPECT_EQ("centroid-2-id", matches.at(0).first);
+  EXPECT_EQ("centroid-1-id", matches.at(1).first);
+  EXPECT_TRUE(matches.at(0).second > matches.at(1).second);
+}
+
+TEST(RelevanceServer, TestBestMatchingCentroidsSkipDeletedCentroid) {
+  RelevanceServerTestCtx ctx;
+  SimilarityTestCtx testCtx(&ctx);
+  testCtx.init();
+  auto deleted = ctx.server->deleteCentroid(
+    folly::make_unique<string>("centroid-2-id"), false
+  ).get();
+  EXPECT_FALSE(deleted.hasException());
+  auto result = ctx.server->getTextBestMatchingCentroids(
+    folly::make_unique<string>("This is some text about a fish and a wombat."),
+    Language::EN,
+    5
+  ).get();
+  EXPECT_FALSE(result.hasException());
+  auto &matches = *result.value();
+  EXPECT_EQ(1, matches.size());
+  EXPECT_EQ("centroid-1-id", matches.at(0).first);
+}
@@ -0,0 +1,342 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <folly/Optional.h>
+
+#include "similarity_score_worker/CentroidIndex.h"
+#include "models/Centroid.h"
+#include "models/ProcessedDocument.h"
+#include "models/SparseVector.h"
+#include "models/WordVector.h"
+
+using namespace std;
+using namespace folly;
+
+namespace relevanced {
+namespace similarity_score_worker {
+
+using models::Centroid;
+using models::ProcessedDocument;
+using models::SparseVector;
+
+CentroidIndex::CentroidIndex(vector<pair<string, CentroidPtr>> centroids) {
+  uint32_t maxTermId = 0;
+  size_t postingCount = 0;
+  for (auto &elem : centroids) {
+    slotsById_.insert(make_pair(elem.first, centroidIds_.size()));
+    centroidIds_.push_back(elem.first);
+    centroids_.push_back(elem.second);
+    auto &wordVector = elem.second->wordVector;
+    magnitudes_.push_back(wordVector.magnitude);
+    inverseMagnitudes_.push_back(
+      wordVector.magnitude == 0.0 ? 0.0 : 1.0 / wordVector.magnitude
+    );
+    if (!wordVector.scores.empty()) {
+      maxTermId = max(maxTermId, wordVector.scores.ids.back());
+    }
+    postingCount += wordVector.scores.size();
+  }
+  baseSlots_ = centroidIds_.size();
+
+  // count postings per term, then turn the counts into offsets.
+  auto postings = std::make_shared<Postings>();
+  auto &offsets = postings->offsets;
+  offsets.assign(((size_t) maxTermId) + 2, 0);
+  for (auto &centroid : centroids_) {
+    for (auto termId : centroid->wordVector.scores.ids) {
+      offsets[termId + 1]++;
+    }
+  }
+  for (size_t i = 1; i < offsets.size(); i++) {
+    offsets[i] += offsets[i - 1];
+  }
+
+  postings->slots.resize(postingCount);
+  postings->weights.resize(postingCount);
+  postings->termUpperBounds.assign(offsets.size() - 1, 0.0);
+  vector<uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+  for (size_t slot = 0; slot < centroids_.size(); slot++) {
+    const SparseVector &scores = centroids_[slot]->wordVector.scores;
+    for (size_t i = 0; i < scores.size(); i++) {
+      auto termId = scores.ids[i];
+      auto weight = scores.weights[i];
+      auto position = cursors[termId]++;
+      postings->slots[position] = (uint32_t) slot;
+      postings->weights[position] = weight;
+      if (weight < 0.0) {
+        postings->hasNegativeWeights = true;
+      }
+      postings->termUpperBounds[termId] = max(
+        postings->termUpperBounds[termId],
+        fabs(weight) * inverseMagnitudes_[slot]
+      );
+    }
+  }
+  postings_ = postings;
+}
+
+void CentroidIndex::retireSlot(const string &centroidId) {
+  auto found = slotsById_.find(centroidId);
+  if (found == slotsById_.end()) {
+    return;
+  }
+  auto slot = found->second;
+  slotsById_.erase(found);
+  inverseMagnitudes_[slot] = 0.0;
+  liveOverlaySlots_.erase(
+    std::remove(liveOverlaySlots_.begin(), liveOverlaySlots_.end(), slot),
+    liveOverlaySlots_.end()
+  );
+}
+
+shared_ptr<CentroidIndex> CentroidIndex::withCentroid(
+    const string &centroidId, CentroidPtr centroid) const {
+  auto index = std::make_shared<CentroidIndex>(*this);
+  index->retireSlot(centroidId);
+  auto slot = index->centroidIds_.size();
+  auto magnitude = centroid->wordVector.magnitude;
+  index->slotsById_.insert(make_pair(centroidId, slot));
+  index->centroidIds_.push_back(centroidId);
+  index->centroids_.push_back(centroid);
+  index->magnitudes_.push_back(magnitude);
+  index->inverseMagnitudes_.push_back(
+    magnitude == 0.0 ? 0.0 : 1.0 / magnitude
+  );
+  index->liveOverlaySlots_.push_back(slot);
+  return index;
+}
+
+shared_ptr<CentroidIndex> CentroidIndex::withoutCentroid(
+    const string &centroidId) const {
+  auto index = std::make_shared<CentroidIndex>(*this);
+  index->retireSlot(centroidId);
+  return index;
+}
+
+size_t CentroidIndex::size() const {
+  return slotsById_.size();
+}
+
+size_t CentroidIndex::getSlotCount() const {
+  return centroidIds_.size();
+}
+
+size_t CentroidIndex::getOverlaySlotCount() const {
+  return centroidIds_.size() - baseSlots_;
+}
+
+size_t CentroidIndex::getPostingCount() const {
+  return postings_->slots.size();
+}
+
+Optional<size_t> CentroidIndex::getSlot(const string &centroidId) const {
+  Optional<size_t> result;
+  auto found = slotsById_.find(centroidId);
+  if (found != slotsById_.end()) {
+    result.assign(found->second);
+  }
+  return result;
+}
+
+const string& CentroidIndex::getCentroidId(size_t slot) const {
+  return centroidIds_.at(slot);
+}
+
+double CentroidIndex::getMagnitude(size_t slot) const {
+  return magnitudes_.at(slot);
+}
+
+Centroid* CentroidIndex::getCentroid(size_t slot) {
+  return centroids_.at(slot).get();
+}
+
+void CentroidIndex::accumulate(const ProcessedDocument &document,
+                               vector<double> &dotProducts) const {
+  dotProducts.assign(centroidIds_.size(), 0.0);
+  auto &offsets = postings_->offsets;
+  if (!offsets.empty()) {
+    size_t termLimit = offsets.size() - 1;
+    for (auto &word : document.scoredWords) {
+      if (word.termId >= termLimit) {
+        continue;
+      }
+      auto start = offsets[word.termId];
+      auto end = offsets[word.termId + 1];
+      for (auto i = start; i < end; i++) {
+        dotProducts[postings_->slots[i]] += word.score * postings_->weights[i];
+      }
+    }
+  }
+  for (auto slot : liveOverlaySlots_) {
+    dotProducts[slot] =
+      centroids_[slot]->wordVector.scores.dot(document.scoredWords);
+  }
+}
+
+namespace {
+
+bool scoreDescending(const pair<size_t, double> &p1,
+                     const pair<size_t, double> &p2) {
+  if (p1.second != p2.second) {
+    return p1.second > p2.second;
+  }
+  return p1.first < p2.first;
+}
+
+double kthLargest(const vector<double> &partials,
+                  const vector<size_t> &candidates,
+                  size_t k) {
+  vector<double> values;
+  values.reserve(candidates.size());
+  for (auto slot : candidates) {
+    values.push_back(partials[slot]);
+  }
+  std::nth_element(
+    values.begin(), values.begin() + (k - 1), values.end(),
+    [](double d1, double d2) { return d1 > d2; }
+  );
+  return values[k - 1];
+}
+
+} // anonymous namespace
+
+vector<pair<size_t, double>> CentroidIndex::getBestMatches(
+    const ProcessedDocument &document, size_t count) const {
+  vector<pair<size_t, double>> result;
+  if (count == 0 || centroidIds_.empty() || document.magnitude == 0.0) {
+    return result;
+  }
+
+  // (index into scoredWords, bound on that term's contribution
+  // to any centroid's normalized dot product)
+  vector<pair<size_t, double>> terms;
+  auto &offsets = postings_->offsets;
+  size_t termLimit = offsets.empty() ? 0 : offsets.size() - 1;
+
+  // bounds only prune soundly when no contribution can be
+  // negative; otherwise every posting has to be visited.
+  // retired slots only make the bounds looser.
+  bool canPrune = !postings_->hasNegativeWeights && count < baseSlots_;
+  for (size_t i = 0; i < document.scoredWords.size(); i++) {
+    auto &word = document.scoredWords[i];
+    if (word.termId >= termLimit) {
+      continue;
+    }
+    if (offsets[word.termId] == offsets[word.termId + 1]) {
+      continue;
+    }
+    if (word.score < 0.0) {
+      canPrune = false;
+    }
+    terms.push_back(make_pair(
+      i, fabs(word.score) * postings_->termUpperBounds[word.termId]
+    ));
+  }
+  std::sort(terms.begin(), terms.end(),
+    [](const pair<size_t, double> &t1, const pair<size_t, double> &t2) {
+      return t1.second > t2.second;
+    }
+  );
+
+  // remaining[i]: the most that terms i..end can add to any centroid.
+  vector<double> remaining(terms.size() + 1, 0.0);
+  for (size_t i = terms.size(); i > 0; i--) {
+    remaining[i - 1] = remaining[i] + terms[i - 1].second;
+  }
+
+  vector<double> partials(centroidIds_.size(), 0.0);
+  vector<bool> touched(centroidIds_.size(), false);
+  vector<size_t> candidates;
+  double maxPartial = 0.0;
+  double threshold = 0.0;
+  size_t processed = 0;
+  for (; processed < terms.size(); processed++) {
+    // with all contributions non-negative, partial sums are lower
+    // bounds on final scores.  Once the unvisited terms can't lift
+    // a centroid we haven't seen past the current k-th best partial,
+    // no new candidates can make the cut.
+    if (canPrune && candidates.size() >= count
+        && remaining[processed] < maxPartial) {
+      threshold = kthLargest(partials, candidates, count);
+      if (remaining[processed] < threshold) {
+        break;
+      }
+    }
+    auto &word = document.scoredWords[terms[processed].first];
+    auto start = offsets[word.termId];
+    auto end = offsets[word.termId + 1];
+    for (auto i = start; i < end; i++) {
+      auto slot = postings_->slots[i];
+      if (inverseMagnitudes_[slot] == 0.0) {
+        continue;
+      }
+      partials[slot] +=
+        word.score * postings_->weights[i] * inverseMagnitudes_[slot];
+      if (!touched[slot]) {
+        touched[slot] = true;
+        candidates.push_back(slot);
+      }
+      maxPartial = max(maxPartial, partials[slot]);
+    }
+  }
+
+  bool stoppedEarly = processed < terms.size();
+  for (auto slot : candidates) {
+    double partial = partials[slot];
+    if (stoppedEarly) {
+      if (partial + remaining[processed] < threshold) {
+        continue;
+      }
+      // finish the survivor off against the terms we skipped.
+      auto &scores = centroids_[slot]->wordVector.scores;
+      for (size_t i = processed; i < terms.size(); i++) {
+        auto &word = document.scoredWords[terms[i].first];
+        partial += word.score * scores.get(word.termId) * inverseMagnitudes_[slot];
+      }
+    }
+    result.push_back(make_pair((size_t) slot, partial / document.magnitude));
+  }
+
+  // centroids sharing no terms with the document score zero, which
+  // only ranks them last when nothing can score below zero.  Without
+  // that guarantee they are candidates like any other.
+  if (!stoppedEarly && (result.size() < count || !canPrune)) {
+    for (size_t slot = 0; slot < baseSlots_; slot++) {
+      if (!touched[slot] && inverseMagnitudes_[slot] != 0.0) {
+        result.push_back(make_pair(slot, 0.0));
+      }
+    }
+  }
+
+  // overlay slots aren't in the postings, so they're scored
+  // exactly; pruning only ever drops postings-backed slots
+  // that k others already beat.
+  for (auto slot : liveOverlaySlots_) {
+    if (inverseMagnitudes_[slot] == 0.0) {
+      continue;
+    }
+    double dotProd =
+      centroids_[slot]->wordVector.scores.dot(document.scoredWords);
+    result.push_back(make_pair(
+      slot, dotProd * inverseMagnitudes_[slot] / document.magnitude
+    ));
+  }
+
+  if (result.size() > count) {
+    std::partial_sort(
+      result.begin(), result.begin() + count, result.end(), scoreDescending
+    );
+    result.resize(count);
+  } else {
+    std::sort(result.begin(), result.end(), scoreDescending);
+  }
+  return result;
+}
+
+} // similarity_score_worker
+} // relevanced
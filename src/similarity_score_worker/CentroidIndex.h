@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <folly/Optional.h>
+
+#include "declarations.h"
+#include "util/ConcurrentMap.h"
+
+namespace relevanced {
+namespace similarity_score_worker {
+
+/**
+ * Immutable inverted index over a snapshot of the resident
+ * centroids: term id -> (centroid slot, weight) postings.
+ *
+ * Scoring a document against many centroids then takes a
+ * single pass over the document's terms, accumulating every
+ * centroid's dot product at once, instead of one merge-join
+ * per centroid.
+ *
+ * Postings are laid out CSR-style (one offsets array indexed
+ * by term id, one flat array of postings), and each posting
+ * list is ordered by slot.
+ *
+ * The index holds on to the centroid versions it was built
+ * from, so they stay valid for as long as the index does.
+ *
+ * For top-K queries it also keeps, per term, an upper bound on
+ * any centroid's normalized weight (`weight / magnitude`).
+ * Those bounds let `getBestMatches` stop opening new candidates
+ * once the terms it has not yet visited could no longer lift
+ * an unseen centroid into the top K (MaxScore-style pruning).
+ *
+ * Building the postings touches every centroid's terms, so a
+ * single changed centroid doesn't rebuild them: `withCentroid`
+ * and `withoutCentroid` return a new index that shares this one's
+ * postings, retires the centroid's old slot and appends any new
+ * version as an overlay slot.  Overlay slots are scored with a
+ * merge-join of their own, so callers should build a fresh index
+ * once `getOverlaySlotCount` grows.
+ */
+class CentroidIndex {
+ public:
+  typedef util::ConcurrentMap<std::string, models::Centroid>::ReadPtr CentroidPtr;
+
+ protected:
+  // shared between an index and the copies made from it.
+  struct Postings {
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> slots;
+    std::vector<double> weights;
+    std::vector<double> termUpperBounds;
+    bool hasNegativeWeights {false};
+  };
+  std::shared_ptr<const Postings> postings_ {std::make_shared<Postings>()};
+
+  // slots below `baseSlots_` are covered by `postings_`; the rest
+  // are overlay slots.  A retired slot keeps its place but is
+  // missing from `slotsById_` and has a zero inverse magnitude.
+  size_t baseSlots_ {0};
+  std::vector<std::string> centroidIds_;
+  std::vector<CentroidPtr> centroids_;
+  std::unordered_map<std::string, size_t> slotsById_;
+  std::vector<double> magnitudes_;
+  std::vector<double> inverseMagnitudes_;
+  std::vector<size_t> liveOverlaySlots_;
+
+  void retireSlot(const std::string &centroidId);
+
+ public:
+  CentroidIndex() {}
+  CentroidIndex(std::vector<std::pair<std::string, CentroidPtr>> centroids);
+
+  std::shared_ptr<CentroidIndex> withCentroid(
+    const std::string &centroidId, CentroidPtr centroid) const;
+  std::shared_ptr<CentroidIndex> withoutCentroid(
+    const std::string &centroidId) const;
+
+  // number of live centroids.
+  size_t size() const;
+
+  // one past the highest slot, live or retired.
+  size_t getSlotCount() const;
+
+  // slots appended since the postings were built, live or retired.
+  size_t getOverlaySlotCount() const;
+  size_t getPostingCount() const;
+  folly::Optional<size_t> getSlot(const std::string &centroidId) const;
+  const std::string& getCentroidId(size_t slot) const;
+  double getMagnitude(size_t slot) const;
+  models::Centroid* getCentroid(size_t slot);
+
+  // overwrites `dotProducts` with one raw (unnormalized)
+  // dot product per slot; retired slots hold no meaningful value.
+  void accumulate(
+    const models::ProcessedDocument &document,
+    std::vector<double> &dotProducts
+  ) const;
+
+  // the `count` best-scoring centroids as (slot, cosine similarity)
+  // pairs, highest score first.  Centroids with a zero magnitude
+  // are never returned.
+  std::vector<std::pair<size_t, double>> getBestMatches(
+    const models::ProcessedDocument &document,
+    size_t count
+  ) const;
+};
+
+} // similarity_score_worker
+} // relevanced
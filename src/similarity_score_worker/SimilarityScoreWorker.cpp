@@ -1,10 +1,18 @@
+#include <algorithm>
+#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <folly/ExceptionWrapper.h>
 #include <folly/futures/Future.h>
 #include <folly/futures/helpers.h>
 #include <folly/futures/Try.h>
+#include <folly/Memory.h>
 #include <folly/Optional.h>
 #include <folly/Synchronized.h>
 #include <folly/Format.h>
@@ -20,6 +28,7 @@
 #include "persistence/CentroidMetadataDb.h"
 #include "gen-cpp2/RelevancedProtocol_types.h"
 #include "persistence/Persistence.h"
+#include "similarity_score_worker/CentroidIndex.h"
 #include "similarity_score_worker/SimilarityScoreWorker.h"
 #include "util/util.h"
 #include "util/ConcurrentMap.h"
@@ -33,31 +42,115 @@ using models::Centroid;
 using util::ConcurrentMap;
 using util::UniquePointer;
 using thrift_protocol::ECentroidDoesNotExist;
+using thrift_protocol::ECentroidNotYetLoaded;
 using namespace wangle;
 using namespace folly;
 using namespace std;
 
+const size_t SimilarityScoreWorker::kBatchChunkSize;
+const size_t SimilarityScoreWorker::kInitialLoadWindow;
+const size_t SimilarityScoreWorker::kMaxIndexOverlaySlots;
+
 SimilarityScoreWorker::SimilarityScoreWorker(
     shared_ptr<persistence::PersistenceIf> persistence,
     shared_ptr<persistence::CentroidMetadataDbIf> centroidMetadataDb,
     shared_ptr<FutureExecutor<CPUThreadPoolExecutor>> threadPool)
     : persistence_(persistence),
       centroidMetadataDb_(centroidMetadataDb),
-      threadPool_(threadPool) {
+      threadPool_(threadPool),
+      centroidIndex_(std::make_shared<CentroidIndex>()) {
         centroids_ = std::make_shared<ConcurrentMap<string, Centroid>>(10);
       }
 
 // run synchronously on startup
 void SimilarityScoreWorker::initialize() {
+  loadAllCentroids();
+}
+
+void SimilarityScoreWorker::initializeInBackground() {
+  loadingInBackground_ = true;
+  initialLoadThread_ = std::thread([this]() {
+    loadAllCentroids();
+    loadingInBackground_ = false;
+  });
+}
+
+void SimilarityScoreWorker::loadAllCentroids() {
   auto centroidIds = persistence_->listAllCentroids().get();
+  centroidsToLoad_ = centroidIds.size();
+
+  // keep a bounded number of loads going on the persistence pool,
+  // rather than waiting on each one in turn.
+  deque<Future<bool>> inFlight;
   for (auto &id : centroidIds) {
-    auto centroid = persistence_->loadCentroidUniqueOption(id).get();
+    if (inFlight.size() >= kInitialLoadWindow) {
+      inFlight.front().wait();
+      inFlight.pop_front();
+    }
+    inFlight.push_back(persistence_->loadCentroidUniqueOption(id).then(
+      [this, id](Optional<UniquePointer<Centroid>> centroid) {
+        centroidsLoaded_++;
+        if (!centroid.hasValue()) {
+          LOG(INFO) << format("SimilarityScoreWorker initialization: centroid '{}' doesn't seem to exist...", id);
+          return false;
+        }
+        // with a background load, `reloadCentroid` may already have
+        // put a newer version in place.
+        centroids_->insertIfAbsent(id, std::move(centroid.value()));
+        return true;
+      }
+    ));
+  }
+  for (auto &load : inFlight) {
+    load.wait();
+  }
+  rebuildIndex();
+  initialLoadComplete_ = true;
+}
+
+CentroidLoadProgress SimilarityScoreWorker::getLoadProgress() {
+  CentroidLoadProgress progress;
+  progress.total = centroidsToLoad_.load();
+  progress.loaded = centroidsLoaded_.load();
+  progress.complete = initialLoadComplete_.load();
+  return progress;
+}
+
+exception_wrapper SimilarityScoreWorker::missingCentroidError() {
+  if (loadingInBackground_.load()) {
+    return make_exception_wrapper<ECentroidNotYetLoaded>();
+  }
+  return make_exception_wrapper<ECentroidDoesNotExist>();
+}
+
+void SimilarityScoreWorker::rebuildIndex() {
+  std::lock_guard<std::mutex> guard(indexRebuildMutex_);
+  auto index = std::make_shared<CentroidIndex>(centroids_->getAll());
+  centroidIndex_.swap(index);
+}
+
+void SimilarityScoreWorker::updateIndex(const string &centroidId) {
+  // updates are serialized and each one reads the centroid map
+  // under the lock, so the last to finish always reflects the
+  // latest version of its centroid.
+  std::lock_guard<std::mutex> guard(indexRebuildMutex_);
+  auto current = centroidIndex_.copy();
+  shared_ptr<CentroidIndex> index;
+  if (current->getOverlaySlotCount() >= kMaxIndexOverlaySlots) {
+    index = std::make_shared<CentroidIndex>(centroids_->getAll());
+  } else {
+    auto centroid = centroids_->getOption(centroidId);
     if (centroid.hasValue()) {
-      centroids_->insertOrUpdate(id, std::move(centroid.value()));
+      index = current->withCentroid(centroidId, centroid.value());
     } else {
-      LOG(INFO) << format("SimilarityScoreWorker initialization: centroid '{}' doesn't seem to exist...", id);
+      index = current->withoutCentroid(centroidId);
     }
   }
+  centroidIndex_.swap(index);
+}
+
+shared_ptr<CentroidIndex> SimilarityScoreWorker::getCentroidIndex() {
+  return centroidIndex_.copy();
 }
 
 Future<bool> SimilarityScoreWorker::reloadCentroid(string id) {
@@ -68,10 +161,21 @@ Future<bool> SimilarityScoreWorker::reloadCentroid(string id) {
           return false;
         }
         centroids_->insertOrUpdate(id, std::move(centroid.value()));
+        updateIndex(id);
         return true;
       });
 }
 
+Future<bool> SimilarityScoreWorker::removeCentroid(string id) {
+  return threadPool_->addFuture([this, id]() {
+    if (!centroids_->erase(id)) {
+      return false;
+    }
+    updateIndex(id);
+    return true;
+  });
+}
+
 
 Future<Try<double>> SimilarityScoreWorker::getDocumentSimilarity(
     string centroidId, ProcessedDocument *doc) {
@@ -81,9 +185,7 @@ Future<Try<double>> SimilarityScoreWorker::getDocumentSimilarity(
       if (!centroid.hasValue()) {
         LOG(INFO) << "relevance request against null centroid: "
                   << centroidId;
-        return Try<double>(
-          make_exception_wrapper<ECentroidDoesNotExist>()
-        );
+        return Try<double>(missingCentroidError());
       }
       auto result = centroid.value()->score(doc);
       return Try<double>(result);
@@ -95,6 +197,127 @@ Future<Try<double>> SimilarityScoreWorker::getDocumentSimilarity(
   return getDocumentSimilarity(centroidId, doc.get());
 }
 
+Try<map<string, double>> SimilarityScoreWorker::scoreDocument(
+    CentroidIndex *index,
+    const vector<string> &centroidIds,
+    ProcessedDocument *doc,
+    vector<double> &dotProducts) {
+  // a posting traversal touches every indexed centroid that shares
+  // a term with the document, so it only pays off when a good
+  // fraction of the indexed centroids were actually requested.
+  bool useIndex = (centroidIds.size() * 4) >= index->size();
+  if (useIndex) {
+    index->accumulate(*doc, dotProducts);
+  }
+  map<string, double> response;
+  for (auto &centroidId : centroidIds) {
+    auto slot = index->getSlot(centroidId);
+    if (useIndex && slot.hasValue()) {
+      auto dotProd = dotProducts.at(slot.value());
+      response.insert(make_pair(
+        centroidId,
+        dotProd / (index->getMagnitude(slot.value()) * doc->magnitude)
+      ));
+      continue;
+    }
+
+    // not indexed (yet), or not worth a traversal.
+    auto centroid = centroids_->getOption(centroidId);
+    if (!centroid.hasValue()) {
+      LOG(INFO) << "relevance request against null centroid: "
+                << centroidId;
+      return Try<map<string, double>>(missingCentroidError());
+    }
+    response.insert(make_pair(
+      centroidId, centroid.value()->score(doc)
+    ));
+  }
+  return Try<map<string, double>>(std::move(response));
+}
+
+Future<Try<unique_ptr<map<string, double>>>>
+SimilarityScoreWorker::multiGetDocumentSimilarity(
+    shared_ptr<vector<string>> centroidIds, shared_ptr<ProcessedDocument> doc) {
+  return threadPool_->addFuture(
+    [this, centroidIds, doc]() {
+      typedef Try<unique_ptr<map<string, double>>> TResult;
+      auto index = getCentroidIndex();
+      vector<double> dotProducts;
+      auto scores = scoreDocument(
+        index.get(), *centroidIds, doc.get(), dotProducts
+      );
+      if (scores.hasException()) {
+        return TResult(scores.exception());
+      }
+      return TResult(
+        folly::make_unique<map<string, double>>(std::move(scores.value()))
+      );
+  });
+}
+
+Future<Try<unique_ptr<vector<map<string, double>>>>>
+SimilarityScoreWorker::multiGetDocumentSimilarityBatch(
+    shared_ptr<vector<string>> centroidIds,
+    shared_ptr<vector<shared_ptr<ProcessedDocument>>> docs) {
+  typedef Try<vector<map<string, double>>> TChunk;
+  typedef Try<unique_ptr<vector<map<string, double>>>> TResult;
+
+  // every chunk scores against the same index snapshot, so the
+  // rows of the result are consistent with each other.
+  auto index = getCentroidIndex();
+  vector<Future<TChunk>> chunks;
+  for (size_t start = 0; start < docs->size(); start += kBatchChunkSize) {
+    size_t end = std::min(docs->size(), start + kBatchChunkSize);
+    chunks.push_back(threadPool_->addFuture(
+      [this, index, centroidIds, docs, start, end]() {
+        vector<double> dotProducts;
+        vector<map<string, double>> rows;
+        rows.reserve(end - start);
+        for (size_t i = start; i < end; i++) {
+          auto scores = scoreDocument(
+            index.get(), *centroidIds, docs->at(i).get(), dotProducts
+          );
+          if (scores.hasException()) {
+            return TChunk(scores.exception());
+          }
+          rows.push_back(std::move(scores.value()));
+        }
+        return TChunk(std::move(rows));
+      }
+    ));
+  }
+  return collect(chunks).then([](vector<TChunk> results) {
+    auto response = folly::make_unique<vector<map<string, double>>>();
+    for (auto &chunk : results) {
+      if (chunk.hasException()) {
+        return TResult(chunk.exception());
+      }
+      for (auto &row : chunk.value()) {
+        response->push_back(std::move(row));
+      }
+    }
+    return TResult(std::move(response));
+  });
+}
+
+Future<unique_ptr<vector<pair<string, double>>>>
+SimilarityScoreWorker::getBestMatchingCentroids(
+    shared_ptr<ProcessedDocument> doc, size_t count) {
+  return threadPool_->addFuture(
+    [this, doc, count]() {
+      auto index = getCentroidIndex();
+      auto matches = index->getBestMatches(*doc, count);
+      auto response = folly::make_unique<vector<pair<string, double>>>();
+      response->reserve(matches.size());
+      for (auto &match : matches) {
+        response->push_back(make_pair(
+          index->getCentroidId(match.first), match.second
+        ));
+      }
+      return std::move(response);
+  });
+}
+
 Future<Try<double>> SimilarityScoreWorker::getCentroidSimilarity(
     string centroid1Id, string centroid2Id) {
   return threadPool_->addFuture(
@@ -102,9 +325,7 @@ Future<Try<double>> SimilarityScoreWorker::getCentroidSimilarity(
       auto centroid1 = centroids_->getOption(centroid1Id);
       auto centroid2 = centroids_->getOption(centroid2Id);
       if (!centroid1.hasValue() || !centroid2.hasValue()) {
-        return Try<double>(
-          make_exception_wrapper<ECentroidDoesNotExist>()
-        );
+        return Try<double>(missingCentroidError());
       }
       return Try<double>(
         centroid1.value()->score(
@@ -119,6 +340,9 @@ Optional<ConcurrentMap<string, Centroid>::ReadPtr> SimilarityScoreWorker::debugG
 }
 
 SimilarityScoreWorker::~SimilarityScoreWorker(){
+  if (initialLoadThread_.joinable()) {
+    initialLoadThread_.join();
+  }
 }
 
 } // similarity_score_worker
@@ -1,6 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 #include <cassert>
 
@@ -13,18 +19,47 @@
 #include "declarations.h"
 #include "util/util.h"
 #include "util/ConcurrentMap.h"
+#include "similarity_score_worker/CentroidIndex.h"
+
 namespace relevanced {
 namespace similarity_score_worker {
 
+struct CentroidLoadProgress {
+  size_t total {0};
+  size_t loaded {0};
+  bool complete {false};
+};
+
 class SimilarityScoreWorkerIf {
  public:
+  // blocks until every centroid has been loaded.
   virtual void initialize() = 0;
+
+  // returns immediately.  Until loading finishes, requests against
+  // centroids that haven't been loaded yet fail with the retryable
+  // `ECentroidNotYetLoaded` instead of `ECentroidDoesNotExist`.
+  virtual void initializeInBackground() = 0;
+  virtual CentroidLoadProgress getLoadProgress() = 0;
   virtual folly::Future<bool> reloadCentroid(std::string id) = 0;
+
+  // drops a deleted centroid from memory and from the index.
+  virtual folly::Future<bool> removeCentroid(std::string id) = 0;
   virtual folly::Future<folly::Try<double>> getDocumentSimilarity(
       std::string centroidId, models::ProcessedDocument *doc) = 0;
   virtual folly::Future<folly::Try<double>> getDocumentSimilarity(
       std::string centroidId,
       std::shared_ptr<models::ProcessedDocument> doc) = 0;
+  virtual folly::Future<folly::Try<std::unique_ptr<std::map<std::string, double>>>>
+    multiGetDocumentSimilarity(
+      std::shared_ptr<std::vector<std::string>> centroidIds,
+      std::shared_ptr<models::ProcessedDocument> doc) = 0;
+  virtual folly::Future<folly::Try<std::unique_ptr<std::vector<std::map<std::string, double>>>>>
+    multiGetDocumentSimilarityBatch(
+      std::shared_ptr<std::vector<std::string>> centroidIds,
+      std::shared_ptr<std::vector<std::shared_ptr<models::ProcessedDocument>>> docs) = 0;
+  virtual folly::Future<std::unique_ptr<std::vector<std::pair<std::string, double>>>>
+    getBestMatchingCentroids(
+      std::shared_ptr<models::ProcessedDocument> doc, size_t count) = 0;
   virtual folly::Future<folly::Try<double>> getCentroidSimilarity(
       std::string centroid1Id, std::string centroid2Id) = 0;
 };
@@ -44,6 +79,20 @@ class SimilarityScoreWorkerIf {
  * Similarly, requests to reload the centroid are sent by the
  * `RelevanceServer` when it becomes aware of new data.
  *
+ * Alongside the centroid map it keeps a `CentroidIndex`.  A reloaded
+ * or removed centroid is folded into a copy of the current index
+ * that shares its postings, so an update costs about one copy of
+ * the per-centroid arrays rather than a walk over every centroid's
+ * terms; the postings are rebuilt from scratch once
+ * `kMaxIndexOverlaySlots` updates have piled up.  Requests
+ * that score a document against many centroids at once go through
+ * the index, so the document is traversed once rather than once
+ * per centroid.  Batches of documents are split into chunks that
+ * are scored in parallel across the pool.
+ *
+ * On startup, centroids are loaded concurrently on the persistence
+ * pool, with at most `kInitialLoadWindow` loads in flight at once.
+ *
  */
 
 class SimilarityScoreWorker : public SimilarityScoreWorkerIf {
@@ -54,6 +103,36 @@ class SimilarityScoreWorker : public SimilarityScoreWorkerIf {
       threadPool_;
 
   std::shared_ptr<util::ConcurrentMap<std::string, models::Centroid>> centroids_;
+  folly::Synchronized<std::shared_ptr<CentroidIndex>> centroidIndex_;
+  std::mutex indexRebuildMutex_;
+  static const size_t kMaxIndexOverlaySlots = 64;
+
+  // in-flight centroid loads during startup.
+  static const size_t kInitialLoadWindow = 32;
+  std::atomic<size_t> centroidsToLoad_ {0};
+  std::atomic<size_t> centroidsLoaded_ {0};
+  std::atomic<bool> initialLoadComplete_ {false};
+  std::atomic<bool> loadingInBackground_ {false};
+  std::thread initialLoadThread_;
+
+  void loadAllCentroids();
+  folly::exception_wrapper missingCentroidError();
+
+  void rebuildIndex();
+
+  // brings one centroid's entry in the index in line with
+  // `centroids_`.
+  void updateIndex(const std::string &centroidId);
+
+  // documents per pool task when scoring a batch.
+  static const size_t kBatchChunkSize = 64;
+
+  folly::Try<std::map<std::string, double>> scoreDocument(
+    CentroidIndex *index,
+    const std::vector<std::string> &centroidIds,
+    models::ProcessedDocument *doc,
+    std::vector<double> &dotProducts
+  );
 
  public:
   SimilarityScoreWorker(
@@ -62,14 +141,29 @@ class SimilarityScoreWorker : public SimilarityScoreWorkerIf {
       std::shared_ptr<wangle::FutureExecutor<wangle::CPUThreadPoolExecutor>>
           threadPool);
   void initialize() override;
+  void initializeInBackground() override;
+  CentroidLoadProgress getLoadProgress() override;
   folly::Future<bool> reloadCentroid(std::string id) override;
+  folly::Future<bool> removeCentroid(std::string id) override;
   folly::Future<folly::Try<double>> getDocumentSimilarity(
       std::string centroidId, models::ProcessedDocument *doc) override;
   folly::Future<folly::Try<double>> getDocumentSimilarity(
       std::string centroidId,
       std::shared_ptr<models::ProcessedDocument> doc) override;
+  folly::Future<folly::Try<std::unique_ptr<std::map<std::string, double>>>>
+    multiGetDocumentSimilarity(
+      std::shared_ptr<std::vector<std::string>> centroidIds,
+      std::shared_ptr<models::ProcessedDocument> doc) override;
+  folly::Future<folly::Try<std::unique_ptr<std::vector<std::map<std::string, double>>>>>
+    multiGetDocumentSimilarityBatch(
+      std::shared_ptr<std::vector<std::string>> centroidIds,
+      std::shared_ptr<std::vector<std::shared_ptr<models::ProcessedDocument>>> docs) override;
+  folly::Future<std::unique_ptr<std::vector<std::pair<std::string, double>>>>
+    getBestMatchingCentroids(
+      std::shared_ptr<models::ProcessedDocument> doc, size_t count) override;
   folly::Future<folly::Try<double>> getCentroidSimilarity(
       std::string centroid1Id, std::string centroid2Id) override;
+  std::shared_ptr<CentroidIndex> getCentroidIndex();
   folly::Optional<util::ConcurrentMap<std::string, models::Centroid>::ReadPtr> debugGetCentroid(const std::string&);
   ~SimilarityScoreWorker();
 };
@@ -0,0 +1,279 @@
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "models/Centroid.h"
+#include "models/ProcessedDocument.h"
+#include "similarity_score_worker/CentroidIndex.h"
+#include "text_util/ScoredWord.h"
+#include "util/ConcurrentMap.h"
+#include "util/util.h"
+
+using namespace std;
+using namespace relevanced;
+using namespace relevanced::models;
+using namespace relevanced::similarity_score_worker;
+using relevanced::text_util::ScoredWord;
+using relevanced::util::ConcurrentMap;
+using relevanced::util::UniquePointer;
+
+namespace {
+
+double magnitudeOf(const unordered_map<string, double> &scores) {
+  double total = 0.0;
+  for (auto &elem : scores) {
+    total += elem.second * elem.second;
+  }
+  return sqrt(total);
+}
+
+void addCentroid(ConcurrentMap<string, Centroid> &centroids,
+                 const string &id,
+                 unordered_map<string, double> scores) {
+  double mag = magnitudeOf(scores);
+  centroids.insertOrUpdate(
+    id, UniquePointer<Centroid>(new Centroid(id, scores, mag))
+  );
+}
+
+} // anonymous namespace
+
+TEST(CentroidIndex, TestEmpty) {
+  CentroidIndex index;
+  EXPECT_EQ(0, index.size());
+  EXPECT_EQ(0, index.getPostingCount());
+  EXPECT_FALSE(index.getSlot("centroid-1").hasValue());
+
+  vector<ScoredWord> words {ScoredWord("dog", 3, 5.8)};
+  ProcessedDocument document("doc-1", words, 5.8);
+  vector<double> dotProducts {1.0, 2.0};
+  index.accumulate(document, dotProducts);
+  EXPECT_TRUE(dotProducts.empty());
+}
+
+TEST(CentroidIndex, TestSlotsAndPostings) {
+  ConcurrentMap<string, Centroid> centroids(10);
+  addCentroid(centroids, "centroid-1", {{"cat", 1.2}, {"dog", 9.5}});
+  addCentroid(centroids, "centroid-2", {{"dog", 2.0}, {"fish", 0.8}, {"bird", 1.1}});
+  CentroidIndex index(centroids.getAll());
+
+  EXPECT_EQ(2, index.size());
+  EXPECT_EQ(5, index.getPostingCount());
+  auto slot1 = index.getSlot("centroid-1");
+  auto slot2 = index.getSlot("centroid-2");
+  EXPECT_TRUE(slot1.hasValue());
+  EXPECT_TRUE(slot2.hasValue());
+  EXPECT_EQ("centroid-1", index.getCentroidId(slot1.value()));
+  EXPECT_EQ("centroid-2", index.getCentroidId(slot2.value()));
+  EXPECT_EQ("centroid-2", index.getCentroid(slot2.value())->id);
+  EXPECT_DOUBLE_EQ(
+    magnitudeOf({{"cat", 1.2}, {"dog", 9.5}}),
+    index.getMagnitude(slot1.value())
+  );
+  EXPECT_FALSE(index.getSlot("centroid-3").hasValue());
+}
+
+TEST(CentroidIndex, TestAccumulateMatchesPerCentroidScore) {
+  ConcurrentMap<string, Centroid> centroids(10);
+  addCentroid(centroids, "centroid-1", {{"cat", 1.2}, {"dog", 9.5}, {"fish", 0.8}});
+  addCentroid(centroids, "centroid-2", {{"dog", 2.0}, {"fox", 3.3}});
+  addCentroid(centroids, "centroid-3", {{"whale", 7.0}});
+  CentroidIndex index(centroids.getAll());
+
+  vector<ScoredWord> words {
+    ScoredWord("dog", 3, 5.8),
+    ScoredWord("fox", 3, 4.1),
+    ScoredWord("sarah_jessica_parker", 20, 15.1)
+  };
+  ProcessedDocument document("doc-1", words, sqrt(5.8*5.8 + 4.1*4.1 + 15.1*15.1));
+
+  vector<double> dotProducts;
+  index.accumulate(document, dotProducts);
+  EXPECT_EQ(3, dotProducts.size());
+  for (size_t slot = 0; slot < index.size(); slot++) {
+    double expected = index.getCentroid(slot)->score(&document);
+    double actual = dotProducts[slot]
+        / (index.getMagnitude(slot) * document.magnitude);
+    EXPECT_DOUBLE_EQ(expected, actual);
+  }
+  EXPECT_EQ(0.0, dotProducts[index.getSlot("centroid-3").value()]);
+}
+
+TEST(CentroidIndex, TestKeepsCentroidVersion) {
+  ConcurrentMap<string, Centroid> centroids(10);
+  addCentroid(centroids, "centroid-1", {{"cat", 1.2}});
+  CentroidIndex index(centroids.getAll());
+  addCentroid(centroids, "centroid-1", {{"dog", 3.0}, {"fish", 4.0}});
+
+  auto slot = index.getSlot("centroid-1").value();
+  EXPECT_DOUBLE_EQ(1.2, index.getMagnitude(slot));
+  EXPECT_EQ(1, index.getCentroid(slot)->wordVector.scores.size());
+}
+
+TEST(CentroidIndex, TestGetBestMatches) {
+  ConcurrentMap<string, Centroid> centroids(10);
+  addCentroid(centroids, "centroid-1", {{"cat", 1.2}, {"dog", 9.5}, {"fish", 0.8}});
+  addCentroid(centroids, "centroid-2", {{"dog", 2.0}, {"fox", 3.3}});
+  addCentroid(centroids, "centroid-3", {{"whale", 7.0}});
+  addCentroid(centroids, "centroid-4", {{"fox", 9.0}, {"bird", 0.5}});
+  CentroidIndex index(centroids.getAll());
+
+  vector<ScoredWord> words {
+    ScoredWord("dog", 3, 5.8),
+    ScoredWord("fox", 3, 4.1),
+    ScoredWord("sarah_jessica_parker", 20, 15.1)
+  };
+  ProcessedDocument document("doc-1", words, sqrt(5.8*5.8 + 4.1*4.1 + 15.1*15.1));
+
+  vector<pair<double, string>> expected;
+  for (size_t slot = 0; slot < index.size(); slot++) {
+    expected.push_back(make_pair(
+      index.getCentroid(slot)->score(&document), index.getCentroidId(slot)
+    ));
+  }
+  sort(expected.rbegin(), expected.rend());
+
+  for (size_t count = 1; count <= 5; count++) {
+    auto matches = index.getBestMatches(document, count);
+    EXPECT_EQ(min(count, expected.size()), matches.size());
+    for (size_t i = 0; i < matches.size(); i++) {
+      EXPECT_EQ(expected[i].second, index.getCentroidId(matches[i].first));
+      EXPECT_NEAR(expected[i].first, matches[i].second, 1e-12);
+    }
+  }
+  EXPECT_TRUE(index.getBestMatches(document, 0).empty());
+}
+
+TEST(CentroidIndex, TestGetBestMatchesSkipsEmptyCentroids) {
+  ConcurrentMap<string, Centroid> centroids(10);
+  addCentroid(centroids, "centroid-1", {{"dog", 1.0}});
+  addCentroid(centroids, "centroid-2", {});
+  CentroidIndex index(centroids.getAll());
+
+  vector<ScoredWord> words {ScoredWord("dog", 3, 5.8)};
+  ProcessedDocument document("doc-1", words, 5.8);
+  auto matches = index.getBestMatches(document, 10);
+  EXPECT_EQ(1, matches.size());
+  EXPECT_EQ("centroid-1", index.getCentroidId(matches.at(0).first));
+  EXPECT_FLOAT_EQ(1.0, matches.at(0).second);
+}
+
+TEST(CentroidIndex, TestWithCentroidSharesPostings) {
+  ConcurrentMap<string, Centroid> centroids(10);
+  addCentroid(centroids, "centroid-1", {{"cat", 1.2}, {"dog", 9.5}});
+  addCentroid(centroids, "centroid-2", {{"dog", 2.0}, {"fox", 3.3}});
+  CentroidIndex index(centroids.getAll());
+
+  addCentroid(centroids, "centroid-2", {{"fox", 1.0}, {"whale", 4.0}});
+  addCentroid(centroids, "centroid-3", {{"dog", 5.0}});
+  auto updated = index.withCentroid(
+    "centroid-2", centroids.getOption("centroid-2").value()
+  );
+  updated = updated->withCentroid(
+    "centroid-3", centroids.getOption("centroid-3").value()
+  );
+
+  // the original is untouched.
+  EXPECT_EQ(2, index.size());
+  EXPECT_FALSE(index.getSlot("centroid-3").hasValue());
+  auto oldSlot2 = index.getSlot("centroid-2").value();
+  EXPECT_DOUBLE_EQ(
+    magnitudeOf({{"dog", 2.0}, {"fox", 3.3}}), index.getMagnitude(oldSlot2)
+  );
+
+  EXPECT_EQ(3, updated->size());
+  EXPECT_EQ(4, updated->getSlotCount());
+  EXPECT_EQ(2, updated->getOverlaySlotCount());
+  EXPECT_EQ(index.getPostingCount(), updated->getPostingCount());
+  auto slot2 = updated->getSlot("centroid-2").value();
+  EXPECT_EQ("centroid-2", updated->getCentroidId(slot2));
+  EXPECT_DOUBLE_EQ(
+    magnitudeOf({{"fox", 1.0}, {"whale", 4.0}}), updated->getMagnitude(slot2)
+  );
+
+  vector<ScoredWord> words {
+    ScoredWord("dog", 3, 5.8),
+    ScoredWord("fox", 3, 4.1),
+    ScoredWord("whale", 5, 2.0)
+  };
+  ProcessedDocument document("doc-1", words, sqrt(5.8*5.8 + 4.1*4.1 + 2.0*2.0));
+  vector<double> dotProducts;
+  updated->accumulate(document, dotProducts);
+  EXPECT_EQ(4, dotProducts.size());
+  for (auto id : {"centroid-1", "centroid-2", "centroid-3"}) {
+    auto slot = updated->getSlot(id).value();
+    auto centroid = centroids.getOption(id).value();
+    double expected = centroid->score(&document);
+    double actual = dotProducts[slot]
+        / (updated->getMagnitude(slot) * document.magnitude);
+    EXPECT_DOUBLE_EQ(expected, actual);
+  }
+}
+
+TEST(CentroidIndex, TestWithoutCentroid) {
+  ConcurrentMap<string, Centroid> centroids(10);
+  addCentroid(centroids, "centroid-1", {{"dog", 1.0}});
+  addCentroid(centroids, "centroid-2", {{"dog", 2.0}, {"fox", 1.0}});
+  CentroidIndex index(centroids.getAll());
+  addCentroid(centroids, "centroid-3", {{"dog", 3.0}});
+  auto updated = index.withCentroid(
+    "centroid-3", centroids.getOption("centroid-3").value()
+  );
+  updated = updated->withoutCentroid("centroid-2");
+  updated = updated->withoutCentroid("centroid-3");
+  updated = updated->withoutCentroid("missing");
+
+  EXPECT_EQ(1, updated->size());
+  EXPECT_FALSE(updated->getSlot("centroid-2").hasValue());
+  EXPECT_FALSE(updated->getSlot("centroid-3").hasValue());
+
+  vector<ScoredWord> words {ScoredWord("dog", 3, 5.8)};
+  ProcessedDocument document("doc-1", words, 5.8);
+  auto matches = updated->getBestMatches(document, 10);
+  EXPECT_EQ(1, matches.size());
+  EXPECT_EQ("centroid-1", updated->getCentroidId(matches.at(0).first));
+}
+
+TEST(CentroidIndex, TestGetBestMatchesWithOverlay) {
+  ConcurrentMap<string, Centroid> centroids(10);
+  addCentroid(centroids, "centroid-1", {{"cat", 1.2}, {"dog", 9.5}, {"fish", 0.8}});
+  addCentroid(centroids, "centroid-2", {{"dog", 2.0}, {"fox", 3.3}});
+  addCentroid(centroids, "centroid-3", {{"whale", 7.0}});
+  addCentroid(centroids, "centroid-4", {{"fox", 9.0}, {"bird", 0.5}});
+  CentroidIndex index(centroids.getAll());
+
+  // the best match moves into the overlay, and a new one joins it.
+  addCentroid(centroids, "centroid-4", {{"bird", 3.0}, {"fox", 0.1}});
+  addCentroid(centroids, "centroid-5", {{"dog", 1.0}, {"fox", 1.0}});
+  auto updated = index.withCentroid(
+    "centroid-4", centroids.getOption("centroid-4").value()
+  );
+  updated = updated->withCentroid(
+    "centroid-5", centroids.getOption("centroid-5").value()
+  );
+
+  vector<ScoredWord> words {
+    ScoredWord("dog", 3, 5.8),
+    ScoredWord("fox", 3, 4.1),
+    ScoredWord("sarah_jessica_parker", 20, 15.1)
+  };
+  ProcessedDocument document("doc-1", words, sqrt(5.8*5.8 + 4.1*4.1 + 15.1*15.1));
+
+  vector<pair<double, string>> expected;
+  for (auto &elem : centroids.getAll()) {
+    expected.push_back(make_pair(elem.second->score(&document), elem.first));
+  }
+  sort(expected.rbegin(), expected.rend());
+
+  for (size_t count = 1; count <= 6; count++) {
+    auto matches = updated->getBestMatches(document, count);
+    EXPECT_EQ(min(count, expected.size()), matches.size());
+    for (size_t i = 0; i < matches.size(); i++) {
+      EXPECT_EQ(expected[i].second, updated->getCentroidId(matches[i].first));
+      EXPECT_NEAR(expected[i].first, matches[i].second, 1e-12);
+    }
+  }
+}
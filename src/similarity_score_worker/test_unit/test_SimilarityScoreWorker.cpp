@@ -5,8 +5,12 @@
 #include <memory>
 #include <unordered_map>
 #include <cmath>
+#include <chrono>
+#include <future>
+#include <thread>
 #include <wangle/concurrent/CPUThreadPoolExecutor.h>
 #include <wangle/concurrent/FutureExecutor.h>
+#include <folly/Format.h>
 #include <folly/Optional.h>
 #include <folly/futures/Try.h>
 #include <glog/logging.h>
@@ -39,6 +43,7 @@ using namespace relevanced::similarity_score_worker;
 using namespace relevanced::persistence;
 using namespace relevanced::thrift_protocol;
 using relevanced::thrift_protocol::ECentroidDoesNotExist;
+using relevanced::thrift_protocol::ECentroidNotYetLoaded;
 using relevanced::stopwords::StopwordFilterIf;
 using relevanced::stemmer::StemmerIf;
 using util::UniquePointer;
@@ -89,6 +94,67 @@ TEST(SimilarityScoreWorker, TestInitialization) {
   EXPECT_FALSE(worker->debugGetCentroid("bad-centroid").hasValue());
 }
 
+TEST(SimilarityScoreWorker, TestInitializationManyCentroids) {
+  MockSyncPersistence mockPersistence;
+  MockCentroidMetadataDb metadataDb;
+  auto worker = makeWorker(mockPersistence, metadataDb);
+  vector<string> centroidIds;
+  vector<unique_ptr<Centroid>> centroids;
+  for (size_t i = 0; i < 100; i++) {
+    string id = folly::sformat("centroid-{}", i);
+    centroidIds.push_back(id);
+    centroids.emplace_back(new Centroid(id,
+              unordered_map<string, double>{{"cat", 1.0 + i}, {"dog", 9.5}},
+              sqrt((1.0 + i) * (1.0 + i) + 9.5 * 9.5)));
+    mockPersistence.addUniqueCentroid(id, centroids.back().get());
+  }
+  EXPECT_CALL(mockPersistence, listAllCentroids())
+      .WillOnce(Return(centroidIds));
+
+  EXPECT_FALSE(worker->getLoadProgress().complete);
+  worker->initialize();
+  for (auto &id : centroidIds) {
+    EXPECT_TRUE(worker->debugGetCentroid(id).hasValue());
+  }
+  auto progress = worker->getLoadProgress();
+  EXPECT_EQ(100, progress.total);
+  EXPECT_EQ(100, progress.loaded);
+  EXPECT_TRUE(progress.complete);
+}
+
+TEST(SimilarityScoreWorker, TestInitializationInBackground) {
+  MockSyncPersistence mockPersistence;
+  MockCentroidMetadataDb metadataDb;
+  auto worker = makeWorker(mockPersistence, metadataDb);
+  vector<string> centroidIds{"centroid-1", "centroid-2"};
+  promise<void> gate;
+  auto gateOpened = gate.get_future().share();
+  EXPECT_CALL(mockPersistence, listAllCentroids())
+      .WillOnce(Invoke([&centroidIds, gateOpened]() {
+        gateOpened.wait();
+        return centroidIds;
+      }));
+  Centroid centroid1("centroid-1",
+      unordered_map<string, double>{{"cat", 1.2}, {"dog", 9.5}}, sqrt(1.2 * 1.2 + 9.5 * 9.5));
+  Centroid centroid2("centroid-2",
+      unordered_map<string, double>{{"cat", 1.2}, {"fish", 0.8}}, sqrt(1.2 * 1.2 + 0.8 * 0.8));
+  mockPersistence.addUniqueCentroid("centroid-1", &centroid1);
+  mockPersistence.addUniqueCentroid("centroid-2", &centroid2);
+
+  worker->initializeInBackground();
+  auto pending = worker->getCentroidSimilarity("centroid-1", "centroid-2").get();
+  EXPECT_TRUE(pending.hasException<ECentroidNotYetLoaded>());
+  EXPECT_FALSE(worker->getLoadProgress().complete);
+
+  gate.set_value();
+  for (size_t i = 0; i < 500 && !worker->getLoadProgress().complete; i++) {
+    this_thread::sleep_for(chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(worker->getLoadProgress().complete);
+  auto loaded = worker->getCentroidSimilarity("centroid-1", "centroid-2").get();
+  EXPECT_FALSE(loaded.hasException());
+}
+
 TEST(SimilarityScoreWorker, TestReloadCentroid) {
   MockSyncPersistence mockPersistence;
   MockCentroidMetadataDb metadataDb;
@@ -174,3 +240,202 @@ TEST(SimilarityScoreWorker, TestGetDocumentSimilarityNoCentroidNoNoneAtAll) {
   auto result = worker->getDocumentSimilarity("centroid-1", &document).get();
   EXPECT_TRUE(result.hasException<ECentroidDoesNotExist>());
 }
+
+TEST(SimilarityScoreWorker, TestMultiGetDocumentSimilarity) {
+  MockSyncPersistence mockPersistence;
+  MockCentroidMetadataDb metadataDb;
+  auto worker = makeWorker(mockPersistence, metadataDb);
+  vector<ScoredWord> words {
+    ScoredWord("dog", 3, 5.8),
+    ScoredWord("fox", 3, 4.1),
+    ScoredWord("sarah_jessica_parker", 20, 15.1)
+  };
+  auto document = make_shared<ProcessedDocument>(
+    "doc-1", words, mag3(5.8, 4.1, 15.1)
+  );
+  mockPersistence.addUniqueCentroid("centroid-1", new Centroid ("centroid-1",
+              unordered_map<string, double>{{"cat", 1.2}, {"dog", 9.5}, {"fish", 0.8}},
+              mag3(1.2, 9.5, 0.8)));
+  mockPersistence.addUniqueCentroid("centroid-2", new Centroid ("centroid-2",
+              unordered_map<string, double>{{"fox", 2.2}, {"dog", 1.5}, {"bird", 0.3}},
+              mag3(2.2, 1.5, 0.3)));
+  worker->reloadCentroid("centroid-1").get();
+  worker->reloadCentroid("centroid-2").get();
+  EXPECT_EQ(2, worker->getCentroidIndex()->size());
+
+  auto centroidIds = make_shared<vector<string>>(
+    vector<string> {"centroid-1", "centroid-2"}
+  );
+  auto result = worker->multiGetDocumentSimilarity(centroidIds, document).get();
+  EXPECT_FALSE(result.hasException());
+  auto &scores = *result.value();
+  EXPECT_EQ(2, scores.size());
+  auto expected1 = worker->getDocumentSimilarity("centroid-1", document).get();
+  auto expected2 = worker->getDocumentSimilarity("centroid-2", document).get();
+  EXPECT_DOUBLE_EQ(expected1.value(), scores["centroid-1"]);
+  EXPECT_DOUBLE_EQ(expected2.value(), scores["centroid-2"]);
+}
+
+TEST(SimilarityScoreWorker, TestConcurrentReloadsAreAllIndexed) {
+  MockSyncPersistence mockPersistence;
+  MockCentroidMetadataDb metadataDb;
+  auto worker = makeWorker(mockPersistence, metadataDb);
+  vector<unique_ptr<Centroid>> centroids;
+  vector<folly::Future<bool>> reloads;
+  for (size_t i = 0; i < 50; i++) {
+    string id = folly::sformat("centroid-{}", i);
+    centroids.emplace_back(new Centroid(id,
+              unordered_map<string, double>{{"cat", 1.0 + i}, {"dog", 9.5}},
+              sqrt((1.0 + i) * (1.0 + i) + 9.5 * 9.5)));
+    mockPersistence.addUniqueCentroid(id, centroids.back().get());
+  }
+  for (size_t i = 0; i < 50; i++) {
+    reloads.push_back(
+      worker->reloadCentroid(folly::sformat("centroid-{}", i))
+    );
+  }
+  for (auto &reload : reloads) {
+    EXPECT_TRUE(reload.get());
+  }
+  auto index = worker->getCentroidIndex();
+  EXPECT_EQ(50, index->size());
+  for (size_t i = 0; i < 50; i++) {
+    EXPECT_TRUE(index->getSlot(folly::sformat("centroid-{}", i)).hasValue());
+  }
+}
+
+TEST(SimilarityScoreWorker, TestReloadsUpdateIndexIncrementally) {
+  MockSyncPersistence mockPersistence;
+  MockCentroidMetadataDb metadataDb;
+  auto worker = makeWorker(mockPersistence, metadataDb);
+  vector<unique_ptr<Centroid>> centroids;
+  centroids.emplace_back(new Centroid("centroid-2",
+            unordered_map<string, double>{{"fox", 2.0}}, 2.0));
+  mockPersistence.addUniqueCentroid("centroid-2", centroids.back().get());
+  worker->reloadCentroid("centroid-2").get();
+
+  for (size_t i = 0; i < 150; i++) {
+    centroids.emplace_back(new Centroid("centroid-1",
+              unordered_map<string, double>{{"dog", 1.0 + i}}, 1.0 + i));
+    mockPersistence.addUniqueCentroid("centroid-1", centroids.back().get());
+    worker->reloadCentroid("centroid-1").get();
+    auto index = worker->getCentroidIndex();
+    EXPECT_EQ(2, index->size());
+    EXPECT_TRUE(index->getOverlaySlotCount() <= 64);
+    auto slot = index->getSlot("centroid-1").value();
+    EXPECT_EQ(1.0 + i, index->getMagnitude(slot));
+  }
+
+  EXPECT_TRUE(worker->removeCentroid("centroid-2").get());
+  EXPECT_FALSE(worker->removeCentroid("centroid-2").get());
+  auto index = worker->getCentroidIndex();
+  EXPECT_EQ(1, index->size());
+  EXPECT_FALSE(index->getSlot("centroid-2").hasValue());
+  EXPECT_FALSE(worker->debugGetCentroid("centroid-2").hasValue());
+}
+
+TEST(SimilarityScoreWorker, TestMultiGetDocumentSimilarityMissingCentroid) {
+  MockSyncPersistence mockPersistence;
+  MockCentroidMetadataDb metadataDb;
+  auto worker = makeWorker(mockPersistence, metadataDb);
+  vector<ScoredWord> words {
+    ScoredWord("dog", 3, 5.8)
+  };
+  auto document = make_shared<ProcessedDocument>("doc-1", words, 5.8);
+  mockPersistence.addUniqueCentroid("centroid-1", new Centroid ("centroid-1",
+              unordered_map<string, double>{{"cat", 1.2}, {"dog", 9.5}, {"fish", 0.8}},
+              mag3(1.2, 9.5, 0.8)));
+  worker->reloadCentroid("centroid-1").get();
+
+  auto centroidIds = make_shared<vector<string>>(
+    vector<string> {"centroid-1", "other-centroid"}
+  );
+  auto result = worker->multiGetDocumentSimilarity(centroidIds, document).get();
+  EXPECT_TRUE(result.hasException<ECentroidDoesNotExist>());
+}
+
+TEST(SimilarityScoreWorker, TestGetBestMatchingCentroids) {
+  MockSyncPersistence mockPersistence;
+  MockCentroidMetadataDb metadataDb;
+  auto worker = makeWorker(mockPersistence, metadataDb);
+  vector<ScoredWord> words {
+    ScoredWord("dog", 3, 5.8),
+    ScoredWord("fox", 3, 4.1)
+  };
+  auto document = make_shared<ProcessedDocument>(
+    "doc-1", words, mag3(5.8, 4.1, 0.0)
+  );
+  mockPersistence.addUniqueCentroid("centroid-1", new Centroid ("centroid-1",
+              unordered_map<string, double>{{"cat", 1.2}, {"dog", 9.5}, {"fish", 0.8}},
+              mag3(1.2, 9.5, 0.8)));
+  mockPersistence.addUniqueCentroid("centroid-2", new Centroid ("centroid-2",
+              unordered_map<string, double>{{"fox", 2.2}, {"dog", 1.5}, {"bird", 0.3}},
+              mag3(2.2, 1.5, 0.3)));
+  mockPersistence.addUniqueCentroid("centroid-3", new Centroid ("centroid-3",
+              unordered_map<string, double>{{"whale", 2.2}},
+              2.2));
+  worker->reloadCentroid("centroid-1").get();
+  worker->reloadCentroid("centroid-2").get();
+  worker->reloadCentroid("centroid-3").get();
+
+  auto expected1 = worker->getDocumentSimilarity("centroid-1", document).get().value();
+  auto expected2 = worker->getDocumentSimilarity("centroid-2", document).get().value();
+  auto best = worker->getBestMatchingCentroids(document, 2).get();
+  EXPECT_EQ(2, best->size());
+  auto first = expected1 > expected2 ? "centroid-1" : "centroid-2";
+  auto second = expected1 > expected2 ? "centroid-2" : "centroid-1";
+  EXPECT_EQ(first, best->at(0).first);
+  EXPECT_EQ(second, best->at(1).first);
+  EXPECT_NEAR(max(expected1, expected2), best->at(0).second, 1e-12);
+}
+
+TEST(SimilarityScoreWorker, TestMultiGetDocumentSimilarityBatch) {
+  MockSyncPersistence mockPersistence;
+  MockCentroidMetadataDb metadataDb;
+  auto worker = makeWorker(mockPersistence, metadataDb);
+  mockPersistence.addUniqueCentroid("centroid-1", new Centroid ("centroid-1",
+              unordered_map<string, double>{{"cat", 1.2}, {"dog", 9.5}, {"fish", 0.8}},
+              mag3(1.2, 9.5, 0.8)));
+  mockPersistence.addUniqueCentroid("centroid-2", new Centroid ("centroid-2",
+              unordered_map<string, double>{{"fox", 2.2}, {"dog", 1.5}, {"bird", 0.3}},
+              mag3(2.2, 1.5, 0.3)));
+  worker->reloadCentroid("centroid-1").get();
+  worker->reloadCentroid("centroid-2").get();
+
+  // enough documents to span several chunks.
+  auto docs = make_shared<vector<shared_ptr<ProcessedDocument>>>();
+  for (size_t i = 0; i < 150; i++) {
+    vector<ScoredWord> words {
+      ScoredWord("dog", 3, 1.0 + i),
+      ScoredWord("fox", 3, 4.1)
+    };
+    docs->push_back(make_shared<ProcessedDocument>(
+      "doc", words, mag3(1.0 + i, 4.1, 0.0)
+    ));
+  }
+  auto centroidIds = make_shared<vector<string>>(
+    vector<string> {"centroid-1", "centroid-2"}
+  );
+  auto result = worker->multiGetDocumentSimilarityBatch(centroidIds, docs).get();
+  EXPECT_FALSE(result.hasException());
+  auto &rows = *result.value();
+  EXPECT_EQ(docs->size(), rows.size());
+  for (size_t i = 0; i < rows.size(); i++) {
+    auto expected = worker->getDocumentSimilarity("centroid-2", docs->at(i)).get();
+    EXPECT_DOUBLE_EQ(expected.value(), rows[i]["centroid-2"]);
+  }
+}
+
+TEST(SimilarityScoreWorker, TestMultiGetDocumentSimilarityBatchMissingCentroid) {
+  MockSyncPersistence mockPersistence;
+  MockCentroidMetadataDb metadataDb;
+  auto worker = makeWorker(mockPersistence, metadataDb);
+  auto docs = make_shared<vector<shared_ptr<ProcessedDocument>>>();
+  vector<ScoredWord> words {ScoredWord("dog", 3, 5.8)};
+  docs->push_back(make_shared<ProcessedDocument>("doc-1", words, 5.8));
+  auto centroidIds = make_shared<vector<string>>(
+    vector<string> {"other-centroid"}
+  );
+  auto result = worker->multiGetDocumentSimilarityBatch(centroidIds, docs).get();
+  EXPECT_TRUE(result.hasException<ECentroidDoesNotExist>());
+}
@@ -0,0 +1,137 @@
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <glog/logging.h>
+#include "stemmer/CachingStemmer.h"
+#include "stemmer/StemmerIf.h"
+#include "text_util/fnv.h"
+
+using namespace std;
+using relevanced::text_util::fnv1a64;
+
+namespace relevanced {
+namespace stemmer {
+
+const size_t CachingStemmer::kMaxCachedLength;
+const uint32_t CachingStemmer::kEmptySlot;
+
+CachingStemmer::CachingStemmer(unique_ptr<StemmerIf> stemmer, size_t capacity)
+  : stemmer_(std::move(stemmer)), capacity_(capacity) {
+  DCHECK(capacity_ > 0);
+  entries_.reserve(capacity_);
+
+  // keep the index at most half full so probe runs stay short.
+  size_t indexSize = 1;
+  while (indexSize < capacity_ * 2) {
+    indexSize *= 2;
+  }
+  index_.assign(indexSize, kEmptySlot);
+  indexMask_ = indexSize - 1;
+}
+
+size_t CachingStemmer::findSlot(const char *word, size_t length,
+                                uint64_t hash) {
+  size_t slot = hash & indexMask_;
+  for (;;) {
+    uint32_t entryIndex = index_[slot];
+    if (entryIndex == kEmptySlot) {
+      return slot;
+    }
+    auto &entry = entries_[entryIndex];
+    if (entry.hash == hash && entry.length == length &&
+        memcmp(entry.word, word, length) == 0) {
+      return slot;
+    }
+    slot = (slot + 1) & indexMask_;
+  }
+}
+
+void CachingStemmer::removeFromIndex(uint32_t entryIndex) {
+  auto &entry = entries_[entryIndex];
+  size_t hole = findSlot(entry.word, entry.length, entry.hash);
+  DCHECK(index_[hole] == entryIndex);
+
+  // backward-shift deletion: pull later members of the probe run
+  // into the hole unless that would move them before their home slot.
+  size_t current = hole;
+  for (;;) {
+    current = (current + 1) & indexMask_;
+    uint32_t candidate = index_[current];
+    if (candidate == kEmptySlot) {
+      break;
+    }
+    size_t home = entries_[candidate].hash & indexMask_;
+    size_t fromHome = (current - home) & indexMask_;
+    size_t fromHole = (current - hole) & indexMask_;
+    if (fromHome >= fromHole) {
+      index_[hole] = candidate;
+      hole = current;
+    }
+  }
+  index_[hole] = kEmptySlot;
+}
+
+uint32_t CachingStemmer::evict() {
+  for (;;) {
+    auto &entry = entries_[hand_];
+    size_t current = hand_;
+    hand_ = (hand_ + 1) % capacity_;
+    if (entry.referenced) {
+      entry.referenced = false;
+      continue;
+    }
+    removeFromIndex((uint32_t) current);
+    return (uint32_t) current;
+  }
+}
+
+void CachingStemmer::insert(const char *word, size_t length, uint64_t hash,
+                            size_t stemLength) {
+  uint32_t entryIndex;
+  if (entries_.size() < capacity_) {
+    entryIndex = (uint32_t) entries_.size();
+    entries_.emplace_back();
+  } else {
+    entryIndex = evict();
+  }
+  auto &entry = entries_[entryIndex];
+  entry.hash = hash;
+  memcpy(entry.word, word, length);
+  entry.length = (uint8_t) length;
+  entry.stemLength = (uint8_t) stemLength;
+  entry.referenced = false;
+  index_[findSlot(word, length, hash)] = entryIndex;
+}
+
+size_t CachingStemmer::getStemPos(const char *base, size_t length) {
+  if (length > kMaxCachedLength) {
+    misses_.store(misses_.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    return stemmer_->getStemPos(base, length);
+  }
+  uint64_t hash = fnv1a64(base, length);
+  size_t slot = findSlot(base, length, hash);
+  if (index_[slot] != kEmptySlot) {
+    auto &entry = entries_[index_[slot]];
+    entry.referenced = true;
+    hits_.store(hits_.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    return entry.stemLength;
+  }
+  misses_.store(misses_.load(memory_order_relaxed) + 1, memory_order_relaxed);
+  size_t stemLength = stemmer_->getStemPos(base, length);
+  insert(base, length, hash, stemLength);
+  return stemLength;
+}
+
+StemCacheStats CachingStemmer::getStats() const {
+  StemCacheStats stats;
+  stats.hits = hits_.load(memory_order_relaxed);
+  stats.misses = misses_.load(memory_order_relaxed);
+  return stats;
+}
+
+size_t CachingStemmer::size() const {
+  return entries_.size();
+}
+
+} // stemmer
+} // relevanced
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "stemmer/StemmerIf.h"
+
+namespace relevanced {
+namespace stemmer {
+
+/**
+ * Bounded cache in front of another stemmer.
+ *
+ * Token frequency is heavily skewed, so a few thousand entries
+ * absorb most calls into snowball.  Eviction is CLOCK: a hit sets
+ * the entry's reference bit, and the hand clears bits until it
+ * finds an entry that hasn't been touched since its last pass.
+ *
+ * Not thread safe; `ThreadSafeStemmerManager` keeps one per thread
+ * and language.  `getStats()` may be called from any thread.
+ */
+class CachingStemmer: public StemmerIf {
+ public:
+  static const size_t kMaxCachedLength = 32;
+
+ protected:
+  struct Entry {
+    uint64_t hash;
+    char word[kMaxCachedLength];
+    uint8_t length;
+    uint8_t stemLength;
+    bool referenced;
+  };
+  static const uint32_t kEmptySlot = UINT32_MAX;
+
+  std::unique_ptr<StemmerIf> stemmer_;
+  size_t capacity_;
+  std::vector<Entry> entries_;
+
+  // open-addressed (linear probing) map from hash to entry index.
+  std::vector<uint32_t> index_;
+  size_t indexMask_;
+  size_t hand_ {0};
+  std::atomic<uint64_t> hits_ {0};
+  std::atomic<uint64_t> misses_ {0};
+
+  size_t findSlot(const char *word, size_t length, uint64_t hash);
+  void removeFromIndex(uint32_t entryIndex);
+  uint32_t evict();
+  void insert(const char *word, size_t length, uint64_t hash, size_t stemLength);
+
+ public:
+  CachingStemmer(std::unique_ptr<StemmerIf> stemmer, size_t capacity);
+  size_t getStemPos(const char *base, size_t length) override;
+  StemCacheStats getStats() const;
+  size_t size() const;
+};
+
+} // stemmer
+} // relevanced
@@ -1,9 +1,15 @@
 #pragma once
+#include <cstdint>
 #include <string>
 
 namespace relevanced {
 namespace stemmer {
 
+struct StemCacheStats {
+  uint64_t hits {0};
+  uint64_t misses {0};
+};
+
 class StemmerIf {
  public:
   virtual size_t getStemPos(const char *base, size_t length) = 0;
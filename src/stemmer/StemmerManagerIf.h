@@ -9,6 +9,9 @@ namespace stemmer {
 class StemmerManagerIf {
 public:
   virtual std::shared_ptr<StemmerIf> getStemmer(thrift_protocol::Language) = 0;
+
+  // hits and misses of any stem caches the manager keeps.
+  virtual StemCacheStats getCacheStats() = 0;
   virtual ~StemmerManagerIf() = default;
 };
 
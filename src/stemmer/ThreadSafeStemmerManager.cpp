@@ -1,8 +1,10 @@
 #include <memory>
 #include <map>
+#include <mutex>
 #include <folly/ThreadLocal.h>
 #include "gen-cpp2/RelevancedProtocol_types.h"
 #include "stemmer/StemmerIf.h"
+#include "stemmer/CachingStemmer.h"
 #include "stemmer/Utf8Stemmer.h"
 
 #include "stemmer/ThreadSafeStemmerManager.h"
@@ -12,18 +14,37 @@ using relevanced::thrift_protocol::Language;
 namespace relevanced {
 namespace stemmer {
 
+const size_t ThreadSafeStemmerManager::kDefaultCacheCapacity;
+
+ThreadSafeStemmerManager::ThreadSafeStemmerManager(size_t cacheCapacity)
+  : cacheCapacity_(cacheCapacity) {}
+
 shared_ptr<StemmerIf> ThreadSafeStemmerManager::getStemmer(Language lang) {
-  auto found = stemmers_->find(lang);
-  if (found != stemmers_->end()) {
+  auto &local = *stemmers_;
+  lock_guard<mutex> lock(local.mutex);
+  auto found = local.stemmers.find(lang);
+  if (found != local.stemmers.end()) {
     return found->second;
   }
-  std::shared_ptr<StemmerIf> created(
-    new Utf8Stemmer(lang)
-  );
-  stemmers_->insert(make_pair(lang, created));
+  std::shared_ptr<CachingStemmer> created(new CachingStemmer(
+    unique_ptr<StemmerIf>(new Utf8Stemmer(lang)), cacheCapacity_
+  ));
+  local.stemmers.insert(make_pair(lang, created));
   return created;
 }
 
-}
+StemCacheStats ThreadSafeStemmerManager::getCacheStats() {
+  StemCacheStats total;
+  for (auto &local : stemmers_.accessAllThreads()) {
+    lock_guard<mutex> lock(local.mutex);
+    for (auto &elem : local.stemmers) {
+      auto stats = elem.second->getStats();
+      total.hits += stats.hits;
+      total.misses += stats.misses;
+    }
+  }
+  return total;
 }
 
+}
+}
@@ -2,9 +2,11 @@
 
 #include "stemmer/StemmerManagerIf.h"
 #include "stemmer/StemmerIf.h"
+#include "stemmer/CachingStemmer.h"
 
 #include <memory>
 #include <map>
+#include <mutex>
 #include <folly/ThreadLocal.h>
 #include "gen-cpp2/RelevancedProtocol_types.h"
 
@@ -13,11 +15,22 @@ namespace stemmer {
 
 class ThreadSafeStemmerManager: public StemmerManagerIf {
 protected:
-  folly::ThreadLocal<std::map<thrift_protocol::Language, std::shared_ptr<StemmerIf>>> stemmers_;
+  struct ThreadStemmers {
+    // only contended while `getCacheStats()` is reading.
+    std::mutex mutex;
+    std::map<thrift_protocol::Language, std::shared_ptr<CachingStemmer>> stemmers;
+  };
+  struct ThreadStemmersTag {};
+  folly::ThreadLocal<ThreadStemmers, ThreadStemmersTag> stemmers_;
+  size_t cacheCapacity_;
 public:
+  static const size_t kDefaultCacheCapacity = 4096;
+  ThreadSafeStemmerManager(size_t cacheCapacity = kDefaultCacheCapacity);
   std::shared_ptr<StemmerIf> getStemmer(thrift_protocol::Language lang) override;
+
+  // summed over the stem caches of all live threads.
+  StemCacheStats getCacheStats() override;
 };
 
 }
 }
-
@@ -0,0 +1,105 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "stemmer/CachingStemmer.h"
+#include "stemmer/StemmerIf.h"
+using namespace std;
+using namespace relevanced::stemmer;
+
+class CountingStemmer: public StemmerIf {
+ public:
+  size_t &calls;
+  CountingStemmer(size_t &calls): calls(calls) {}
+
+  // strips a trailing "s", then anything after the fifth byte.
+  size_t getStemPos(const char *base, size_t length) override {
+    calls++;
+    if (length > 0 && base[length - 1] == 's') {
+      length--;
+    }
+    return length > 5 ? 5 : length;
+  }
+};
+
+TEST(TestCachingStemmer, HitsAndMisses) {
+  size_t calls = 0;
+  CachingStemmer stemmer(
+    unique_ptr<StemmerIf>(new CountingStemmer(calls)), 16
+  );
+  string cats = "cats";
+  string elephants = "elephants";
+  EXPECT_EQ(3, stemmer.getStemPos(cats.c_str(), cats.size()));
+  EXPECT_EQ(5, stemmer.getStemPos(elephants.c_str(), elephants.size()));
+  EXPECT_EQ(3, stemmer.getStemPos(cats.c_str(), cats.size()));
+  EXPECT_EQ(3, stemmer.getStemPos(cats.c_str(), cats.size()));
+  EXPECT_EQ(2, calls);
+  auto stats = stemmer.getStats();
+  EXPECT_EQ(2, stats.hits);
+  EXPECT_EQ(2, stats.misses);
+}
+
+TEST(TestCachingStemmer, KeyedByLength) {
+  size_t calls = 0;
+  CachingStemmer stemmer(
+    unique_ptr<StemmerIf>(new CountingStemmer(calls)), 16
+  );
+  string text = "dogs";
+  EXPECT_EQ(3, stemmer.getStemPos(text.c_str(), 4));
+  EXPECT_EQ(3, stemmer.getStemPos(text.c_str(), 3));
+  EXPECT_EQ(2, calls);
+}
+
+TEST(TestCachingStemmer, LongWordsBypassCache) {
+  size_t calls = 0;
+  CachingStemmer stemmer(
+    unique_ptr<StemmerIf>(new CountingStemmer(calls)), 16
+  );
+  string text(CachingStemmer::kMaxCachedLength + 1, 'x');
+  stemmer.getStemPos(text.c_str(), text.size());
+  stemmer.getStemPos(text.c_str(), text.size());
+  EXPECT_EQ(2, calls);
+  EXPECT_EQ(0, stemmer.size());
+}
+
+TEST(TestCachingStemmer, ClockKeepsReferencedEntries) {
+  size_t calls = 0;
+  CachingStemmer stemmer(
+    unique_ptr<StemmerIf>(new CountingStemmer(calls)), 4
+  );
+  vector<string> words {"aaa", "bbb", "ccc", "ddd"};
+  for (auto &word : words) {
+    stemmer.getStemPos(word.c_str(), word.size());
+  }
+  EXPECT_EQ(4, stemmer.size());
+
+  // "aaa" is referenced, so "bbb" is the first entry evicted.
+  stemmer.getStemPos(words[0].c_str(), 3);
+  string eee = "eee";
+  stemmer.getStemPos(eee.c_str(), 3);
+  EXPECT_EQ(5, calls);
+  EXPECT_EQ(4, stemmer.size());
+
+  stemmer.getStemPos(words[0].c_str(), 3);
+  EXPECT_EQ(5, calls);
+  stemmer.getStemPos(words[1].c_str(), 3);
+  EXPECT_EQ(6, calls);
+}
+
+TEST(TestCachingStemmer, ManyWordsThroughSmallCache) {
+  size_t calls = 0;
+  CachingStemmer stemmer(
+    unique_ptr<StemmerIf>(new CountingStemmer(calls)), 8
+  );
+  CountingStemmer reference(calls);
+  for (size_t round = 0; round < 3; round++) {
+    for (size_t i = 0; i < 500; i++) {
+      string word = "word" + to_string(i % 37) + (i % 2 ? "s" : "");
+      size_t expected = reference.getStemPos(word.c_str(), word.size());
+      EXPECT_EQ(expected, stemmer.getStemPos(word.c_str(), word.size()));
+    }
+  }
+  EXPECT_EQ(8, stemmer.size());
+  auto stats = stemmer.getStats();
+  EXPECT_EQ(1500, stats.hits + stats.misses);
+}
@@ -8,24 +8,37 @@
 #include "stopwords/russian_stopwords.h"
 #include "stopwords/spanish_stopwords.h"
 #include "stopwords/StopwordFilter.h"
+#include "text_util/fnv.h"
+#include "text_util/StringView.h"
 
 using namespace std;
 using relevanced::thrift_protocol::Language;
+using relevanced::text_util::StringView;
+using relevanced::text_util::fnv1a64;
 namespace relevanced {
 namespace stopwords {
 
 bool StopwordFilter::isStopword(const string &word, Language lang) {
-  if (word.size() <= 2) {
+  return isStopword(
+    StringView(word.data(), word.size()),
+    fnv1a64(word.data(), word.size()),
+    lang
+  );
+}
+
+bool StopwordFilter::isStopword(const StringView &word, uint64_t hash,
+                                Language lang) {
+  if (word.len <= 2) {
     return true;
   }
   switch (lang) {
-    case Language::DE : return isGermanStopword(word);
-    case Language::EN : return isEnglishStopword(word);
-    case Language::ES : return isSpanishStopword(word);
-    case Language::FR : return isFrenchStopword(word);
-    case Language::IT : return isItalianStopword(word);
-    case Language::RU : return isRussianStopword(word);
-    default           : return isEnglishStopword(word);
+    case Language::DE : return isGermanStopword(word, hash);
+    case Language::EN : return isEnglishStopword(word, hash);
+    case Language::ES : return isSpanishStopword(word, hash);
+    case Language::FR : return isFrenchStopword(word, hash);
+    case Language::IT : return isItalianStopword(word, hash);
+    case Language::RU : return isRussianStopword(word, hash);
+    default           : return isEnglishStopword(word, hash);
   }
 }
 
@@ -1,5 +1,7 @@
 #pragma once
+#include <cstdint>
 #include <string>
+#include "text_util/StringView.h"
 #include "gen-cpp2/RelevancedProtocol_types.h"
 namespace relevanced {
 namespace stopwords {
@@ -17,6 +19,18 @@ class StopwordFilterIf {
     const std::string &stemmedWord,
     thrift_protocol::Language language
   ) = 0;
+
+  // `hash` is the token's `text_util::fnv1a64`, which the
+  // tokenizer has already computed.
+  virtual bool isStopword(
+    const text_util::StringView &stemmedWord,
+    uint64_t hash,
+    thrift_protocol::Language language
+  ) {
+    return isStopword(
+      std::string(stemmedWord.base, stemmedWord.len), language
+    );
+  }
 };
 
 class StopwordFilter : public StopwordFilterIf {
@@ -25,6 +39,11 @@ class StopwordFilter : public StopwordFilterIf {
     const std::string &stemmedWord,
     thrift_protocol::Language language
   ) override;
+  bool isStopword(
+    const text_util::StringView &stemmedWord,
+    uint64_t hash,
+    thrift_protocol::Language language
+  ) override;
 };
 
 } // stopwords
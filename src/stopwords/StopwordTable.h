@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include "text_util/StringView.h"
+
+namespace relevanced {
+namespace stopwords {
+
+struct StopwordEntry {
+  uint64_t hash;
+  const char *word;
+  uint32_t len;
+};
+
+inline uint32_t stopwordSlot(uint64_t hash, uint32_t displacement,
+                             uint32_t slotBits) {
+  uint64_t mixed = hash ^ (((uint64_t) displacement) * 0x9E3779B97F4A7C15ULL);
+  mixed *= 0xFF51AFD7ED558CCDULL;
+  return (uint32_t) (mixed >> (64 - slotBits));
+}
+
+/**
+ * Perfect hash table over one language's stopwords, generated
+ * by `scripts/dump_nltk_stopwords.py`.
+ *
+ * Words are keyed by their `fnv1a64` hash, which the tokenizer
+ * has already computed.  The hash picks a bucket, the bucket's
+ * displacement picks a slot, and the slot either holds this word
+ * or no word at all: one probe, no allocation.
+ */
+struct StopwordTable {
+  const uint16_t *displacements;
+  uint32_t bucketMask;
+  const StopwordEntry *entries;
+  uint32_t slotBits;
+
+  bool contains(const text_util::StringView &word, uint64_t hash) const {
+    auto displacement = displacements[(hash >> 40) & bucketMask];
+    auto &entry = entries[stopwordSlot(hash, displacement, slotBits)];
+    return entry.hash == hash && entry.len == word.len
+        && memcmp(entry.word, word.base, word.len) == 0;
+  }
+};
+
+} // stopwords
+} // relevanced
@@ -1,146 +1,288 @@
-#include <unordered_set>
-#include <string>
-#include <vector>
+// generated by scripts/dump_nltk_stopwords.py; do not edit.
 
+#include <cstdint>
 #include "stopwords/english_stopwords.h"
-
-using namespace std;
+#include "stopwords/StopwordTable.h"
+#include "text_util/StringView.h"
 
 namespace relevanced {
 namespace stopwords {
 
-const unordered_set<string> stopwordSet = {
-  "a",
-  "about",
-  "above",
-  "after",
-  "again",
-  "against",
-  "all",
-  "am",
-  "an",
-  "and",
-  "any",
-  "are",
-  "as",
-  "at",
-  "be",
-  "because",
-  "been",
-  "before",
-  "being",
-  "below",
-  "between",
-  "both",
-  "but",
-  "by",
-  "can",
-  "did",
-  "do",
-  "does",
-  "doing",
-  "don",
-  "down",
-  "during",
-  "each",
-  "few",
-  "for",
-  "from",
-  "further",
-  "had",
-  "has",
-  "have",
-  "having",
-  "he",
-  "her",
-  "here",
-  "hers",
-  "herself",
-  "him",
-  "himself",
-  "his",
-  "how",
-  "i",
-  "if",
-  "in",
-  "into",
-  "is",
-  "it",
-  "its",
-  "itself",
-  "just",
-  "me",
-  "more",
-  "most",
-  "my",
-  "myself",
-  "no",
-  "nor",
-  "not",
-  "now",
-  "of",
-  "off",
-  "on",
-  "once",
-  "only",
-  "or",
-  "other",
-  "our",
-  "ours",
-  "ourselves",
-  "out",
-  "over",
-  "own",
-  "s",
-  "same",
-  "she",
-  "should",
-  "so",
-  "some",
-  "such",
-  "t",
-  "than",
-  "that",
-  "the",
-  "their",
-  "theirs",
-  "them",
-  "themselves",
-  "then",
-  "there",
-  "these",
-  "they",
-  "this",
-  "those",
-  "through",
-  "to",
-  "too",
-  "under",
-  "until",
-  "up",
-  "very",
-  "was",
-  "we",
-  "were",
-  "what",
-  "when",
-  "where",
-  "which",
-  "while",
-  "who",
-  "whom",
-  "why",
-  "will",
-  "with",
-  "you",
-  "your",
-  "yours",
-  "yourself",
-  "yourselves"
+namespace {
+
+const uint16_t kDisplacements[32] = {
+  4, 2, 1, 0, 0, 1, 2, 1, 0, 4, 2, 3,
+  0, 0, 0, 1, 4, 0, 1, 1, 1, 5, 5, 36,
+  1, 0, 1, 2, 1, 5, 1, 6,
+};
+
+const StopwordEntry kEntries[256] = {
+  {0, "", 0},
+  {15818348008331620766ULL, "ours", 4},
+  {0, "", 0},
+  {4007477477770853496ULL, "where", 5},
+  {1869439255507851807ULL, "own", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {628906390544363382ULL, "he", 2},
+  {4720678899086369066ULL, "those", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {2241511620741030668ULL, "yourself", 8},
+  {3334851531003596507ULL, "have", 4},
+  {12644979747856758223ULL, "again", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {3149117958293638553ULL, "its", 3},
+  {6829141595499096335ULL, "who", 3},
+  {0, "", 0},
+  {2700408182227667939ULL, "them", 4},
+  {1871134702438174719ULL, "out", 3},
+  {0, "", 0},
+  {14886822876704379938ULL, "which", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {2403462157578442008ULL, "nor", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {6932689201082914001ULL, "some", 4},
+  {620464340264662349ULL, "as", 2},
+  {1871132503414918297ULL, "our", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {631693652521310592ULL, "up", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {9994905844814347912ULL, "during", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {12638201494206808739ULL, "t", 1},
+  {0, "", 0},
+  {0, "", 0},
+  {14255127978042943954ULL, "below", 5},
+  {624134510078873767ULL, "me", 2},
+  {14604964791533733070ULL, "don", 3},
+  {3707360902505730037ULL, "him", 3},
+  {0, "", 0},
+  {9188557619686916277ULL, "from", 4},
+  {15867295736529184464ULL, "does", 4},
+  {16935418553531043207ULL, "their", 5},
+  {0, "", 0},
+  {632818452916781220ULL, "to", 2},
+  {943779698914011890ULL, "most", 4},
+  {11991686087872398057ULL, "with", 4},
+  {2700409281739296150ULL, "then", 4},
+  {11234446932156269327ULL, "what", 4},
+  {13172300041790241374ULL, "such", 4},
+  {3699728092784203075ULL, "has", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {13799593374022494953ULL, "after", 5},
+  {0, "", 0},
+  {17701056135916708259ULL, "into", 4},
+  {11968609537824046989ULL, "will", 4},
+  {17717988973921729989ULL, "can", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {4571440789225184042ULL, "above", 5},
+  {0, "", 0},
+  {624103723753283859ULL, "my", 2},
+  {0, "", 0},
+  {620431354915816019ULL, "am", 2},
+  {0, "", 0},
+  {12228426714503868781ULL, "under", 5},
+  {8789493305340027482ULL, "through", 7},
+  {628038875869894128ULL, "it", 2},
+  {0, "", 0},
+  {6266135566914540924ULL, "the", 3},
+  {4030470807693013603ULL, "ourselves", 9},
+  {11958705164271055210ULL, "should", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {14778551851152030882ULL, "both", 4},
+  {14602970277440536766ULL, "did", 3},
+  {12638206991764949794ULL, "s", 1},
+  {0, "", 0},
+  {15607963802542256830ULL, "before", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {3701720407854142957ULL, "how", 3},
+  {2403467655136583063ULL, "now", 3},
+  {730899674924722773ULL, "other", 5},
+  {0, "", 0},
+  {16930542681612195231ULL, "just", 4},
+  {12431351548139161864ULL, "being", 5},
+  {0, "", 0},
+  {9387096024233451041ULL, "she", 3},
+  {0, "", 0},
+  {16640971154896050852ULL, "all", 3},
+  {14882043299657492846ULL, "while", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {623237308590442816ULL, "be", 2},
+  {620456643683264872ULL, "at", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {6267237277565819121ULL, "too", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {15935806408102493802ULL, "itself", 6},
+  {8499515821999699907ULL, "been", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {628023482707099174ULL, "if", 2},
+  {27336165788644044ULL, "but", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {633691465149391529ULL, "we", 2},
+  {0, "", 0},
+  {11238380984761251385ULL, "when", 4},
+  {8498452662884257092ULL, "doing", 5},
+  {3695795139690849228ULL, "her", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {2704337836786137153ULL, "this", 4},
+  {0, "", 0},
+  {12764932022478934113ULL, "themselves", 10},
+  {6829121804289788537ULL, "why", 3},
+  {0, "", 0},
+  {2700394988088129407ULL, "they", 4},
+  {517310000640576183ULL, "only", 4},
+  {0, "", 0},
+  {617372513566700692ULL, "do", 2},
+  {12638195996648667684ULL, "i", 1},
+  {0, "", 0},
+  {2696750107041366842ULL, "than", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {16642937081686913670ULL, "and", 3},
+  {0, "", 0},
+  {508571082221258180ULL, "once", 4},
+  {6822364205824128306ULL, "was", 3},
+  {2696721519739033356ULL, "that", 4},
+  {1438188964080769615ULL, "between", 7},
+  {0, "", 0},
+  {16736635484504225319ULL, "himself", 7},
+  {626942662776756986ULL, "no", 2},
+  {0, "", 0},
+  {742532965847947307ULL, "here", 4},
+  {11228811935062823302ULL, "whom", 4},
+  {13381326984196347246ULL, "herself", 7},
+  {15853816823481594965ULL, "down", 4},
+  {4535333379147303424ULL, "against", 7},
+  {16929517474623570120ULL, "these", 5},
+  {0, "", 0},
+  {683243228863131483ULL, "same", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {742557155103767949ULL, "hers", 4},
+  {4572301706829884030ULL, "about", 5},
+  {1883801076392705514ULL, "off", 3},
+  {0, "", 0},
+  {13069864042462355804ULL, "you", 3},
+  {3707345509342935083ULL, "his", 3},
+  {623268094916032724ULL, "by", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {2399200755332251048ULL, "each", 4},
+  {0, "", 0},
+  {637603527521809367ULL, "so", 2},
+  {626097138334851952ULL, "on", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {12638187200555641996ULL, "a", 1},
+  {16669731080549489229ULL, "are", 3},
+  {620432454427444230ULL, "an", 2},
+  {0, "", 0},
+  {14025209469941882991ULL, "over", 4},
+  {15908540280042327065ULL, "few", 3},
+  {0, "", 0},
+  {626105934427877640ULL, "of", 2},
+  {10204291617770170939ULL, "yours", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {2552829971265271196ULL, "theirs", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {9503134909063496123ULL, "because", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13027050242084224344ULL, "yourselves", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {944603233123352704ULL, "more", 4},
+  {15224151675360764202ULL, "your", 4},
+  {626092740288339108ULL, "or", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {16928642263367703389ULL, "there", 5},
+  {0, "", 0},
+  {11270473570612684252ULL, "having", 6},
+  {11964592317811630749ULL, "myself", 6},
+  {2291359479729204271ULL, "until", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {4446163296446906764ULL, "were", 4},
+  {628046572451291605ULL, "is", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {14923507080476793257ULL, "further", 7},
+  {628032278800124862ULL, "in", 2},
+  {7439618934287329281ULL, "very", 4},
+  {2403468754648211274ULL, "not", 3},
+  {0, "", 0},
+  {16642968967524131789ULL, "any", 3},
+  {15902905282948881040ULL, "for", 3},
+  {3699715998156292754ULL, "had", 3},
+  {0, "", 0},
+};
+
+} // anonymous namespace
+
+const StopwordTable kEnglishStopwords {
+  kDisplacements, 31, kEntries, 8
 };
 
-bool isEnglishStopword(const string &word) {
-  return stopwordSet.count(word) > 0;
+bool isEnglishStopword(const text_util::StringView &word, uint64_t hash) {
+  return kEnglishStopwords.contains(word, hash);
 }
 
 } // stopwords
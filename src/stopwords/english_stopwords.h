@@ -1,9 +1,12 @@
 #pragma once
+#include <cstdint>
+#include "text_util/StringView.h"
 
 namespace relevanced {
 namespace stopwords {
 
-bool isEnglishStopword(const std::string &word);
+// `hash` is `text_util::fnv1a64` of the word.
+bool isEnglishStopword(const text_util::StringView &word, uint64_t hash);
 
 } // stopwords
 } // relevanced
@@ -1,174 +1,292 @@
-#include <string>
-#include <unordered_set>
-#include "stopwords/french_stopwords.h"
+// generated by scripts/dump_nltk_stopwords.py; do not edit.
 
-using namespace std;
+#include <cstdint>
+#include "stopwords/french_stopwords.h"
+#include "stopwords/StopwordTable.h"
+#include "text_util/StringView.h"
 
 namespace relevanced {
 namespace stopwords {
 
-const unordered_set<string> stopwordSet {
-  "au",
-  "aux",
-  "avec",
-  "ce",
-  "ces",
-  "dans",
-  "de",
-  "des",
-  "du",
-  "elle",
-  "en",
-  "et",
-  "eux",
-  "il",
-  "je",
-  "la",
-  "le",
-  "leur",
-  "lui",
-  "ma",
-  "mais",
-  "me",
-  "m\u00eame",
-  "mes",
-  "moi",
-  "mon",
-  "ne",
-  "nos",
-  "notre",
-  "nous",
-  "on",
-  "ou",
-  "par",
-  "pas",
-  "pour",
-  "qu",
-  "que",
-  "qui",
-  "sa",
-  "se",
-  "ses",
-  "son",
-  "sur",
-  "ta",
-  "te",
-  "tes",
-  "toi",
-  "ton",
-  "tu",
-  "un",
-  "une",
-  "vos",
-  "votre",
-  "vous",
-  "c",
-  "d",
-  "j",
-  "l",
-  "\u00e0",
-  "m",
-  "n",
-  "s",
-  "t",
-  "y",
-  "\u00e9t\u00e9",
-  "\u00e9t\u00e9e",
-  "\u00e9t\u00e9es",
-  "\u00e9t\u00e9s",
-  "\u00e9tant",
-  "\u00e9tante",
-  "\u00e9tants",
-  "\u00e9tantes",
-  "suis",
-  "es",
-  "est",
-  "sommes",
-  "\u00eates",
-  "sont",
-  "serai",
-  "seras",
-  "sera",
-  "serons",
-  "serez",
-  "seront",
-  "serais",
-  "serait",
-  "serions",
-  "seriez",
-  "seraient",
-  "\u00e9tais",
-  "\u00e9tait",
-  "\u00e9tions",
-  "\u00e9tiez",
-  "\u00e9taient",
-  "fus",
-  "fut",
-  "f\u00fbmes",
-  "f\u00fbtes",
-  "furent",
-  "sois",
-  "soit",
-  "soyons",
-  "soyez",
-  "soient",
-  "fusse",
-  "fusses",
-  "f\u00fbt",
-  "fussions",
-  "fussiez",
-  "fussent",
-  "ayant",
-  "ayante",
-  "ayantes",
-  "ayants",
-  "eu",
-  "eue",
-  "eues",
-  "eus",
-  "ai",
-  "as",
-  "avons",
-  "avez",
-  "ont",
-  "aurai",
-  "auras",
-  "aura",
-  "aurons",
-  "aurez",
-  "auront",
-  "aurais",
-  "aurait",
-  "aurions",
-  "auriez",
-  "auraient",
-  "avais",
-  "avait",
-  "avions",
-  "aviez",
-  "avaient",
-  "eut",
-  "e\u00fbmes",
-  "e\u00fbtes",
-  "eurent",
-  "aie",
-  "aies",
-  "ait",
-  "ayons",
-  "ayez",
-  "aient",
-  "eusse",
-  "eusses",
-  "e\u00fbt",
-  "eussions",
-  "eussiez",
-  "eussent"
+namespace {
+
+const uint16_t kDisplacements[64] = {
+  1, 3, 0, 0, 0, 0, 2, 4, 1, 0, 0, 5,
+  0, 0, 0, 2, 2, 0, 4, 0, 1, 1, 5, 10,
+  0, 4, 2, 3, 0, 4, 1, 0, 0, 0, 0, 0,
+  1, 0, 2, 4, 0, 1, 1, 1, 2, 4, 12, 8,
+  0, 0, 8, 2, 0, 1, 1, 2, 0, 1, 3, 3,
+  12, 2, 5, 0,
+};
+
+const StopwordEntry kEntries[256] = {
+  {0, "", 0},
+  {2453698944355076254ULL, "serez", 5},
+  {3263128516529430620ULL, "sera", 4},
+  {0, "", 0},
+  {2403463257090070219ULL, "nos", 3},
+  {632829448033063330ULL, "tu", 2},
+  {631726637870156922ULL, "un", 2},
+  {637592532405527257ULL, "sa", 2},
+  {584709396303009852ULL, "mes", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {625229623660382698ULL, "le", 2},
+  {9399449037373941701ULL, "sur", 3},
+  {0, "", 0},
+  {4948674375197206828ULL, "seraient", 8},
+  {0, "", 0},
+  {9630221469147572193ULL, "dans", 4},
+  {0, "", 0},
+  {14760938125891619103ULL, "furent", 6},
+  {6267236178054190910ULL, "ton", 3},
+  {622150991101959573ULL, "ce", 2},
+  {0, "", 0},
+  {12638192698113783051ULL, "l", 1},
+  {624130112032360923ULL, "ma", 2},
+  {0, "", 0},
+  {960877802852775981ULL, "fussions", 8},
+  {0, "", 0},
+  {10812379693707525650ULL, "fusses", 6},
+  {8113001741006212614ULL, "qui", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {626097138334851952ULL, "on", 2},
+  {3905457350252911119ULL, "aurons", 6},
+  {0, "", 0},
+  {14880706122398321591ULL, "eues", 4},
+  {8324357903919055195ULL, "ayons", 5},
+  {0, "", 0},
+  {16664916319130499385ULL, "aux", 3},
+  {15893345029343478645ULL, "fus", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {8113014935145751146ULL, "que", 3},
+  {10103525655994676775ULL, "pour", 4},
+  {0, "", 0},
+  {15659012136021899694ULL, "aviez", 5},
+  {1462774708359557891ULL, "m\u00eame", 5},
+  {12727523857087206823ULL, "aies", 4},
+  {16645789214849925329ULL, "ait", 3},
+  {7592200103017041747ULL, "aurait", 6},
+  {17634950883939893450ULL, "serions", 7},
+  {620457743194893083ULL, "au", 2},
+  {12638189399578898418ULL, "c", 1},
+  {7592205600575182802ULL, "aurais", 6},
+  {0, "", 0},
+  {4322344838396301642ULL, "nous", 4},
+  {3905454051718026486ULL, "auront", 6},
+  {15893337332762081168ULL, "fut", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {626091640776710897ULL, "ou", 2},
+  {632807457800499110ULL, "ta", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {637596930452040101ULL, "se", 2},
+  {0, "", 0},
+  {17538549584950801733ULL, "sommes", 6},
+  {624134510078873767ULL, "me", 2},
+  {12050796503729082236ULL, "avons", 5},
+  {6751561613535865342ULL, "aura", 4},
+  {3884693007770859358ULL, "\u00e9tais", 6},
+  {6267239476589075543ULL, "toi", 3},
+  {3182514923509115244ULL, "\u00e9tantes", 8},
+  {18193506966746999226ULL, "eussent", 7},
+  {0, "", 0},
+  {3314225517770697621ULL, "aurai", 5},
+  {1831918420147954668ULL, "ayantes", 7},
+  {14053487142368699294ULL, "eue", 3},
+  {16825543225917410926ULL, "\u00e9taient", 8},
+  {625225225613869854ULL, "la", 2},
+  {5058137473782448791ULL, "\u00e9tante", 7},
+  {6936364868455266474ULL, "soit", 4},
+  {8303147257715507613ULL, "e\u00fbmes", 6},
+  {626931667660474876ULL, "ne", 2},
+  {9008913975190761200ULL, "soyons", 6},
+  {472209999062753025ULL, "serait", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {14853352616598452159ULL, "votre", 5},
+  {3884696306305743991ULL, "\u00e9tait", 6},
+  {0, "", 0},
+  {14599024130207644387ULL, "des", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {2602702097418773305ULL, "auriez", 6},
+  {12638199295183552317ULL, "j", 1},
+  {0, "", 0},
+  {616491804752692906ULL, "en", 2},
+  {0, "", 0},
+  {4332884496259142793ULL, "serons", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {3314214522654415511ULL, "auras", 5},
+  {16645805707524348494ULL, "aie", 3},
+  {0, "", 0},
+  {12638194897137039473ULL, "n", 1},
+  {0, "", 0},
+  {0, "", 0},
+  {12638213588834719060ULL, "y", 1},
+  {5058152866945243745ULL, "\u00e9tants", 7},
+  {0, "", 0},
+  {14053506933578007092ULL, "eus", 3},
+  {0, "", 0},
+  {10912521471358983073ULL, "f\u00fbt", 4},
+  {3589339841203186306ULL, "fussiez", 7},
+  {14891650662535860005ULL, "soyez", 5},
+  {616498401822462172ULL, "et", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {578821511535075297ULL, "mon", 3},
+  {0, "", 0},
+  {7267839497442353489ULL, "avez", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {472211098574381236ULL, "serais", 6},
+  {6261330701100204979ULL, "tes", 3},
+  {9389900878396449627ULL, "son", 3},
+  {1620449903687156173ULL, "f\u00fbtes", 6},
+  {14051531111182490375ULL, "est", 3},
+  {617365916496931426ULL, "de", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {94140162205281832ULL, "\u00e9tions", 7},
+  {17721941718224391634ULL, "ces", 3},
+  {6931581992873494749ULL, "sont", 4},
+  {3318136480631487248ULL, "aurez", 5},
+  {0, "", 0},
+  {13526921786884103414ULL, "\u00e9t\u00e9e", 6},
+  {7565212953353069843ULL, "vos", 3},
+  {620464340264662349ULL, "as", 2},
+  {1344756704717021801ULL, "lui", 3},
+  {8631828292866326184ULL, "par", 3},
+  {0, "", 0},
+  {14053505834066378881ULL, "eut", 3},
+  {0, "", 0},
+  {616497302310833961ULL, "es", 2},
+  {18419340195010600378ULL, "eussions", 8},
+  {14053501436019866037ULL, "eux", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {616499501334090383ULL, "eu", 2},
+  {8631829392377954395ULL, "pas", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {2457376810750685149ULL, "seras", 5},
+  {12482794476198158350ULL, "e\u00fbtes", 6},
+  {2662059134085225581ULL, "leur", 4},
+  {6936359370897125419ULL, "sois", 4},
+  {10014116891170993578ULL, "auraient", 8},
+  {775197512160513718ULL, "\u00e0", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13177946033999969509ULL, "suis", 4},
+  {14994274660906962133ULL, "fusse", 5},
+  {12638206991764949794ULL, "s", 1},
+  {3885820007189586408ULL, "\u00e9tant", 6},
+  {617348324310880050ULL, "du", 2},
+  {0, "", 0},
+  {5407937488005587323ULL, "seriez", 6},
+  {0, "", 0},
+  {635657391940254347ULL, "qu", 2},
+  {372487600437523937ULL, "ayants", 6},
+  {0, "", 0},
+  {578822611046703508ULL, "moi", 3},
+  {0, "", 0},
+  {11916822520928696144ULL, "\u00eates", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {7267847194023750966ULL, "avec", 4},
+  {620435752962328863ULL, "ai", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {7058929560038005060ULL, "aurions", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {14503647286707184118ULL, "e\u00fbt", 4},
+  {1034197963213227663ULL, "fussent", 7},
+  {2201791356678065373ULL, "avais", 5},
+  {9149199396154875591ULL, "elle", 4},
+  {1875917578019946444ULL, "ont", 3},
+  {16273493477989579140ULL, "eurent", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {12238502351341382743ULL, "soient", 6},
+  {4144937302588401196ULL, "ayez", 4},
+  {5525270338362513581ULL, "une", 3},
+  {13228352079574617657ULL, "avions", 6},
+  {12638183902020757363ULL, "d", 1},
+  {13526906393721308460ULL, "\u00e9t\u00e9s", 6},
+  {17166119142759602280ULL, "ayant", 5},
+  {2283810883688369660ULL, "aient", 5},
+  {2258924248772371327ULL, "mais", 4},
+  {0, "", 0},
+  {4661039185794590423ULL, "notre", 5},
+  {0, "", 0},
+  {2457383407820454415ULL, "serai", 5},
+  {0, "", 0},
+  {12638201494206808739ULL, "t", 1},
+  {630889909521277576ULL, "je", 2},
+  {4332885595770771004ULL, "seront", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {12638191598602154840ULL, "m", 1},
+  {3544295527157938370ULL, "vous", 4},
+  {0, "", 0},
+  {852003841220771904ULL, "eusse", 5},
+  {12966242618611103231ULL, "\u00e9t\u00e9es", 7},
+  {14782930791217444993ULL, "avaient", 7},
+  {9384248289116952226ULL, "ses", 3},
+  {628030079776868440ULL, "il", 2},
+  {0, "", 0},
+  {2201783660096667896ULL, "avait", 5},
+  {5974272377194469033ULL, "eusses", 6},
+  {632811855847011954ULL, "te", 2},
+  {7281531361229488587ULL, "eussiez", 7},
+  {0, "", 0},
+  {17410894947631771197ULL, "\u00e9tiez", 6},
+  {0, "", 0},
+  {4457144821313469662ULL, "f\u00fbmes", 6},
+  {0, "", 0},
+  {43504438999324759ULL, "\u00e9t\u00e9", 5},
+  {0, "", 0},
+  {372472207274728983ULL, "ayante", 6},
+  {0, "", 0},
 };
 
-bool isFrenchStopword(const string &word) {
-  return stopwordSet.count(word) > 0;
+} // anonymous namespace
+
+const StopwordTable kFrenchStopwords {
+  kDisplacements, 63, kEntries, 8
+};
+
+bool isFrenchStopword(const text_util::StringView &word, uint64_t hash) {
+  return kFrenchStopwords.contains(word, hash);
 }
 
 } // stopwords
 } // relevanced
-
@@ -1,10 +1,12 @@
-#include <string>
+#pragma once
+#include <cstdint>
+#include "text_util/StringView.h"
 
 namespace relevanced {
 namespace stopwords {
 
-bool isFrenchStopword(const std::string &word);
+// `hash` is `text_util::fnv1a64` of the word.
+bool isFrenchStopword(const text_util::StringView &word, uint64_t hash);
 
 } // stopwords
 } // relevanced
-
@@ -1,250 +1,548 @@
-#include <string>
-#include <unordered_set>
-#include "stopwords/german_stopwords.h"
+// generated by scripts/dump_nltk_stopwords.py; do not edit.
 
-using namespace std;
+#include <cstdint>
+#include "stopwords/german_stopwords.h"
+#include "stopwords/StopwordTable.h"
+#include "text_util/StringView.h"
 
 namespace relevanced {
 namespace stopwords {
 
-const unordered_set<string> stopwordSet {
-  "aber",
-  "alle",
-  "allem",
-  "allen",
-  "aller",
-  "alles",
-  "als",
-  "also",
-  "am",
-  "an",
-  "ander",
-  "andere",
-  "anderem",
-  "anderen",
-  "anderer",
-  "anderes",
-  "anderm",
-  "andern",
-  "anderr",
-  "anders",
-  "auch",
-  "auf",
-  "aus",
-  "bei",
-  "bin",
-  "bis",
-  "bist",
-  "da",
-  "damit",
-  "dann",
-  "der",
-  "den",
-  "des",
-  "dem",
-  "die",
-  "das",
-  "da\u00df",
-  "derselbe",
-  "derselben",
-  "denselben",
-  "desselben",
-  "demselben",
-  "dieselbe",
-  "dieselben",
-  "dasselbe",
-  "dazu",
-  "dein",
-  "deine",
-  "deinem",
-  "deinen",
-  "deiner",
-  "deines",
-  "denn",
-  "derer",
-  "dessen",
-  "dich",
-  "dir",
-  "du",
-  "dies",
-  "diese",
-  "diesem",
-  "diesen",
-  "dieser",
-  "dieses",
-  "doch",
-  "dort",
-  "durch",
-  "ein",
-  "eine",
-  "einem",
-  "einen",
-  "einer",
-  "eines",
-  "einig",
-  "einige",
-  "einigem",
-  "einigen",
-  "einiger",
-  "einiges",
-  "einmal",
-  "er",
-  "ihn",
-  "ihm",
-  "es",
-  "etwas",
-  "euer",
-  "eure",
-  "eurem",
-  "euren",
-  "eurer",
-  "eures",
-  "f\u00fcr",
-  "gegen",
-  "gewesen",
-  "hab",
-  "habe",
-  "haben",
-  "hat",
-  "hatte",
-  "hatten",
-  "hier",
-  "hin",
-  "hinter",
-  "ich",
-  "mich",
-  "mir",
-  "ihr",
-  "ihre",
-  "ihrem",
-  "ihren",
-  "ihrer",
-  "ihres",
-  "euch",
-  "im",
-  "in",
-  "indem",
-  "ins",
-  "ist",
-  "jede",
-  "jedem",
-  "jeden",
-  "jeder",
-  "jedes",
-  "jene",
-  "jenem",
-  "jenen",
-  "jener",
-  "jenes",
-  "jetzt",
-  "kann",
-  "kein",
-  "keine",
-  "keinem",
-  "keinen",
-  "keiner",
-  "keines",
-  "k\u00f6nnen",
-  "k\u00f6nnte",
-  "machen",
-  "man",
-  "manche",
-  "manchem",
-  "manchen",
-  "mancher",
-  "manches",
-  "mein",
-  "meine",
-  "meinem",
-  "meinen",
-  "meiner",
-  "meines",
-  "mit",
-  "muss",
-  "musste",
-  "nach",
-  "nicht",
-  "nichts",
-  "noch",
-  "nun",
-  "nur",
-  "ob",
-  "oder",
-  "ohne",
-  "sehr",
-  "sein",
-  "seine",
-  "seinem",
-  "seinen",
-  "seiner",
-  "seines",
-  "selbst",
-  "sich",
-  "sie",
-  "ihnen",
-  "sind",
-  "so",
-  "solche",
-  "solchem",
-  "solchen",
-  "solcher",
-  "solches",
-  "soll",
-  "sollte",
-  "sondern",
-  "sonst",
-  "\u00fcber",
-  "um",
-  "und",
-  "uns",
-  "unse",
-  "unsem",
-  "unsen",
-  "unser",
-  "unses",
-  "unter",
-  "viel",
-  "vom",
-  "von",
-  "vor",
-  "w\u00e4hrend",
-  "war",
-  "waren",
-  "warst",
-  "was",
-  "weg",
-  "weil",
-  "weiter",
-  "welche",
-  "welchem",
-  "welchen",
-  "welcher",
-  "welches",
-  "wenn",
-  "werde",
-  "werden",
-  "wie",
-  "wieder",
-  "will",
-  "wir",
-  "wird",
-  "wirst",
-  "wo",
-  "wollen",
-  "wollte",
-  "w\u00fcrde",
-  "w\u00fcrden",
-  "zu",
-  "zum",
-  "zur",
-  "zwar",
-  "zwischen"
+namespace {
+
+const uint16_t kDisplacements[64] = {
+  5, 2, 1, 0, 0, 7, 0, 0, 2, 0, 0, 2,
+  0, 0, 1, 5, 2, 1, 5, 2, 1, 1, 1, 2,
+  2, 1, 0, 2, 1, 0, 1, 0, 4, 4, 1, 2,
+  0, 0, 3, 0, 2, 0, 0, 1, 1, 4, 0, 0,
+  4, 7, 0, 0, 2, 0, 0, 0, 0, 1, 1, 2,
+  3, 0, 6, 5,
+};
+
+const StopwordEntry kEntries[512] = {
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {9923157975814116281ULL, "gegen", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {12667822032727906122ULL, "welchem", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {1803581050871344355ULL, "haben", 5},
+  {5633588724900192651ULL, "sind", 4},
+  {4345338898865069530ULL, "jedem", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13953749941364267918ULL, "w\u00fcrde", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {6765902543699783040ULL, "auch", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {1144085288321605190ULL, "zwischen", 8},
+  {10281774177628345277ULL, "seinen", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {23670394020945470ULL, "bin", 3},
+  {6933521531385280503ULL, "soll", 4},
+  {0, "", 0},
+  {4832334512461460460ULL, "mein", 4},
+  {15718113153930324888ULL, "mich", 4},
+  {6830238908103861688ULL, "wie", 3},
+  {0, "", 0},
+  {3155876656270926995ULL, "ist", 3},
+  {485460448087315301ULL, "jener", 5},
+  {16664944906432832871ULL, "auf", 3},
+  {9521654838361155569ULL, "ihren", 5},
+  {14599023030696016176ULL, "der", 3},
+  {0, "", 0},
+  {8820113537392680806ULL, "desselben", 9},
+  {485479139784994888ULL, "jenem", 5},
+  {0, "", 0},
+  {8412662994434842644ULL, "anderm", 6},
+  {3143514847037410647ULL, "ins", 3},
+  {14880705022886693380ULL, "euer", 4},
+  {10663722185295727978ULL, "nichts", 6},
+  {3145452186525939979ULL, "ihm", 3},
+  {3252684255575135806ULL, "sein", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {7220390019014529768ULL, "dieselben", 9},
+  {11950051366072503021ULL, "dein", 4},
+  {7328488404669978094ULL, "eine", 4},
+  {6818700633079686154ULL, "weg", 3},
+  {0, "", 0},
+  {1593603944493357604ULL, "damit", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {8393968345345566597ULL, "keinen", 6},
+  {11319928833442039656ULL, "dasselbe", 8},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {8315901988764022861ULL, "hier", 4},
+  {0, "", 0},
+  {7205952324973412935ULL, "derer", 5},
+  {0, "", 0},
+  {11968609537824046989ULL, "will", 4},
+  {9064749401884170336ULL, "manches", 7},
+  {14180617040359115537ULL, "hatten", 6},
+  {0, "", 0},
+  {631725538358528711ULL, "um", 2},
+  {11946978830096121149ULL, "solche", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {13635389583147747456ULL, "einen", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {10457363763175816956ULL, "wollen", 6},
+  {4345307013027851411ULL, "jeder", 5},
+  {18258084314785211785ULL, "keine", 5},
+  {0, "", 0},
+  {15674804746903903019ULL, "weiter", 6},
+  {0, "", 0},
+  {1402755544572001554ULL, "meinem", 6},
+  {3226416133395587556ULL, "sonst", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {10909689129405279212ULL, "f\u00fcr", 4},
+  {0, "", 0},
+  {617361518450418582ULL, "da", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {13649785267457008189ULL, "zwar", 4},
+  {18322612512802502921ULL, "viel", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {7591335948919072449ULL, "derselbe", 8},
+  {0, "", 0},
+  {1402776435292937563ULL, "meiner", 6},
+  {0, "", 0},
+  {16070286650378819155ULL, "manche", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {15828755628048628091ULL, "einmal", 6},
+  {11777101701041074201ULL, "diese", 5},
+  {0, "", 0},
+  {9521668032500694101ULL, "ihrer", 5},
+  {626110332474390484ULL, "ob", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13237823627378340873ULL, "solchen", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {4345305913516223200ULL, "jedes", 5},
+  {15610877538889659973ULL, "hatte", 5},
+  {0, "", 0},
+  {14106301184401292449ULL, "seine", 5},
+  {7016580279303356137ULL, "gewesen", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {3145453286037568190ULL, "ihn", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {616497302310833961ULL, "es", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13145008554473878413ULL, "muss", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {14559511317508555661ULL, "dich", 4},
+  {0, "", 0},
+  {247150675750292984ULL, "w\u00e4hrend", 8},
+  {14041936772716613439ULL, "ein", 3},
+  {0, "", 0},
+  {6822364205824128306ULL, "was", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {5351385545710980593ULL, "ander", 5},
+  {9064781287721388455ULL, "manchen", 7},
+  {8609156109459536339ULL, "jede", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {7614919271912479175ULL, "allen", 5},
+  {14602971376952164977ULL, "die", 3},
+  {14599024130207644387ULL, "des", 3},
+  {17626984824702070181ULL, "unsem", 5},
+  {0, "", 0},
+  {646071966080587464ULL, "zu", 2},
+  {9064750501395798547ULL, "mancher", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {9568555481811867858ULL, "also", 4},
+  {11997289199128625963ULL, "wird", 4},
+  {0, "", 0},
+  {628031179288496651ULL, "im", 2},
+  {12667824231751162544ULL, "welches", 7},
+  {6744535942370194777ULL, "oder", 4},
+  {16664921816688640440ULL, "aus", 3},
+  {0, "", 0},
+  {13635421468984965575ULL, "eines", 5},
+  {0, "", 0},
+  {7565242640167031540ULL, "von", 3},
+  {0, "", 0},
+  {18170812301749775485ULL, "aber", 4},
+  {17015739269040626229ULL, "diesen", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {620431354915816019ULL, "am", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {18388681481131986670ULL, "einige", 6},
+  {4345337799353441319ULL, "jeden", 5},
+  {3089198130256998148ULL, "demselben", 9},
+  {0, "", 0},
+  {10338185066760531983ULL, "hinter", 6},
+  {7460565348839226819ULL, "machen", 6},
+  {1457037383965315531ULL, "meine", 5},
+  {429459675286435178ULL, "waren", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {16064105244566213651ULL, "bist", 4},
+  {9561789087253181939ULL, "alle", 4},
+  {17626981526167185548ULL, "unsen", 5},
+  {5659592244518179604ULL, "einiger", 7},
+  {14602990068649844564ULL, "dir", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {12799773374248017312ULL, "w\u00fcrden", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {6454156071566941312ULL, "werden", 6},
+  {1459261865421016057ULL, "etwas", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {14882646760421735556ULL, "euch", 4},
+  {17296475105679333427ULL, "dessen", 6},
+  {13737674573472132989ULL, "anderes", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {5659561458192589696ULL, "einigen", 7},
+  {8393989236066502606ULL, "keines", 6},
+  {17627003516399749768ULL, "unser", 5},
+  {4420275295165787844ULL, "weil", 4},
+  {3140672609479052887ULL, "ich", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {17015724975389459486ULL, "dieses", 6},
+  {8412634407132509158ULL, "anders", 6},
+  {10382943473959396547ULL, "wieder", 6},
+  {10443016235942129992ULL, "wollte", 6},
+  {13635392881682632089ULL, "einem", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {10281770879093460644ULL, "seinem", 6},
+  {4427035092654704497ULL, "wenn", 4},
+  {10542201113025807898ULL, "musste", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {18235192363390171997ULL, "derselben", 9},
+  {3246435580163565148ULL, "k\u00f6nnte", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {4093714293399397656ULL, "deine", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {12042684356601383855ULL, "\u00fcber", 5},
+  {10068961660086719262ULL, "deiner", 6},
+  {4331918286141242569ULL, "noch", 4},
+  {13737673473960504778ULL, "anderer", 7},
+  {2302897754753379805ULL, "unter", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {628032278800124862ULL, "in", 2},
+  {1361261343382457391ULL, "eures", 5},
+  {0, "", 0},
+  {278115912583509300ULL, "sollte", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13237819229331828029ULL, "solcher", 7},
+  {9630198379403379762ULL, "dann", 4},
+  {9521651539826270936ULL, "ihrem", 5},
+  {0, "", 0},
+  {6363738931056117174ULL, "kein", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {620432454427444230ULL, "an", 2},
+  {7614920371424107386ULL, "allem", 5},
+  {7565211853841441632ULL, "vor", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {3766637490318696249ULL, "kann", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {9521666932989065890ULL, "ihres", 5},
+  {10281777476163229910ULL, "seines", 6},
+  {0, "", 0},
+  {5659593344029807815ULL, "einiges", 7},
+  {7239205329974507306ULL, "unse", 4},
+  {0, "", 0},
+  {580791836372450959ULL, "man", 3},
+  {10068973754714629583ULL, "deinem", 6},
+  {8393965046810681964ULL, "keinem", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13237818129820199818ULL, "solches", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {3145466480177106722ULL, "ihr", 3},
+  {0, "", 0},
+  {485482438319879521ULL, "jenen", 5},
+  {11746422410261676899ULL, "durch", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {17627004615911377979ULL, "unses", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {637603527521809367ULL, "so", 2},
+  {0, "", 0},
+  {573161225674180419ULL, "mir", 3},
+  {3315658456025329791ULL, "habe", 4},
+  {23684687672112213ULL, "bis", 3},
+  {8412635506644137369ULL, "anderr", 6},
+  {8393990335578130817ULL, "keiner", 6},
+  {1361250348266175281ULL, "eurem", 5},
+  {5525269238850885370ULL, "und", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {3367300819684434845ULL, "nicht", 5},
+  {0, "", 0},
+  {14884964226109627918ULL, "zur", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13631722711868420671ULL, "einig", 5},
+  {0, "", 0},
+  {3707357603970845404ULL, "hin", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {16640978851477448329ULL, "als", 3},
+  {0, "", 0},
+  {633698062219160795ULL, "wo", 2},
+  {12667825331262790755ULL, "welcher", 7},
+  {0, "", 0},
+  {14268043213243252122ULL, "jetzt", 5},
+  {0, "", 0},
+  {9064782387233016666ULL, "manchem", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {573167822743949685ULL, "mit", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {617348324310880050ULL, "du", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {8603284717366024949ULL, "jene", 4},
+  {13237820328843456240ULL, "solchem", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {3333051001233677590ULL, "dieselbe", 8},
+  {7614887386075261056ULL, "alles", 5},
+  {11185368707233839530ULL, "wirst", 5},
+  {0, "", 0},
+  {9497987777124460244ULL, "indem", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {12124422415372459ULL, "bei", 3},
+  {14166827694121432787ULL, "nach", 4},
+  {6680905367219880675ULL, "welche", 6},
+  {5525246149106692939ULL, "uns", 3},
+  {616496202799205750ULL, "er", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {450299818683383522ULL, "warst", 5},
+  {0, "", 0},
+  {10281778575674858121ULL, "seiner", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {2378701155716050138ULL, "nur", 3},
+  {10068974854226257794ULL, "deinen", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {11950858407607420670ULL, "denn", 4},
+  {3699709401086523488ULL, "hab", 3},
+  {3253544073668207583ULL, "sehr", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {9387918458931163644ULL, "sie", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {3699733590342344130ULL, "hat", 3},
+  {0, "", 0},
+  {17015726074901087697ULL, "dieser", 6},
+  {14898683137515976166ULL, "eure", 4},
+  {6822365305335756517ULL, "war", 3},
+  {0, "", 0},
+  {1402775335781309352ULL, "meines", 6},
+  {0, "", 0},
+  {12667820933216277911ULL, "welchen", 7},
+  {2024027872962702397ULL, "ihnen", 5},
+  {10068962759598347473ULL, "deines", 6},
+  {5621236811271330202ULL, "sich", 4},
+  {8412666292969727277ULL, "andern", 6},
+  {0, "", 0},
+  {17635656157328894897ULL, "denselben", 9},
+  {0, "", 0},
+  {0, "", 0},
+  {17015735970505741596ULL, "diesem", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {6830264196871310541ULL, "wir", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {14599018632649503332ULL, "den", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {17422511808094188014ULL, "werde", 5},
+  {7073496100546255088ULL, "sondern", 7},
+  {13737676772495389411ULL, "anderem", 7},
+  {8412654198341816956ULL, "andere", 6},
+  {5659564756727474329ULL, "einigem", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {3260765515211200736ULL, "k\u00f6nnen", 7},
+  {4382764074883853043ULL, "ohne", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {1361260243870829180ULL, "eurer", 5},
+  {7565245938701916173ULL, "vom", 3},
+  {485459348575687090ULL, "jenes", 5},
+  {15872959320924963975ULL, "doch", 4},
+  {9474526224577225424ULL, "da\u00df", 4},
+  {7614888485586889267ULL, "aller", 5},
+  {0, "", 0},
+  {14557502509764192614ULL, "dies", 4},
+  {15856605184970170386ULL, "dort", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {10544682698162376436ULL, "selbst", 6},
+  {1402754445060373343ULL, "meinen", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {2378670369390460230ULL, "nun", 3},
+  {0, "", 0},
+  {14595373751602740767ULL, "das", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {14884941136365435487ULL, "zum", 3},
+  {0, "", 0},
+  {9618947076914167299ULL, "dazu", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13635420369473337364ULL, "einer", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {1361247049731290648ULL, "euren", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {14599021931184387965ULL, "dem", 3},
+  {0, "", 0},
+  {13737677872007017622ULL, "anderen", 7},
+  {0, "", 0},
+  {539012234598036901ULL, "ihre", 4},
+  {0, "", 0},
 };
 
-bool isGermanStopword(const string &word) {
-  return stopwordSet.count(word) > 0;
+} // anonymous namespace
+
+const StopwordTable kGermanStopwords {
+  kDisplacements, 63, kEntries, 9
+};
+
+bool isGermanStopword(const text_util::StringView &word, uint64_t hash) {
+  return kGermanStopwords.contains(word, hash);
 }
 
 } // stopwords
 } // relevanced
-
@@ -1,298 +1,553 @@
-#include <string>
-#include <unordered_set>
-#include "stopwords/italian_stopwords.h"
+// generated by scripts/dump_nltk_stopwords.py; do not edit.
 
-using namespace std;
+#include <cstdint>
+#include "stopwords/italian_stopwords.h"
+#include "stopwords/StopwordTable.h"
+#include "text_util/StringView.h"
 
 namespace relevanced {
 namespace stopwords {
 
-const unordered_set<string> stopwordSet {
-  "ad",
-  "al",
-  "allo",
-  "ai",
-  "agli",
-  "all",
-  "agl",
-  "alla",
-  "alle",
-  "con",
-  "col",
-  "coi",
-  "da",
-  "dal",
-  "dallo",
-  "dai",
-  "dagli",
-  "dall",
-  "dagl",
-  "dalla",
-  "dalle",
-  "di",
-  "del",
-  "dello",
-  "dei",
-  "degli",
-  "dell",
-  "degl",
-  "della",
-  "delle",
-  "in",
-  "nel",
-  "nello",
-  "nei",
-  "negli",
-  "nell",
-  "negl",
-  "nella",
-  "nelle",
-  "su",
-  "sul",
-  "sullo",
-  "sui",
-  "sugli",
-  "sull",
-  "sugl",
-  "sulla",
-  "sulle",
-  "per",
-  "tra",
-  "contro",
-  "io",
-  "tu",
-  "lui",
-  "lei",
-  "noi",
-  "voi",
-  "loro",
-  "mio",
-  "mia",
-  "miei",
-  "mie",
-  "tuo",
-  "tua",
-  "tuoi",
-  "tue",
-  "suo",
-  "sua",
-  "suoi",
-  "sue",
-  "nostro",
-  "nostra",
-  "nostri",
-  "nostre",
-  "vostro",
-  "vostra",
-  "vostri",
-  "vostre",
-  "mi",
-  "ti",
-  "ci",
-  "vi",
-  "lo",
-  "la",
-  "li",
-  "le",
-  "gli",
-  "ne",
-  "il",
-  "un",
-  "uno",
-  "una",
-  "ma",
-  "ed",
-  "se",
-  "perch\u00e9",
-  "anche",
-  "come",
-  "dov",
-  "dove",
-  "che",
-  "chi",
-  "cui",
-  "non",
-  "pi\u00f9",
-  "quale",
-  "quanto",
-  "quanti",
-  "quanta",
-  "quante",
-  "quello",
-  "quelli",
-  "quella",
-  "quelle",
-  "questo",
-  "questi",
-  "questa",
-  "queste",
-  "si",
-  "tutto",
-  "tutti",
-  "a",
-  "c",
-  "e",
-  "i",
-  "l",
-  "o",
-  "ho",
-  "hai",
-  "ha",
-  "abbiamo",
-  "avete",
-  "hanno",
-  "abbia",
-  "abbiate",
-  "abbiano",
-  "avr\u00f2",
-  "avrai",
-  "avr\u00e0",
-  "avremo",
-  "avrete",
-  "avranno",
-  "avrei",
-  "avresti",
-  "avrebbe",
-  "avremmo",
-  "avreste",
-  "avrebbero",
-  "avevo",
-  "avevi",
-  "aveva",
-  "avevamo",
-  "avevate",
-  "avevano",
-  "ebbi",
-  "avesti",
-  "ebbe",
-  "avemmo",
-  "aveste",
-  "ebbero",
-  "avessi",
-  "avesse",
-  "avessimo",
-  "avessero",
-  "avendo",
-  "avuto",
-  "avuta",
-  "avuti",
-  "avute",
-  "sono",
-  "sei",
-  "\u00e8",
-  "siamo",
-  "siete",
-  "sia",
-  "siate",
-  "siano",
-  "sar\u00f2",
-  "sarai",
-  "sar\u00e0",
-  "saremo",
-  "sarete",
-  "saranno",
-  "sarei",
-  "saresti",
-  "sarebbe",
-  "saremmo",
-  "sareste",
-  "sarebbero",
-  "ero",
-  "eri",
-  "era",
-  "eravamo",
-  "eravate",
-  "erano",
-  "fui",
-  "fosti",
-  "fu",
-  "fummo",
-  "foste",
-  "furono",
-  "fossi",
-  "fosse",
-  "fossimo",
-  "fossero",
-  "essendo",
-  "faccio",
-  "fai",
-  "facciamo",
-  "fanno",
-  "faccia",
-  "facciate",
-  "facciano",
-  "far\u00f2",
-  "farai",
-  "far\u00e0",
-  "faremo",
-  "farete",
-  "faranno",
-  "farei",
-  "faresti",
-  "farebbe",
-  "faremmo",
-  "fareste",
-  "farebbero",
-  "facevo",
-  "facevi",
-  "faceva",
-  "facevamo",
-  "facevate",
-  "facevano",
-  "feci",
-  "facesti",
-  "fece",
-  "facemmo",
-  "faceste",
-  "fecero",
-  "facessi",
-  "facesse",
-  "facessimo",
-  "facessero",
-  "facendo",
-  "sto",
-  "stai",
-  "sta",
-  "stiamo",
-  "stanno",
-  "stia",
-  "stiate",
-  "stiano",
-  "star\u00f2",
-  "starai",
-  "star\u00e0",
-  "staremo",
-  "starete",
-  "staranno",
-  "starei",
-  "staresti",
-  "starebbe",
-  "staremmo",
-  "stareste",
-  "starebbero",
-  "stavo",
-  "stavi",
-  "stava",
-  "stavamo",
-  "stavate",
-  "stavano",
-  "stetti",
-  "stesti",
-  "stette",
-  "stemmo",
-  "steste",
-  "stettero",
-  "stessi",
-  "stesse",
-  "stessimo",
-  "stessero",
-  "stando"
+namespace {
+
+const uint16_t kDisplacements[128] = {
+  0, 0, 0, 5, 4, 0, 3, 0, 0, 0, 2, 0,
+  0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 4,
+  3, 2, 0, 0, 3, 0, 0, 1, 0, 2, 0, 1,
+  1, 0, 2, 0, 0, 0, 3, 1, 4, 0, 0, 0,
+  0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 0, 0,
+  0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 3, 0, 2, 2, 5, 2, 6, 4, 3, 7, 1,
+  1, 0, 0, 1, 3, 3, 4, 2, 2, 5, 3, 1,
+  3, 2, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0,
+  1, 0, 0, 0, 1, 4, 0, 2, 0, 4, 1, 0,
+  0, 5, 3, 0, 1, 0, 0, 1,
+};
+
+const StopwordEntry kEntries[512] = {
+  {0, "", 0},
+  {17184227349196445257ULL, "facessimo", 9},
+  {0, "", 0},
+  {4702021414729809524ULL, "stetti", 6},
+  {619331843287794244ULL, "fu", 2},
+  {0, "", 0},
+  {18440676989585370236ULL, "furono", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {14836798951521634895ULL, "facciate", 8},
+  {8627896439284600548ULL, "per", 3},
+  {632829448033063330ULL, "tu", 2},
+  {1964718100736706966ULL, "questo", 6},
+  {10419123449347788143ULL, "avr\u00e0", 5},
+  {0, "", 0},
+  {16215850668710886281ULL, "aveste", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {850366214652812481ULL, "come", 4},
+  {0, "", 0},
+  {7822920299397539825ULL, "stesti", 6},
+  {828766063916176453ULL, "dalla", 5},
+  {0, "", 0},
+  {17531329431690048605ULL, "facevamo", 8},
+  {0, "", 0},
+  {0, "", 0},
+  {625229623660382698ULL, "le", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {2730514618692356649ULL, "saranno", 7},
+  {5681961315353416196ULL, "saremo", 6},
+  {0, "", 0},
+  {14528909229685944713ULL, "abbiate", 7},
+  {7418852242772442847ULL, "avremo", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {9085792021367937072ULL, "sulle", 5},
+  {6332374218253089677ULL, "faresti", 7},
+  {9050986903316336248ULL, "avranno", 7},
+  {9719664729194422174ULL, "avute", 5},
+  {5807530230277507772ULL, "vostra", 6},
+  {256696585595512343ULL, "starebbe", 8},
+  {13168398974534105646ULL, "sugl", 4},
+  {1964724697806476232ULL, "queste", 6},
+  {10743660217641648681ULL, "staranno", 8},
+  {14830019362823410444ULL, "facciamo", 8},
+  {0, "", 0},
+  {2901939253051598091ULL, "ebbe", 4},
+  {17565997588117068189ULL, "avrebbero", 9},
+  {13031585332758112241ULL, "tutti", 5},
+  {17179740185826942300ULL, "stavi", 5},
+  {0, "", 0},
+  {573144732999757254ULL, "mia", 3},
+  {0, "", 0},
+  {620435752962328863ULL, "ai", 2},
+  {16651423112431743143ULL, "agl", 3},
+  {6332361024113551145ULL, "fareste", 7},
+  {5709901330930962044ULL, "stavamo", 7},
+  {775206308253539406ULL, "\u00e8", 2},
+  {10418227902851399945ULL, "quale", 5},
+  {628912987614132648ULL, "ho", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {2313932759527780235ULL, "quante", 6},
+  {13312356385835851334ULL, "faccio", 6},
+  {0, "", 0},
+  {2393903003484667824ULL, "nel", 3},
+  {14522160427313310170ULL, "abbiamo", 7},
+  {0, "", 0},
+  {5525265940316000737ULL, "una", 3},
+  {0, "", 0},
+  {1994522260169435748ULL, "stando", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {5887993025347401013ULL, "delle", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {13803551927263234332ULL, "dagli", 5},
+  {6272011357054565158ULL, "tra", 3},
+  {4045992566977723740ULL, "faremmo", 7},
+  {5710992046465958131ULL, "stavano", 7},
+  {0, "", 0},
+  {9384237294000670116ULL, "sei", 3},
+  {17727559123131786283ULL, "con", 3},
+  {5887999622417170279ULL, "dello", 5},
+  {11944142590583632457ULL, "degl", 4},
+  {5039326625643858922ULL, "erano", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {18271595799993132110ULL, "avete", 5},
+  {15724064810372695681ULL, "miei", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {10690295060355771927ULL, "sarebbe", 7},
+  {617370314543444270ULL, "di", 2},
+  {0, "", 0},
+  {628030079776868440ULL, "il", 2},
+  {2004092409379492042ULL, "stanno", 6},
+  {9561800082369464049ULL, "allo", 4},
+  {1310595558537332170ULL, "sareste", 7},
+  {3983090944221159979ULL, "fecero", 6},
+  {6696823742953668939ULL, "avevano", 7},
+  {0, "", 0},
+  {14595402338905074253ULL, "dai", 3},
+  {0, "", 0},
+  {17188851849186663984ULL, "foste", 5},
+  {17629496970067786350ULL, "farete", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {620430255404187808ULL, "al", 2},
+  {3510299171062024507ULL, "facendo", 7},
+  {617361518450418582ULL, "da", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {828768262939432875ULL, "dallo", 5},
+  {5660741782144794787ULL, "eravate", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {1438765387975954218ULL, "faceste", 7},
+  {18273522144365379332ULL, "avevi", 5},
+  {0, "", 0},
+  {9561789087253181939ULL, "alle", 4},
+  {7233529826382660175ULL, "sarei", 5},
+  {0, "", 0},
+  {12230945696795430328ULL, "siamo", 5},
+  {16526650127491334868ULL, "nell", 4},
+  {15346704131829998933ULL, "gli", 3},
+  {0, "", 0},
+  {3477933394314251308ULL, "essendo", 7},
+  {0, "", 0},
+  {12638195996648667684ULL, "i", 1},
+  {0, "", 0},
+  {0, "", 0},
+  {634782180684387616ULL, "vi", 2},
+  {13031587531781368663ULL, "tutto", 5},
+  {12638193797625411262ULL, "o", 1},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {625218628544100588ULL, "lo", 2},
+  {0, "", 0},
+  {123583038332311951ULL, "nella", 5},
+  {9323727963347085670ULL, "staresti", 8},
+  {17724749870922274853ULL, "chi", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {201476115898199136ULL, "degli", 5},
+  {0, "", 0},
+  {3699721495714433809ULL, "hai", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {9719653734078140064ULL, "avuto", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {8462198917016196652ULL, "nostri", 6},
+  {12638182802509129152ULL, "e", 1},
+  {6387834199224468551ULL, "fummo", 5},
+  {7229580380614883163ULL, "sarai", 5},
+  {14604938403254656006ULL, "dov", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {16994832154927367516ULL, "farebbe", 7},
+  {6642083967892592646ULL, "abbia", 5},
+  {9399468828583249499ULL, "sul", 3},
+  {0, "", 0},
+  {17188865043326202516ULL, "fosti", 5},
+  {9623728852984310813ULL, "dagl", 4},
+  {0, "", 0},
+  {625225225613869854ULL, "la", 2},
+  {17706449599385926244ULL, "cui", 3},
+  {17179748981919967988ULL, "stava", 5},
+  {123589635402081217ULL, "nello", 5},
+  {0, "", 0},
+  {1159392650911443024ULL, "fece", 4},
+  {16537031716282821655ULL, "negl", 4},
+  {17651441023139269313ULL, "faremo", 6},
+  {0, "", 0},
+  {9399463331025108444ULL, "sua", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {8697875519539048737ULL, "quella", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {8348037368171825215ULL, "far\u00f2", 5},
+  {18273519945342122910ULL, "avevo", 5},
+  {0, "", 0},
+  {1964720299759963388ULL, "questi", 6},
+  {0, "", 0},
+  {4663205509656872613ULL, "sugli", 5},
+  {15904865712181602803ULL, "fai", 3},
+  {0, "", 0},
+  {8850096047747090128ULL, "sarebbero", 9},
+  {0, "", 0},
+  {9398590318792498135ULL, "sto", 3},
+  {6276800829706106149ULL, "tue", 3},
+  {5686211253394258463ULL, "stavate", 7},
+  {0, "", 0},
+  {2901934855005085247ULL, "ebbi", 4},
+  {8193310793345743112ULL, "farei", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {10681427255860034975ULL, "avresti", 7},
+  {12616927922438841136ULL, "stia", 4},
+  {632816253893524798ULL, "ti", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {2313928361481267391ULL, "quanti", 6},
+  {16366397172103376394ULL, "agli", 4},
+  {6867106655177726490ULL, "negli", 5},
+  {9399469928094877710ULL, "suo", 3},
+  {14573602554629108327ULL, "siete", 5},
+  {12384385558410292434ULL, "stessimo", 8},
+  {624130112032360923ULL, "ma", 2},
+  {14050415106880045435ULL, "ero", 3},
+  {12489779104860574814ULL, "faranno", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {7219108355874023792ULL, "anche", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {6717940963280926455ULL, "avevate", 7},
+  {5638797729073311824ULL, "eravamo", 7},
+  {0, "", 0},
+  {6276807426775875415ULL, "tuo", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {10601716716760690559ULL, "staremmo", 8},
+  {0, "", 0},
+  {0, "", 0},
+  {14169255444711033217ULL, "fanno", 5},
+  {5807525832230994928ULL, "vostre", 6},
+  {1329240396622735769ULL, "lei", 3},
+  {5525259343246231471ULL, "uno", 3},
+  {11952830931468052754ULL, "dell", 4},
+  {1159405845050981556ULL, "feci", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {10264359491126346866ULL, "avrai", 5},
+  {5263952476518840836ULL, "staremo", 7},
+  {0, "", 0},
+  {7822915901351026981ULL, "steste", 6},
+  {0, "", 0},
+  {14050421703949814701ULL, "eri", 3},
+  {0, "", 0},
+  {5807539026370533460ULL, "vostri", 6},
+  {0, "", 0},
+  {1328454682694849906ULL, "avrebbe", 7},
+  {14599017533137875121ULL, "dei", 3},
+  {0, "", 0},
+  {6696014502395494868ULL, "avevamo", 7},
+  {0, "", 0},
+  {14351124394346895203ULL, "facevo", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {17182382322767595035ULL, "fossi", 5},
+  {3018855209077033233ULL, "avessero", 8},
+  {17724754268968787697ULL, "che", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {628910788590876226ULL, "ha", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {8697866723446023049ULL, "quelli", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {10419108056184993189ULL, "avr\u00f2", 5},
+  {637614522638091477ULL, "su", 2},
+  {1385506104592317094ULL, "contro", 6},
+  {0, "", 0},
+  {12638187200555641996ULL, "a", 1},
+  {0, "", 0},
+  {0, "", 0},
+  {8348057159381133013ULL, "far\u00e0", 5},
+  {9355813062250854595ULL, "hanno", 5},
+  {13141835135519423055ULL, "starei", 6},
+  {0, "", 0},
+  {18139251005932193208ULL, "stiamo", 6},
+  {16218643428245974546ULL, "avessi", 6},
+  {0, "", 0},
+  {16215863862850424813ULL, "avesti", 6},
+  {17179737986803685878ULL, "stavo", 5},
+  {7565241540655403329ULL, "voi", 3},
+  {9758606655391548957ULL, "stessero", 8},
+  {0, "", 0},
+  {0, "", 0},
+  {9380357554351566174ULL, "avremmo", 7},
+  {12986928240786314348ULL, "star\u00f2", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {9696410455185962586ULL, "tuoi", 4},
+  {18140130615234572783ULL, "stiano", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {1344756704717021801ULL, "lui", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {5255268533680933383ULL, "starete", 7},
+  {0, "", 0},
+  {6280146237167975798ULL, "facessero", 9},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {637601328498552945ULL, "si", 2},
+  {0, "", 0},
+  {7078642722858859266ULL, "sar\u00e0", 5},
+  {624121315939335235ULL, "mi", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {16218647826292487390ULL, "avesse", 6},
+  {8462203315062709496ULL, "nostre", 6},
+  {616480809636410796ULL, "ed", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13175156572999765877ULL, "sull", 4},
+  {9399458932978595600ULL, "sue", 3},
+  {14599020831672759754ULL, "del", 3},
+  {15852929517597817913ULL, "dove", 4},
+  {628032278800124862ULL, "in", 2},
+  {8697879917585561581ULL, "quelle", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {6674671389023265436ULL, "ebbero", 6},
+  {15893334034227196535ULL, "fui", 3},
+  {16640971154896050852ULL, "all", 3},
+  {14595396841346933198ULL, "dal", 3},
+  {0, "", 0},
+  {2403474252206352329ULL, "noi", 3},
+  {18273513348272353644ULL, "aveva", 5},
+  {0, "", 0},
+  {12207026920840058859ULL, "siate", 5},
+  {0, "", 0},
+  {6276796431659593305ULL, "tua", 3},
+  {7078622931649551468ULL, "sar\u00f2", 5},
+  {14519345677545657685ULL, "abbiano", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {1443537268441443833ULL, "facessi", 7},
+  {14830898972125790019ULL, "facciano", 8},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {573149131046270098ULL, "mie", 3},
+  {8462207713109222340ULL, "nostra", 6},
+  {637596930452040101ULL, "se", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {17727564620689927338ULL, "coi", 3},
+  {14050412907856789013ULL, "era", 3},
+  {628033378311753073ULL, "io", 2},
+  {2393908501042808879ULL, "nei", 3},
+  {12969085958759358511ULL, "perch\u00e9", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {622155389148472417ULL, "ci", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {7427602156308042960ULL, "avrete", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {2454042766961586136ULL, "fossero", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {1443550462580982365ULL, "facesse", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {14351130991416664469ULL, "facevi", 6},
+  {573155728116039364ULL, "mio", 3},
+  {12986948031995622146ULL, "star\u00e0", 6},
+  {9399472127118134132ULL, "sui", 3},
+  {0, "", 0},
+  {10260410045358569854ULL, "avrei", 5},
+  {674269807847851590ULL, "avessimo", 8},
+  {0, "", 0},
+  {9719669127240935018ULL, "avuta", 5},
+  {9085796419414449916ULL, "sulla", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {1964729095852989076ULL, "questa", 6},
+  {828761665869663609ULL, "dalle", 5},
+  {13929482211575058876ULL, "avemmo", 6},
+  {17727561322155042705ULL, "col", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {5055051872024912055ULL, "fossimo", 7},
+  {9387914060884650800ULL, "sia", 3},
+  {6591892364826102847ULL, "farebbero", 9},
+  {0, "", 0},
+  {0, "", 0},
+  {2588571117811398527ULL, "saremmo", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {620439051497213496ULL, "ad", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {631726637870156922ULL, "un", 2},
+  {0, "", 0},
+  {12231825306097809903ULL, "siano", 5},
+  {0, "", 0},
+  {2313937157574293079ULL, "quanta", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {12609336894159186192ULL, "stai", 4},
+  {626931667660474876ULL, "ne", 2},
+  {123578640285799107ULL, "nelle", 5},
+  {5673277372515508743ULL, "sarete", 6},
+  {18075172230598629355ULL, "stettero", 8},
+  {9085803016484219182ULL, "sullo", 5},
+  {9398579323676216025ULL, "sta", 3},
+  {2313926162458010969ULL, "quanto", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {1310582364397793638ULL, "saresti", 7},
+  {13919243321745668750ULL, "pi\u00f9", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {17555300984203574202ULL, "facevate", 8},
+  {0, "", 0},
+  {4702008220590270992ULL, "stette", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {8697868922469279471ULL, "quello", 6},
+  {0, "", 0},
+  {2716740947250020575ULL, "facemmo", 7},
+  {5807536827347277038ULL, "vostro", 6},
+  {8196978764136698108ULL, "farai", 5},
+  {0, "", 0},
+  {13312367380952133444ULL, "faccia", 6},
+  {14864114822389317551ULL, "loro", 4},
+  {0, "", 0},
+  {625216429520844166ULL, "li", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {9632170903264011846ULL, "dall", 4},
+  {17448172631128640416ULL, "stemmo", 6},
+  {17534179365829803842ULL, "facevano", 8},
+  {2403475351717980540ULL, "non", 3},
+  {13176250587069646597ULL, "suoi", 4},
+  {8104987077484740304ULL, "starebbero", 10},
+  {9561793485299694783ULL, "alla", 4},
+  {0, "", 0},
+  {10681431653906547819ULL, "avreste", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {7818135224792511678ULL, "stessi", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {6931587490431635804ULL, "sono", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {17182377924721082191ULL, "fosse", 5},
+  {8462196717992940230ULL, "nostro", 6},
+  {0, "", 0},
+  {7818130826745998834ULL, "stesse", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {9323741157486624202ULL, "stareste", 8},
+  {5887988627300888169ULL, "della", 5},
+  {12638189399578898418ULL, "c", 1},
+  {0, "", 0},
+  {9719660331147909330ULL, "avuti", 5},
+  {0, "", 0},
+  {12638192698113783051ULL, "l", 1},
+  {13137885689751646043ULL, "starai", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {15732148018221352716ULL, "avendo", 6},
+  {1438752193836415686ULL, "facesti", 7},
+  {14351139787509690157ULL, "faceva", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {18115332229976821739ULL, "stiate", 6},
 };
 
-bool isItalianStopword(const string &word) {
-  return stopwordSet.count(word) > 0;
+} // anonymous namespace
+
+const StopwordTable kItalianStopwords {
+  kDisplacements, 127, kEntries, 9
+};
+
+bool isItalianStopword(const text_util::StringView &word, uint64_t hash) {
+  return kItalianStopwords.contains(word, hash);
 }
 
 } // stopwords
 } // relevanced
-
@@ -1,170 +1,292 @@
-#include <string>
-#include <unordered_set>
-#include "stopwords/russian_stopwords.h"
+// generated by scripts/dump_nltk_stopwords.py; do not edit.
 
-using namespace std;
+#include <cstdint>
+#include "stopwords/russian_stopwords.h"
+#include "stopwords/StopwordTable.h"
+#include "text_util/StringView.h"
 
 namespace relevanced {
 namespace stopwords {
 
-const unordered_set<string> stopwordSet {
-  "\u0438",
-  "\u0432",
-  "\u0432\u043e",
-  "\u043d\u0435",
-  "\u0447\u0442\u043e",
-  "\u043e\u043d",
-  "\u043d\u0430",
-  "\u044f",
-  "\u0441",
-  "\u0441\u043e",
-  "\u043a\u0430\u043a",
-  "\u0430",
-  "\u0442\u043e",
-  "\u0432\u0441\u0435",
-  "\u043e\u043d\u0430",
-  "\u0442\u0430\u043a",
-  "\u0435\u0433\u043e",
-  "\u043d\u043e",
-  "\u0434\u0430",
-  "\u0442\u044b",
-  "\u043a",
-  "\u0443",
-  "\u0436\u0435",
-  "\u0432\u044b",
-  "\u0437\u0430",
-  "\u0431\u044b",
-  "\u043f\u043e",
-  "\u0442\u043e\u043b\u044c\u043a\u043e",
-  "\u0435\u0435",
-  "\u043c\u043d\u0435",
-  "\u0431\u044b\u043b\u043e",
-  "\u0432\u043e\u0442",
-  "\u043e\u0442",
-  "\u043c\u0435\u043d\u044f",
-  "\u0435\u0449\u0435",
-  "\u043d\u0435\u0442",
-  "\u043e",
-  "\u0438\u0437",
-  "\u0435\u043c\u0443",
-  "\u0442\u0435\u043f\u0435\u0440\u044c",
-  "\u043a\u043e\u0433\u0434\u0430",
-  "\u0434\u0430\u0436\u0435",
-  "\u043d\u0443",
-  "\u0432\u0434\u0440\u0443\u0433",
-  "\u043b\u0438",
-  "\u0435\u0441\u043b\u0438",
-  "\u0443\u0436\u0435",
-  "\u0438\u043b\u0438",
-  "\u043d\u0438",
-  "\u0431\u044b\u0442\u044c",
-  "\u0431\u044b\u043b",
-  "\u043d\u0435\u0433\u043e",
-  "\u0434\u043e",
-  "\u0432\u0430\u0441",
-  "\u043d\u0438\u0431\u0443\u0434\u044c",
-  "\u043e\u043f\u044f\u0442\u044c",
-  "\u0443\u0436",
-  "\u0432\u0430\u043c",
-  "\u0432\u0435\u0434\u044c",
-  "\u0442\u0430\u043c",
-  "\u043f\u043e\u0442\u043e\u043c",
-  "\u0441\u0435\u0431\u044f",
-  "\u043d\u0438\u0447\u0435\u0433\u043e",
-  "\u0435\u0439",
-  "\u043c\u043e\u0436\u0435\u0442",
-  "\u043e\u043d\u0438",
-  "\u0442\u0443\u0442",
-  "\u0433\u0434\u0435",
-  "\u0435\u0441\u0442\u044c",
-  "\u043d\u0430\u0434\u043e",
-  "\u043d\u0435\u0439",
-  "\u0434\u043b\u044f",
-  "\u043c\u044b",
-  "\u0442\u0435\u0431\u044f",
-  "\u0438\u0445",
-  "\u0447\u0435\u043c",
-  "\u0431\u044b\u043b\u0430",
-  "\u0441\u0430\u043c",
-  "\u0447\u0442\u043e\u0431",
-  "\u0431\u0435\u0437",
-  "\u0431\u0443\u0434\u0442\u043e",
-  "\u0447\u0435\u0433\u043e",
-  "\u0440\u0430\u0437",
-  "\u0442\u043e\u0436\u0435",
-  "\u0441\u0435\u0431\u0435",
-  "\u043f\u043e\u0434",
-  "\u0431\u0443\u0434\u0435\u0442",
-  "\u0436",
-  "\u0442\u043e\u0433\u0434\u0430",
-  "\u043a\u0442\u043e",
-  "\u044d\u0442\u043e\u0442",
-  "\u0442\u043e\u0433\u043e",
-  "\u043f\u043e\u0442\u043e\u043c\u0443",
-  "\u044d\u0442\u043e\u0433\u043e",
-  "\u043a\u0430\u043a\u043e\u0439",
-  "\u0441\u043e\u0432\u0441\u0435\u043c",
-  "\u043d\u0438\u043c",
-  "\u0437\u0434\u0435\u0441\u044c",
-  "\u044d\u0442\u043e\u043c",
-  "\u043e\u0434\u0438\u043d",
-  "\u043f\u043e\u0447\u0442\u0438",
-  "\u043c\u043e\u0439",
-  "\u0442\u0435\u043c",
-  "\u0447\u0442\u043e\u0431\u044b",
-  "\u043d\u0435\u0435",
-  "\u0441\u0435\u0439\u0447\u0430\u0441",
-  "\u0431\u044b\u043b\u0438",
-  "\u043a\u0443\u0434\u0430",
-  "\u0437\u0430\u0447\u0435\u043c",
-  "\u0432\u0441\u0435\u0445",
-  "\u043d\u0438\u043a\u043e\u0433\u0434\u0430",
-  "\u043c\u043e\u0436\u043d\u043e",
-  "\u043f\u0440\u0438",
-  "\u043d\u0430\u043a\u043e\u043d\u0435\u0446",
-  "\u0434\u0432\u0430",
-  "\u043e\u0431",
-  "\u0434\u0440\u0443\u0433\u043e\u0439",
-  "\u0445\u043e\u0442\u044c",
-  "\u043f\u043e\u0441\u043b\u0435",
-  "\u043d\u0430\u0434",
-  "\u0431\u043e\u043b\u044c\u0448\u0435",
-  "\u0442\u043e\u0442",
-  "\u0447\u0435\u0440\u0435\u0437",
-  "\u044d\u0442\u0438",
-  "\u043d\u0430\u0441",
-  "\u043f\u0440\u043e",
-  "\u0432\u0441\u0435\u0433\u043e",
-  "\u043d\u0438\u0445",
-  "\u043a\u0430\u043a\u0430\u044f",
-  "\u043c\u043d\u043e\u0433\u043e",
-  "\u0440\u0430\u0437\u0432\u0435",
-  "\u0442\u0440\u0438",
-  "\u044d\u0442\u0443",
-  "\u043c\u043e\u044f",
-  "\u0432\u043f\u0440\u043e\u0447\u0435\u043c",
-  "\u0445\u043e\u0440\u043e\u0448\u043e",
-  "\u0441\u0432\u043e\u044e",
-  "\u044d\u0442\u043e\u0439",
-  "\u043f\u0435\u0440\u0435\u0434",
-  "\u0438\u043d\u043e\u0433\u0434\u0430",
-  "\u043b\u0443\u0447\u0448\u0435",
-  "\u0447\u0443\u0442\u044c",
-  "\u0442\u043e\u043c",
-  "\u043d\u0435\u043b\u044c\u0437\u044f",
-  "\u0442\u0430\u043a\u043e\u0439",
-  "\u0438\u043c",
-  "\u0431\u043e\u043b\u0435\u0435",
-  "\u0432\u0441\u0435\u0433\u0434\u0430",
-  "\u043a\u043e\u043d\u0435\u0447\u043d\u043e",
-  "\u0432\u0441\u044e",
-  "\u043c\u0435\u0436\u0434\u0443"
+namespace {
+
+const uint16_t kDisplacements[64] = {
+  6, 4, 3, 4, 1, 0, 1, 4, 2, 2, 1, 3,
+  0, 1, 0, 0, 2, 3, 2, 1, 4, 0, 0, 0,
+  0, 1, 0, 0, 4, 1, 0, 5, 0, 0, 2, 3,
+  1, 0, 4, 2, 14, 0, 3, 3, 1, 0, 0, 0,
+  0, 0, 1, 1, 2, 4, 0, 2, 0, 1, 5, 1,
+  0, 2, 2, 0,
+};
+
+const StopwordEntry kEntries[256] = {
+  {0, "", 0},
+  {18348770475500783505ULL, "\u043f\u043e\u0447\u0442\u0438", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {789829812905907331ULL, "\u043e", 2},
+  {8893821265923305918ULL, "\u043f\u043e\u0434", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {3934840774640213068ULL, "\u043c\u043e\u0439", 6},
+  {789843007045445863ULL, "\u0432", 2},
+  {15924196431516679444ULL, "\u043b\u0438", 4},
+  {5469680548495447464ULL, "\u043d\u0435\u043b\u044c\u0437\u044f", 12},
+  {0, "", 0},
+  {789838608998933019ULL, "\u0436", 2},
+  {0, "", 0},
+  {3001886959638840587ULL, "\u0432\u044b", 4},
+  {18293391994258421857ULL, "\u0432\u0441\u0435\u0433\u043e", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {7050774106616795576ULL, "\u043d\u0438\u0431\u0443\u0434\u044c", 12},
+  {3003071133662234609ULL, "\u0432\u043e", 4},
+  {15207246680385138937ULL, "\u043c\u044b", 4},
+  {5242251290866223784ULL, "\u043a\u0430\u043a\u043e\u0439", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {3933659899151703679ULL, "\u043c\u043e\u044f", 6},
+  {125855492902472860ULL, "\u043a\u043e\u043d\u0435\u0447\u043d\u043e", 14},
+  {10894312445690910203ULL, "\u0447\u0442\u043e\u0431\u044b", 10},
+  {1876940329237276999ULL, "\u0434\u043e", 4},
+  {10397244912268118856ULL, "\u043e\u0434\u0438\u043d", 8},
+  {18070240700434154734ULL, "\u0431\u043e\u043b\u044c\u0448\u0435", 12},
+  {0, "", 0},
+  {9810972223923006066ULL, "\u0432\u043f\u0440\u043e\u0447\u0435\u043c", 14},
+  {0, "", 0},
+  {15114960124606762995ULL, "\u043f\u043e\u0442\u043e\u043c", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {3865479918080659868ULL, "\u0432\u0441\u0435\u0445", 8},
+  {17892921308123791285ULL, "\u0441\u0435\u0439\u0447\u0430\u0441", 12},
+  {12010693616335658381ULL, "\u044d\u0442\u043e\u0433\u043e", 10},
+  {788544483812717897ULL, "\u044f", 2},
+  {6760468442610958097ULL, "\u0441\u043e", 4},
+  {15373095196630331702ULL, "\u043d\u0435\u0433\u043e", 8},
+  {0, "", 0},
+  {9107551113886705752ULL, "\u043d\u0430\u0434\u043e", 8},
+  {11153188129713430790ULL, "\u0432\u043e\u0442", 6},
+  {7886590450942890019ULL, "\u0443\u0436", 4},
+  {16708681628256518669ULL, "\u043d\u0430\u043a\u043e\u043d\u0435\u0446", 14},
+  {14554765823222195472ULL, "\u043c\u043e\u0436\u043d\u043e", 10},
+  {9634099151665955566ULL, "\u043d\u0435\u0435", 6},
+  {16985327974889290120ULL, "\u0442\u043e\u043b\u044c\u043a\u043e", 12},
+  {0, "", 0},
+  {6268680975560450786ULL, "\u043d\u0430\u0434", 6},
+  {1130279574894084825ULL, "\u0435\u0439", 4},
+  {13525177423581976295ULL, "\u0431\u0443\u0434\u0442\u043e", 10},
+  {2750159083904347625ULL, "\u0445\u043e\u0440\u043e\u0448\u043e", 12},
+  {126875158874190024ULL, "\u0437\u0430", 4},
+  {11932268884868612219ULL, "\u0434\u0432\u0430", 6},
+  {15863404651732041180ULL, "\u0442\u0430\u043a", 6},
+  {0, "", 0},
+  {17795459669121805163ULL, "\u0438\u0445", 4},
+  {10675555311518695213ULL, "\u0435\u0433\u043e", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {7003561944169159475ULL, "\u0442\u043e\u0442", 6},
+  {789836409975676597ULL, "\u0438", 2},
+  {14590328468314000372ULL, "\u0440\u0430\u0437\u0432\u0435", 10},
+  {7857081985271805691ULL, "\u043d\u0438\u043a\u043e\u0433\u0434\u0430", 14},
+  {0, "", 0},
+  {7703042315208651134ULL, "\u0431\u0443\u0434\u0435\u0442", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {11938898871088073881ULL, "\u0447\u0435\u0433\u043e", 8},
+  {0, "", 0},
+  {5908646568536492791ULL, "\u043a\u0443\u0434\u0430", 8},
+  {0, "", 0},
+  {12663169737923920108ULL, "\u0431\u0435\u0437", 6},
+  {149411557419546574ULL, "\u0442\u0435\u0431\u044f", 8},
+  {7530355589838014673ULL, "\u0432\u0430\u0441", 6},
+  {788555478929000007ULL, "\u0441", 2},
+  {1271071200866250077ULL, "\u043a\u0430\u043a", 6},
+  {18421010928199592819ULL, "\u0431\u044b\u043b", 6},
+  {5945672144821626428ULL, "\u044d\u0442\u0443", 6},
+  {13581178228237958988ULL, "\u0434\u0440\u0443\u0433\u043e\u0439", 12},
+  {16352683889048656370ULL, "\u0441\u043e\u0432\u0441\u0435\u043c", 12},
+  {1130292769033623357ULL, "\u0435\u0435", 4},
+  {6261561452041424949ULL, "\u0435\u0441\u043b\u0438", 8},
+  {0, "", 0},
+  {14920494047845539462ULL, "\u043d\u0430", 4},
+  {16966887255324443767ULL, "\u0447\u0442\u043e\u0431", 8},
+  {17345493388128926841ULL, "\u044d\u0442\u043e\u0439", 8},
+  {0, "", 0},
+  {4681207959378672905ULL, "\u043c\u043d\u0435", 6},
+  {0, "", 0},
+  {11557918317811870007ULL, "\u0442\u0435\u043f\u0435\u0440\u044c", 12},
+  {4370353790418218142ULL, "\u043d\u0438\u0447\u0435\u0433\u043e", 12},
+  {0, "", 0},
+  {14082371518239409064ULL, "\u043e\u0431", 4},
+  {3212819797603455729ULL, "\u0432\u0435\u0434\u044c", 8},
+  {789845206068702285ULL, "\u0430", 2},
+  {13305170728917083354ULL, "\u043f\u043e", 4},
+  {17335348895887740452ULL, "\u0447\u0442\u043e", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {11476337481315433282ULL, "\u043d\u0438\u043c", 6},
+  {6509794507894337506ULL, "\u043f\u043e\u0441\u043b\u0435", 10},
+  {4601225953878945252ULL, "\u0438\u043b\u0438", 6},
+  {0, "", 0},
+  {3720080258421698510ULL, "\u0431\u044b", 4},
+  {0, "", 0},
+  {10447411598988670783ULL, "\u043f\u043e\u0442\u043e\u043c\u0443", 12},
+  {9286871473415966305ULL, "\u043c\u043e\u0436\u0435\u0442", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {14327628349629133551ULL, "\u0442\u043e\u0433\u043e", 8},
+  {0, "", 0},
+  {14739968671630854200ULL, "\u0431\u044b\u0442\u044c", 8},
+  {6557541585490425209ULL, "\u043f\u0440\u0438", 6},
+  {0, "", 0},
+  {14920499545403680517ULL, "\u043d\u0435", 4},
+  {6369210748606693987ULL, "\u0447\u0443\u0442\u044c", 8},
+  {7408786993840460002ULL, "\u043b\u0443\u0447\u0448\u0435", 10},
+  {0, "", 0},
+  {3525483290841058675ULL, "\u0431\u044b\u043b\u0438", 8},
+  {126895317774328816ULL, "\u0434\u0430\u0436\u0435", 8},
+  {9633449340293872090ULL, "\u043d\u0435\u0442", 6},
+  {4115335435138912745ULL, "\u043a\u0430\u043a\u0430\u044f", 10},
+  {7002638354401651460ULL, "\u0442\u043e\u043c", 6},
+  {7110363828922970030ULL, "\u0442\u044b", 4},
+  {2711002472463348441ULL, "\u043f\u0435\u0440\u0435\u0434", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {14920502843938565150ULL, "\u043d\u0438", 4},
+  {2029617844826298099ULL, "\u0441\u0430\u043c", 6},
+  {0, "", 0},
+  {15706652246530742404ULL, "\u0441\u0435\u0431\u0435", 8},
+  {14920505042961821572ULL, "\u043d\u043e", 4},
+  {0, "", 0},
+  {2882243620914933857ULL, "\u0440\u0430\u0437", 6},
+  {16155721046263844308ULL, "\u043e\u043d\u0438", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {14251938398400792162ULL, "\u0432\u0441\u044e", 6},
+  {11155382510183250868ULL, "\u043e\u043f\u044f\u0442\u044c", 10},
+  {0, "", 0},
+  {10027384400954682932ULL, "\u043c\u0435\u0436\u0434\u0443", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {7531315463489253651ULL, "\u0432\u0430\u043c", 6},
+  {789834210952420175ULL, "\u043a", 2},
+  {0, "", 0},
+  {14082367120192896220ULL, "\u043e\u043d", 4},
+  {788557677952256429ULL, "\u0443", 2},
+  {0, "", 0},
+  {13108365296158069559ULL, "\u0437\u0430\u0447\u0435\u043c", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {16077685823410823049ULL, "\u0442\u043e\u0436\u0435", 8},
+  {5944428597170309012ULL, "\u044d\u0442\u0438", 6},
+  {14379832794344929593ULL, "\u0442\u0430\u043a\u043e\u0439", 10},
+  {14921434130287470642ULL, "\u043d\u0443", 4},
+  {0, "", 0},
+  {5421719052043293435ULL, "\u0432\u0441\u0435\u0433\u0434\u0430", 12},
+  {16594842169197815070ULL, "\u0447\u0435\u043c", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13960217094008053501ULL, "\u0442\u0435\u043c", 6},
+  {12819342409724237946ULL, "\u0435\u0441\u0442\u044c", 8},
+  {0, "", 0},
+  {16155712250170818620ULL, "\u043e\u043d\u0430", 6},
+  {8406084146626365646ULL, "\u0435\u043c\u0443", 6},
+  {15705959554205158699ULL, "\u0441\u0435\u0431\u044f", 8},
+  {16302673674226818204ULL, "\u0434\u043b\u044f", 6},
+  {5395216487871167783ULL, "\u0433\u0434\u0435", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {17796423940819556985ULL, "\u0438\u043c", 4},
+  {0, "", 0},
+  {17172966990180518242ULL, "\u043a\u0442\u043e", 6},
+  {11387938639186591828ULL, "\u0443\u0436\u0435", 6},
+  {0, "", 0},
+  {2254086336486775175ULL, "\u043c\u043d\u043e\u0433\u043e", 10},
+  {14253234722610263706ULL, "\u0432\u0441\u0435", 6},
+  {8898377893598734859ULL, "\u0432\u0434\u0440\u0443\u0433", 10},
+  {10276339171246240563ULL, "\u0435\u0449\u0435", 6},
+  {7759993535145767377ULL, "\u0438\u043d\u043e\u0433\u0434\u0430", 12},
+  {17345496686663811474ULL, "\u044d\u0442\u043e\u043c", 8},
+  {842839747587042700ULL, "\u0436\u0435", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {17346723741640705725ULL, "\u044d\u0442\u043e\u0442", 8},
+  {15555317944176100388ULL, "\u043a\u043e\u0433\u0434\u0430", 10},
+  {6557543784513681631ULL, "\u043f\u0440\u043e", 6},
+  {18121389252913275845ULL, "\u0442\u0443\u0442", 6},
+  {6269368170327893436ULL, "\u043d\u0430\u0441", 6},
+  {0, "", 0},
+  {9634094753619442722ULL, "\u043d\u0435\u0439", 6},
+  {1876929334120994889ULL, "\u0434\u0430", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {7109399557225218208ULL, "\u0442\u043e", 4},
+  {11367409990390197352ULL, "\u0441\u0432\u043e\u044e", 8},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {12212825102512727829ULL, "\u0442\u043e\u0433\u0434\u0430", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {15019472716442399049ULL, "\u0431\u043e\u043b\u0435\u0435", 10},
+  {3525492086934084363ULL, "\u0431\u044b\u043b\u0430", 8},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {14081361067053272380ULL, "\u043e\u0442", 4},
+  {379579137364081199ULL, "\u0445\u043e\u0442\u044c", 8},
+  {6857939817631804969ULL, "\u0447\u0435\u0440\u0435\u0437", 10},
+  {0, "", 0},
+  {10424540226713779400ULL, "\u0437\u0434\u0435\u0441\u044c", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {15863402452708784758ULL, "\u0442\u0430\u043c", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {11476958705385183272ULL, "\u043d\u0438\u0445", 6},
+  {0, "", 0},
+  {17796429438377698040ULL, "\u0438\u0437", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {17404407615944517219ULL, "\u0442\u0440\u0438", 6},
+  {0, "", 0},
+  {3525489887910827941ULL, "\u0431\u044b\u043b\u043e", 8},
+  {0, "", 0},
+  {2182330811489547525ULL, "\u043c\u0435\u043d\u044f", 8},
+  {0, "", 0},
+  {0, "", 0},
 };
 
-bool isRussianStopword(const string &word) {
-  return stopwordSet.count(word) > 0;
+} // anonymous namespace
+
+const StopwordTable kRussianStopwords {
+  kDisplacements, 63, kEntries, 8
+};
+
+bool isRussianStopword(const text_util::StringView &word, uint64_t hash) {
+  return kRussianStopwords.contains(word, hash);
 }
 
 } // stopwords
 } // relevanced
-
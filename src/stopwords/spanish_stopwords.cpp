@@ -1,332 +1,553 @@
-#include <string>
-#include <unordered_set>
-#include "stopwords/spanish_stopwords.h"
+// generated by scripts/dump_nltk_stopwords.py; do not edit.
 
-using namespace std;
+#include <cstdint>
+#include "stopwords/spanish_stopwords.h"
+#include "stopwords/StopwordTable.h"
+#include "text_util/StringView.h"
 
 namespace relevanced {
 namespace stopwords {
 
-const unordered_set<string> stopwordSet {
-  "de",
-  "la",
-  "que",
-  "el",
-  "en",
-  "y",
-  "a",
-  "los",
-  "del",
-  "se",
-  "las",
-  "por",
-  "un",
-  "para",
-  "con",
-  "no",
-  "una",
-  "su",
-  "al",
-  "lo",
-  "como",
-  "m\u00e1s",
-  "pero",
-  "sus",
-  "le",
-  "ya",
-  "o",
-  "este",
-  "s\u00ed",
-  "porque",
-  "esta",
-  "entre",
-  "cuando",
-  "muy",
-  "sin",
-  "sobre",
-  "tambi\u00e9n",
-  "me",
-  "hasta",
-  "hay",
-  "donde",
-  "quien",
-  "desde",
-  "todo",
-  "nos",
-  "durante",
-  "todos",
-  "uno",
-  "les",
-  "ni",
-  "contra",
-  "otros",
-  "ese",
-  "eso",
-  "ante",
-  "ellos",
-  "e",
-  "esto",
-  "m\u00ed",
-  "antes",
-  "algunos",
-  "qu\u00e9",
-  "unos",
-  "yo",
-  "otro",
-  "otras",
-  "otra",
-  "\u00e9l",
-  "tanto",
-  "esa",
-  "estos",
-  "mucho",
-  "quienes",
-  "nada",
-  "muchos",
-  "cual",
-  "poco",
-  "ella",
-  "estar",
-  "estas",
-  "algunas",
-  "algo",
-  "nosotros",
-  "mi",
-  "mis",
-  "t\u00fa",
-  "te",
-  "ti",
-  "tu",
-  "tus",
-  "ellas",
-  "nosotras",
-  "vosostros",
-  "vosostras",
-  "os",
-  "m\u00edo",
-  "m\u00eda",
-  "m\u00edos",
-  "m\u00edas",
-  "tuyo",
-  "tuya",
-  "tuyos",
-  "tuyas",
-  "suyo",
-  "suya",
-  "suyos",
-  "suyas",
-  "nuestro",
-  "nuestra",
-  "nuestros",
-  "nuestras",
-  "vuestro",
-  "vuestra",
-  "vuestros",
-  "vuestras",
-  "esos",
-  "esas",
-  "estoy",
-  "est\u00e1s",
-  "est\u00e1",
-  "estamos",
-  "est\u00e1is",
-  "est\u00e1n",
-  "est\u00e9",
-  "est\u00e9s",
-  "estemos",
-  "est\u00e9is",
-  "est\u00e9n",
-  "estar\u00e9",
-  "estar\u00e1s",
-  "estar\u00e1",
-  "estaremos",
-  "estar\u00e9is",
-  "estar\u00e1n",
-  "estar\u00eda",
-  "estar\u00edas",
-  "estar\u00edamos",
-  "estar\u00edais",
-  "estar\u00edan",
-  "estaba",
-  "estabas",
-  "est\u00e1bamos",
-  "estabais",
-  "estaban",
-  "estuve",
-  "estuviste",
-  "estuvo",
-  "estuvimos",
-  "estuvisteis",
-  "estuvieron",
-  "estuviera",
-  "estuvieras",
-  "estuvi\u00e9ramos",
-  "estuvierais",
-  "estuvieran",
-  "estuviese",
-  "estuvieses",
-  "estuvi\u00e9semos",
-  "estuvieseis",
-  "estuviesen",
-  "estando",
-  "estado",
-  "estada",
-  "estados",
-  "estadas",
-  "estad",
-  "he",
-  "has",
-  "ha",
-  "hemos",
-  "hab\u00e9is",
-  "han",
-  "haya",
-  "hayas",
-  "hayamos",
-  "hay\u00e1is",
-  "hayan",
-  "habr\u00e9",
-  "habr\u00e1s",
-  "habr\u00e1",
-  "habremos",
-  "habr\u00e9is",
-  "habr\u00e1n",
-  "habr\u00eda",
-  "habr\u00edas",
-  "habr\u00edamos",
-  "habr\u00edais",
-  "habr\u00edan",
-  "hab\u00eda",
-  "hab\u00edas",
-  "hab\u00edamos",
-  "hab\u00edais",
-  "hab\u00edan",
-  "hube",
-  "hubiste",
-  "hubo",
-  "hubimos",
-  "hubisteis",
-  "hubieron",
-  "hubiera",
-  "hubieras",
-  "hubi\u00e9ramos",
-  "hubierais",
-  "hubieran",
-  "hubiese",
-  "hubieses",
-  "hubi\u00e9semos",
-  "hubieseis",
-  "hubiesen",
-  "habiendo",
-  "habido",
-  "habida",
-  "habidos",
-  "habidas",
-  "soy",
-  "eres",
-  "es",
-  "somos",
-  "sois",
-  "son",
-  "sea",
-  "seas",
-  "seamos",
-  "se\u00e1is",
-  "sean",
-  "ser\u00e9",
-  "ser\u00e1s",
-  "ser\u00e1",
-  "seremos",
-  "ser\u00e9is",
-  "ser\u00e1n",
-  "ser\u00eda",
-  "ser\u00edas",
-  "ser\u00edamos",
-  "ser\u00edais",
-  "ser\u00edan",
-  "era",
-  "eras",
-  "\u00e9ramos",
-  "erais",
-  "eran",
-  "fui",
-  "fuiste",
-  "fue",
-  "fuimos",
-  "fuisteis",
-  "fueron",
-  "fuera",
-  "fueras",
-  "fu\u00e9ramos",
-  "fuerais",
-  "fueran",
-  "fuese",
-  "fueses",
-  "fu\u00e9semos",
-  "fueseis",
-  "fuesen",
-  "sintiendo",
-  "sentido",
-  "sentida",
-  "sentidos",
-  "sentidas",
-  "siente",
-  "sentid",
-  "tengo",
-  "tienes",
-  "tiene",
-  "tenemos",
-  "ten\u00e9is",
-  "tienen",
-  "tenga",
-  "tengas",
-  "tengamos",
-  "teng\u00e1is",
-  "tengan",
-  "tendr\u00e9",
-  "tendr\u00e1s",
-  "tendr\u00e1",
-  "tendremos",
-  "tendr\u00e9is",
-  "tendr\u00e1n",
-  "tendr\u00eda",
-  "tendr\u00edas",
-  "tendr\u00edamos",
-  "tendr\u00edais",
-  "tendr\u00edan",
-  "ten\u00eda",
-  "ten\u00edas",
-  "ten\u00edamos",
-  "ten\u00edais",
-  "ten\u00edan",
-  "tuve",
-  "tuviste",
-  "tuvo",
-  "tuvimos",
-  "tuvisteis",
-  "tuvieron",
-  "tuviera",
-  "tuvieras",
-  "tuvi\u00e9ramos",
-  "tuvierais",
-  "tuvieran",
-  "tuviese",
-  "tuvieses",
-  "tuvi\u00e9semos",
-  "tuvieseis",
-  "tuviesen",
-  "teniendo",
-  "tenido",
-  "tenida",
-  "tenidos",
-  "tenidas",
-  "tened"
+namespace {
+
+const uint16_t kDisplacements[128] = {
+  1, 0, 12, 0, 0, 0, 0, 0, 3, 0, 2, 1,
+  0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 7, 1, 0, 0, 0, 5, 5,
+  0, 3, 0, 0, 0, 0, 2, 5, 3, 3, 0, 0,
+  1, 0, 1, 4, 2, 0, 0, 2, 1, 0, 3, 0,
+  5, 0, 0, 1, 0, 3, 1, 1, 13, 0, 3, 0,
+  0, 1, 4, 0, 9, 0, 0, 0, 4, 4, 9, 0,
+  1, 4, 2, 5, 1, 4, 6, 2, 0, 2, 4, 0,
+  10, 1, 3, 5, 4, 1, 1, 0, 6, 0, 8, 3,
+  1, 15, 15, 1, 4, 0, 2, 6, 5, 2, 0, 0,
+  0, 3, 3, 0, 12, 3, 0, 2,
+};
+
+const StopwordEntry kEntries[512] = {
+  {1385517099708599204ULL, "contra", 6},
+  {0, "", 0},
+  {10871340421459967369ULL, "ante", 4},
+  {0, "", 0},
+  {3341549755841333344ULL, "haya", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {16941611704035081025ULL, "vuestra", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {4464988431072497221ULL, "ser\u00edas", 7},
+  {6647367350330144424ULL, "estuvieras", 10},
+  {15292170522208496460ULL, "hubi\u00e9semos", 11},
+  {67594792876053503ULL, "tuviera", 7},
+  {0, "", 0},
+  {4443891682113844716ULL, "habr\u00e1n", 7},
+  {0, "", 0},
+  {3664597179646353495ULL, "fuiste", 6},
+  {0, "", 0},
+  {1311613803815768958ULL, "estadas", 7},
+  {11755131815534411619ULL, "tuvieran", 8},
+  {4443914771858037147ULL, "habr\u00e1s", 7},
+  {14128885395269646870ULL, "algunas", 7},
+  {7457215938422505707ULL, "estuvieses", 10},
+  {0, "", 0},
+  {7250765595231247060ULL, "unos", 4},
+  {16941605106965311759ULL, "vuestro", 7},
+  {0, "", 0},
+  {3699722595226062020ULL, "han", 3},
+  {0, "", 0},
+  {616489605729436484ULL, "el", 2},
+  {9703159257558597129ULL, "tuvo", 4},
+  {16136046506161676471ULL, "estaban", 7},
+  {18178062020187359154ULL, "sentid", 6},
+  {17864877755725914478ULL, "fu\u00e9ramos", 9},
+  {0, "", 0},
+  {7378917546298604796ULL, "ten\u00edamos", 9},
+  {0, "", 0},
+  {0, "", 0},
+  {14050412907856789013ULL, "era", 3},
+  {0, "", 0},
+  {17548961712507575431ULL, "sentido", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {17289686074466377667ULL, "est\u00e9is", 7},
+  {12932124132438076452ULL, "otras", 5},
+  {0, "", 0},
+  {12489974256175416828ULL, "hasta", 5},
+  {0, "", 0},
+  {17287949660832540971ULL, "cuando", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {8228621484807138495ULL, "m\u00eda", 4},
+  {0, "", 0},
+  {616491804752692906ULL, "en", 2},
+  {0, "", 0},
+  {8487158994158777271ULL, "estabais", 8},
+  {0, "", 0},
+  {11007442758551081276ULL, "ser\u00edais", 8},
+  {0, "", 0},
+  {2009504867348066691ULL, "qu\u00e9", 4},
+  {0, "", 0},
+  {8620069626955621788ULL, "hab\u00edas", 7},
+  {0, "", 0},
+  {3245116317039673293ULL, "seas", 4},
+  {8618581376772289206ULL, "por", 3},
+  {6705148349614808396ULL, "est\u00e1s", 6},
+  {6120411468985454984ULL, "estar\u00e1", 7},
+  {6276811824822388259ULL, "tus", 3},
+  {14274371363895145116ULL, "sentidos", 8},
+  {3193145475004216313ULL, "estada", 6},
+  {11508564573194497436ULL, "estar\u00edas", 9},
+  {0, "", 0},
+  {16136049804696561104ULL, "estabas", 7},
+  {0, "", 0},
+  {1325614207273652791ULL, "las", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {6681433831446135233ULL, "donde", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {17903675299201948649ULL, "se\u00e1is", 6},
+  {12826357706057783182ULL, "eres", 4},
+  {6705171439359000827ULL, "est\u00e1n", 6},
+  {12638193797625411262ULL, "o", 1},
+  {624121315939335235ULL, "mi", 2},
+  {12638182802509129152ULL, "e", 1},
+  {0, "", 0},
+  {0, "", 0},
+  {562074573767690308ULL, "durante", 7},
+  {264811231497383882ULL, "hayan", 5},
+  {5525265940316000737ULL, "una", 3},
+  {0, "", 0},
+  {14487651570706675314ULL, "habr\u00e9", 6},
+  {0, "", 0},
+  {1442474988420398143ULL, "fuese", 5},
+  {0, "", 0},
+  {7976527626615829895ULL, "estar\u00eda", 8},
+  {9709879472628898186ULL, "tuyo", 4},
+  {0, "", 0},
+  {6164018424464691374ULL, "t\u00fa", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {628910788590876226ULL, "ha", 2},
+  {9703165854628366395ULL, "tuve", 4},
+  {0, "", 0},
+  {12638187200555641996ULL, "a", 1},
+  {0, "", 0},
+  {9538827371713930243ULL, "tenidos", 7},
+  {0, "", 0},
+  {3245084431202455174ULL, "sean", 4},
+  {8620057532327711467ULL, "hab\u00edan", 7},
+  {620430255404187808ULL, "al", 2},
+  {0, "", 0},
+  {12662177507003342215ULL, "hab\u00eda", 6},
+  {15312751879891121009ULL, "otro", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {7911397844660962568ULL, "tiene", 5},
+  {5449764289294438248ULL, "tenida", 6},
+  {0, "", 0},
+  {3440417990733136349ULL, "todo", 4},
+  {4990775423904898541ULL, "estando", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {626942662776756986ULL, "no", 2},
+  {7980444087034760577ULL, "estar\u00e1s", 8},
+  {0, "", 0},
+  {17523769664960327930ULL, "tuvieseis", 9},
+  {5796945261793146973ULL, "ser\u00edamos", 9},
+  {0, "", 0},
+  {573160126162552208ULL, "mis", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {850355219536530371ULL, "como", 4},
+  {9279229203529193227ULL, "hube", 4},
+  {6645376134771832753ULL, "estuvieron", 10},
+  {1933894965718421200ULL, "estar\u00edamos", 11},
+  {643261614359447823ULL, "ya", 2},
+  {6647346459609208415ULL, "estuvieran", 10},
+  {748731447414428696ULL, "tenga", 5},
+  {0, "", 0},
+  {625218628544100588ULL, "lo", 2},
+  {14628917906078009660ULL, "tendr\u00e1n", 8},
+  {12557357489509899839ULL, "tuvieses", 8},
+  {16078745573326537235ULL, "estas", 5},
+  {7394364405290127689ULL, "mucho", 5},
+  {14264810010778114510ULL, "sentidas", 8},
+  {7525741398734789084ULL, "nuestros", 8},
+  {624134510078873767ULL, "me", 2},
+  {12771226445623521330ULL, "tendr\u00edas", 9},
+  {0, "", 0},
+  {616497302310833961ULL, "es", 2},
+  {13114409382943931663ULL, "estuvierais", 11},
+  {0, "", 0},
+  {6816347736243792978ULL, "tienen", 6},
+  {0, "", 0},
+  {16168885735612744287ULL, "est\u00e9", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {637614522638091477ULL, "su", 2},
+  {2874866685762380497ULL, "seremos", 7},
+  {0, "", 0},
+  {304353024649678871ULL, "hubi\u00e9ramos", 11},
+  {9540533813760535265ULL, "tenidas", 7},
+  {16727263906126882990ULL, "estuvieseis", 11},
+  {0, "", 0},
+  {0, "", 0},
+  {14164254786748738849ULL, "teniendo", 8},
+  {16080722495233682163ULL, "estoy", 5},
+  {0, "", 0},
+  {8896868215107042072ULL, "estar\u00e9is", 9},
+  {12987535873799847226ULL, "fuerais", 7},
+  {2872234120783552087ULL, "estuvisteis", 11},
+  {15893320840087658003ULL, "fue", 3},
+  {1678032739027949153ULL, "hayamos", 7},
+  {15504968421271916715ULL, "fuisteis", 8},
+  {0, "", 0},
+  {9531694997454163098ULL, "s\u00ed", 3},
+  {17727559123131786283ULL, "con", 3},
+  {0, "", 0},
+  {13595082360239933318ULL, "este", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {141896978700707240ULL, "ten\u00edas", 7},
+  {0, "", 0},
+  {8103613806356151881ULL, "\u00e9ramos", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {17433372277777865728ULL, "fuimos", 6},
+  {14051505822415041522ULL, "eso", 3},
+  {0, "", 0},
+  {10958072810918159633ULL, "tanto", 5},
+  {4230073396998955208ULL, "fueran", 6},
+  {13991079933129559381ULL, "hay\u00e1is", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {4032527759796960725ULL, "habiendo", 8},
+  {17548950717391293321ULL, "sentida", 7},
+  {0, "", 0},
+  {68755877155255094ULL, "tuviese", 7},
+  {6210904276185279033ULL, "quienes", 7},
+  {883771370189819878ULL, "sobre", 5},
+  {5449762090271181826ULL, "tenido", 6},
+  {0, "", 0},
+  {8579702464466728858ULL, "estuviese", 9},
+  {6152319710371391658ULL, "nosotras", 8},
+  {9256793223030397455ULL, "ten\u00edais", 8},
+  {15890058096677607039ULL, "habidos", 7},
+  {0, "", 0},
+  {11077115754358230014ULL, "habremos", 8},
+  {12830312649383701249ULL, "eran", 4},
+  {12771249535367713761ULL, "tendr\u00edan", 9},
+  {16078124586806145308ULL, "tuvi\u00e9semos", 11},
+  {3187546761794501251ULL, "estaba", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {4239643546209011502ULL, "fueron", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {8855523353593513358ULL, "muchos", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {4097647793850012950ULL, "habr\u00e9is", 8},
+  {2173519727816922548ULL, "vuestros", 8},
+  {626093839799967319ULL, "os", 2},
+  {10086358980946824482ULL, "poco", 4},
+  {2550995827827794905ULL, "ser\u00e1", 5},
+  {9557015007764435902ULL, "algo", 4},
+  {2733835159340103879ULL, "nuestro", 7},
+  {13162726594045300447ULL, "suya", 4},
+  {9387930553559073965ULL, "sin", 3},
+  {15899628245887663333ULL, "habidas", 7},
+  {11835573607409113770ULL, "todos", 5},
+  {1677081688087365114ULL, "tambi\u00e9n", 8},
+  {1321175156932799564ULL, "estados", 7},
+  {0, "", 0},
+  {264816729055524937ULL, "hayas", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {16080733490349964273ULL, "estos", 5},
+  {5892515272757847466ULL, "hubieseis", 9},
+  {5040184244713674277ULL, "erais", 5},
+  {14396903742914329624ULL, "ellas", 5},
+  {17657724355040887938ULL, "tengan", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13162733191115069713ULL, "suyo", 4},
+  {0, "", 0},
+  {1853573547961863873ULL, "ser\u00e9is", 7},
+  {643268211429217089ULL, "yo", 2},
+  {16145792589657874971ULL, "tuyos", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {5363514899995599739ULL, "estar\u00edais", 10},
+  {0, "", 0},
+  {0, "", 0},
+  {11755126317976270564ULL, "tuvieras", 8},
+  {1715904397152820337ULL, "habr\u00edan", 8},
+  {0, "", 0},
+  {0, "", 0},
+  {7980420997290568146ULL, "estar\u00e1n", 8},
+  {0, "", 0},
+  {9709864079466103232ULL, "tuya", 4},
+  {3672991537066065315ULL, "fuesen", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {13281336556777411855ULL, "hubieses", 8},
+  {0, "", 0},
+  {2274681534379771939ULL, "tuvisteis", 9},
+  {0, "", 0},
+  {2403463257090070219ULL, "nos", 3},
+  {9389900878396449627ULL, "son", 3},
+  {0, "", 0},
+  {4034920191654943674ULL, "tendr\u00e1", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {141876087979771231ULL, "ten\u00edan", 7},
+  {617365916496931426ULL, "de", 2},
+  {12525282129067958219ULL, "ten\u00eda", 6},
+  {0, "", 0},
+  {6185214150914464222ULL, "ser\u00e1s", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {3398761892248718940ULL, "estuvimos", 9},
+  {442117604502379363ULL, "tuvierais", 9},
+  {0, "", 0},
+  {0, "", 0},
+  {8363121878745938851ULL, "fueseis", 7},
+  {5433516071369787861ULL, "quien", 5},
+  {2686138663152452837ULL, "seamos", 6},
+  {0, "", 0},
+  {6936359370897125419ULL, "sois", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {11508552478566587115ULL, "estar\u00edan", 9},
+  {9384228497907644428ULL, "sea", 3},
+  {9389888783768539306ULL, "soy", 3},
+  {632816253893524798ULL, "ti", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {8578532584094501579ULL, "estuviera", 9},
+  {8905425538195917684ULL, "habida", 6},
+  {4896209213345793744ULL, "hab\u00edamos", 9},
+  {626936065706987720ULL, "ni", 2},
+  {1626284230257420043ULL, "estuvi\u00e9ramos", 13},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {13595086758286446162ULL, "esta", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {17282874385193206955ULL, "estemos", 7},
+  {16124131372591756849ULL, "pero", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {6354485979733887445ULL, "vosostros", 9},
+  {11605078638149121925ULL, "tendr\u00edais", 10},
+  {6697571614986320195ULL, "est\u00e9n", 6},
+  {3672986039507924260ULL, "fueses", 6},
+  {3699739087900485185ULL, "hay", 3},
+  {1329264585878556411ULL, "les", 3},
+  {0, "", 0},
+  {9635122447612439087ULL, "porque", 6},
+  {13595088957309702584ULL, "esto", 4},
+  {4034911395561917986ULL, "tendr\u00e9", 7},
+  {6139063998184328992ULL, "nosotros", 8},
+  {8217092005875988649ULL, "m\u00e1s", 4},
+  {266013703991078795ULL, "para", 4},
+  {16141246034647798850ULL, "tendr\u00edamos", 11},
+  {15893334034227196535ULL, "fui", 3},
+  {0, "", 0},
+  {747034900972477573ULL, "tened", 5},
+  {631726637870156922ULL, "un", 2},
+  {569239267697108682ULL, "muy", 3},
+  {14487660366799701002ULL, "habr\u00e1", 6},
+  {5500417490484433888ULL, "cual", 4},
+  {7516180045617758478ULL, "nuestras", 8},
+  {12638213588834719060ULL, "y", 1},
+  {0, "", 0},
+  {0, "", 0},
+  {16542547331919001527ULL, "est\u00e1bamos", 10},
+  {0, "", 0},
+  {628906390544363382ULL, "he", 2},
+  {7457228033050416028ULL, "estuviesen", 10},
+  {982366034823471494ULL, "suyos", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {14826061008035062563ULL, "estuviste", 9},
+  {12830289559639508818ULL, "eras", 4},
+  {1270717369627086356ULL, "sintiendo", 9},
+  {7040307979314818895ULL, "estamos", 7},
+  {2733824164223821769ULL, "nuestra", 7},
+  {0, "", 0},
+  {6120402672892429296ULL, "estar\u00e9", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {16895288266923020339ULL, "hubisteis", 9},
+  {11484463941359269055ULL, "tuviste", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {9149194998108362747ULL, "ella", 4},
+  {0, "", 0},
+  {13572856832191628339ULL, "esos", 4},
+  {16168894531705769975ULL, "est\u00e1", 5},
+  {0, "", 0},
+  {222628653012915300ULL, "tenemos", 7},
+  {0, "", 0},
+  {16132264198587015977ULL, "tuyas", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {12785320473151622291ULL, "hubieran", 8},
+  {0, "", 0},
+  {17224785179320631346ULL, "habr\u00edamos", 10},
+  {12001691807836151149ULL, "teng\u00e1is", 8},
+  {14123282284013418964ULL, "algunos", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {1693404221704210633ULL, "tengamos", 8},
+  {0, "", 0},
+  {10537515242364004711ULL, "tuvi\u00e9ramos", 11},
+  {1715916491780730658ULL, "habr\u00edas", 8},
+  {2199727874539167396ULL, "m\u00edas", 5},
+  {0, "", 0},
+  {8815224878980487631ULL, "hubiera", 7},
+  {674695626961267364ULL, "m\u00ed", 3},
+  {0, "", 0},
+  {8228628081876907761ULL, "m\u00edo", 4},
+  {4198889109203325907ULL, "hubierais", 9},
+  {0, "", 0},
+  {14051508021438297944ULL, "esa", 3},
+  {7310965617394419385ULL, "siente", 6},
+  {15276913405949841358ULL, "antes", 5},
+  {14051512419484810788ULL, "ese", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {197232948134279983ULL, "hubiste", 7},
+  {13541188399872361000ULL, "tuvimos", 7},
+  {4230052506278019199ULL, "fueras", 6},
+  {3790242949095938635ULL, "est\u00e1is", 7},
+  {0, "", 0},
+  {12557378380230835848ULL, "tuviesen", 8},
+  {14599020831672759754ULL, "del", 3},
+  {976481448590421572ULL, "suyas", 5},
+  {3193156470120498423ULL, "estado", 6},
+  {0, "", 0},
+  {2205330985795395302ULL, "m\u00edos", 5},
+  {4465009321793433230ULL, "ser\u00edan", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {1785392219252476795ULL, "hab\u00edais", 8},
+  {0, "", 0},
+  {0, "", 0},
+  {16282240646957193742ULL, "tendremos", 9},
+  {0, "", 0},
+  {0, "", 0},
+  {625225225613869854ULL, "la", 2},
+  {0, "", 0},
+  {6697566117428179140ULL, "est\u00e9s", 6},
+  {5525259343246231471ULL, "uno", 3},
+  {16078744473814909024ULL, "estar", 5},
+  {9279222606459423961ULL, "hubo", 4},
+  {15336760907521248870ULL, "tendr\u00e9is", 9},
+  {0, "", 0},
+  {0, "", 0},
+  {14167723796098235527ULL, "nada", 4},
+  {0, "", 0},
+  {3978825134529931488ULL, "somos", 5},
+  {0, "", 0},
+  {0, "", 0},
+  {0, "", 0},
+  {7706698507622820096ULL, "desde", 5},
+  {0, "", 0},
+  {637596930452040101ULL, "se", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {10719493883149120477ULL, "estuvo", 6},
+  {9399447937862313490ULL, "sus", 3},
+  {12785350159965583988ULL, "hubieras", 8},
+  {0, "", 0},
+  {1443354597722777718ULL, "fuera", 5},
+  {0, "", 0},
+  {4432350108554784549ULL, "habr\u00eda", 7},
+  {0, "", 0},
+  {0, "", 0},
+  {13281322263126245112ULL, "hubiesen", 8},
+  {5315076275759254997ULL, "habr\u00edais", 9},
+  {3891506522322340049ULL, "fu\u00e9semos", 9},
+  {6185228444565630965ULL, "ser\u00e1n", 6},
+  {16078768663070729666ULL, "estad", 5},
+  {1319703232761525805ULL, "los", 3},
+  {0, "", 0},
+  {0, "", 0},
+  {2768792985533523868ULL, "ten\u00e9is", 7},
+  {6196778814217716820ULL, "ser\u00eda", 6},
+  {14628905811450099339ULL, "tendr\u00e1s", 8},
+  {13574844749215055377ULL, "esas", 4},
+  {0, "", 0},
+  {0, "", 0},
+  {748729248391172274ULL, "tengo", 5},
+  {632811855847011954ULL, "te", 2},
+  {11761042790046538605ULL, "tuvieron", 8},
+  {6911775404055049015ULL, "\u00e9l", 3},
+  {12937727243694304358ULL, "otros", 5},
+  {2179122839073150454ULL, "vuestras", 8},
+  {3872438525385863288ULL, "hubimos", 7},
+  {0, "", 0},
+  {14395206096960750290ULL, "ellos", 5},
+  {17657712260412977617ULL, "tengas", 6},
+  {3699728092784203075ULL, "has", 3},
+  {10719482888032838367ULL, "estuve", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {13702942659214891175ULL, "entre", 5},
+  {8905414543079635574ULL, "habido", 6},
+  {0, "", 0},
+  {0, "", 0},
+  {14617376332518949493ULL, "tendr\u00eda", 8},
+  {6008373268868166424ULL, "hab\u00e9is", 7},
+  {6344915830523831151ULL, "vosostras", 9},
+  {6816370825987985409ULL, "tienes", 6},
+  {2551004623920820593ULL, "ser\u00e9", 5},
+  {12356774870211165659ULL, "hemos", 5},
+  {2979445709952178856ULL, "estuvi\u00e9semos", 13},
+  {0, "", 0},
+  {632829448033063330ULL, "tu", 2},
+  {0, "", 0},
+  {0, "", 0},
+  {14480068259354434488ULL, "estaremos", 9},
+  {0, "", 0},
+  {0, "", 0},
+  {8113014935145751146ULL, "que", 3},
+  {0, "", 0},
+  {625229623660382698ULL, "le", 2},
+  {0, "", 0},
+  {12791231447663749277ULL, "hubieron", 8},
+  {0, "", 0},
+  {15312745282821351743ULL, "otra", 4},
+  {8816034119538661702ULL, "hubiese", 7},
 };
 
-bool isSpanishStopword(const string &word) {
-  return stopwordSet.count(word) > 0;
+} // anonymous namespace
+
+const StopwordTable kSpanishStopwords {
+  kDisplacements, 127, kEntries, 9
+};
+
+bool isSpanishStopword(const text_util::StringView &word, uint64_t hash) {
+  return kSpanishStopwords.contains(word, hash);
 }
 
 } // stopwords
 } // relevanced
-
@@ -1,8 +1,12 @@
 #include "gtest/gtest.h"
 #include "stopwords/StopwordFilter.h"
+#include "text_util/fnv.h"
+#include "text_util/StringView.h"
 #include "gen-cpp2/RelevancedProtocol_types.h"
 using namespace std;
 using relevanced::stopwords::StopwordFilter;
+using relevanced::text_util::StringView;
+using relevanced::text_util::fnv1a64;
 using relevanced::thrift_protocol::Language;
 
 TEST(TestStopwordFilter, EnglishSmattering) {
@@ -25,3 +29,35 @@ TEST(TestStopwordFilter, NonStopwords) {
   EXPECT_FALSE(filter.isStopword("elephant", Language::EN));
   EXPECT_FALSE(filter.isStopword("amusingly", Language::EN));
 }
+
+TEST(TestStopwordFilter, OtherLanguages) {
+  StopwordFilter filter;
+  EXPECT_TRUE(filter.isStopword("und", Language::DE));
+  EXPECT_TRUE(filter.isStopword("daß", Language::DE));
+  EXPECT_TRUE(filter.isStopword("avec", Language::FR));
+  EXPECT_TRUE(filter.isStopword("été", Language::FR));
+  EXPECT_TRUE(filter.isStopword("della", Language::IT));
+  EXPECT_TRUE(filter.isStopword("этот", Language::RU));
+  EXPECT_TRUE(filter.isStopword("para", Language::ES));
+  EXPECT_FALSE(filter.isStopword("und", Language::EN));
+  EXPECT_FALSE(filter.isStopword("elefant", Language::DE));
+}
+
+TEST(TestStopwordFilter, PrecomputedHash) {
+  StopwordFilter filter;
+  string text = "xxthe elephant";
+  StringView the(text.data() + 2, 3);
+  EXPECT_TRUE(filter.isStopword(the, fnv1a64(the.base, the.len), Language::EN));
+  StringView elephant(text.data() + 6, 8);
+  EXPECT_FALSE(filter.isStopword(
+    elephant, fnv1a64(elephant.base, elephant.len), Language::EN
+  ));
+
+  // a prefix of a stopword is not a stopword.
+  StringView th(text.data() + 2, 2);
+  StringView thel(text.data() + 2, 4);
+  EXPECT_FALSE(filter.isStopword(
+    thel, fnv1a64(thel.base, thel.len), Language::EN
+  ));
+  EXPECT_TRUE(filter.isStopword(th, fnv1a64(th.base, th.len), Language::EN));
+}
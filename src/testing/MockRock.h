@@ -3,6 +3,7 @@
 #include <string>
 #include <rocksdb/db.h>
 #include <rocksdb/slice.h>
+#include <rocksdb/write_batch.h>
 #include "persistence/RockHandle.h"
 #include "gmock/gmock.h"
 
@@ -13,8 +14,10 @@ class MockRock : public relevanced::persistence::RockHandleIf {
   MOCK_METHOD2(put, bool(string, rocksdb::Slice));
   MOCK_METHOD1(get, string(const string &));
   MOCK_METHOD2(get, bool(const string &, string &));
+  MOCK_METHOD1(multiGet, vector<folly::Optional<string>>(const vector<string> &));
   MOCK_METHOD1(exists, bool(const string &));
   MOCK_METHOD1(del, bool(const string &));
+  MOCK_METHOD2(write, bool(rocksdb::WriteBatch &, bool));
   MOCK_METHOD0(eraseEverything, bool());
   MOCK_METHOD0(getStatsDump, string());
   bool iterRange(const std::string&,
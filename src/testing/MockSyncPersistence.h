@@ -38,6 +38,8 @@ class MockSyncPersistence : public persistence::SyncPersistenceIf {
   MOCK_METHOD2(listDocumentRangeFromOffset, vector<string>(size_t, size_t));
 
   MOCK_METHOD1(loadDocument, Try<shared_ptr<ProcessedDocument>>(const string&));
+  MOCK_METHOD1(loadDocuments,
+    vector<Try<shared_ptr<ProcessedDocument>>>(const vector<string>&));
 
   MOCK_METHOD1(doesCentroidExist, bool(const string&));
   MOCK_METHOD1(createNewCentroid, Try<bool>(const string&));
@@ -78,4 +80,8 @@ class MockSyncPersistence : public persistence::SyncPersistenceIf {
   MOCK_METHOD3(setCentroidMetadata,
                Try<bool>(const string&, const string&, string));
   MOCK_METHOD0(debugEraseAllData, void());
+  MOCK_METHOD1(takeCentroidDocumentChanges,
+               CentroidDocumentChanges(const string&));
+  MOCK_METHOD2(finishCentroidUpdate, void(const string&, bool));
+  MOCK_METHOD1(invalidateCentroidDocumentChanges, void(const string&));
 };
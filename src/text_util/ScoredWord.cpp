@@ -1,39 +1,37 @@
 #include "text_util/ScoredWord.h"
+#include "text_util/StringView.h"
+#include "text_util/TermDictionary.h"
 
-#include <cstring>
+#include <string>
 
 namespace relevanced {
 namespace text_util {
 
-ScoredWord::ScoredWord(const char *wordSource, uint8_t length, double wordScore) {
+static_assert(sizeof(ScoredWord) == 8,
+  "ScoredWord should stay a packed (term id, weight) pair");
+
+ScoredWord::ScoredWord(const char *wordSource, size_t length, double wordScore) {
   assignWord(wordSource, length);
-  score = wordScore;
+  score = (float) wordScore;
 }
 
-ScoredWord::ScoredWord(const char *wordSource, uint8_t length) {
+ScoredWord::ScoredWord(const char *wordSource, size_t length) {
   assignWord(wordSource, length);
 }
 
+ScoredWord::ScoredWord(uint32_t termId, double wordScore)
+  : termId(termId), score((float) wordScore) {}
+
 ScoredWord::ScoredWord(){}
 
-void ScoredWord::assignWord(const char *wordSource, uint8_t length) {
-  if (length > 23) {
-    length = 23;
-  }
-  strncpy(word, wordSource, length);
-  if (length > 22) {
-    word[22] = '\0';
-  } else {
-    word[length] = '\0';
-  }
-  char cLen = (char) length;
-  word[23] = cLen;
+void ScoredWord::assignWord(const char *wordSource, size_t length) {
+  termId = TermDictionary::getDefault()->getId(
+    StringView(wordSource, length)
+  );
 }
 
-size_t ScoredWord::getSize() {
-  char cLen = word[23];
-  size_t len = (size_t) cLen;
-  return len;
+std::string ScoredWord::getWord() const {
+  return TermDictionary::getDefault()->getTerm(termId);
 }
 
 } // text_util
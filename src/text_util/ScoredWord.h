@@ -2,18 +2,31 @@
 
 #include <cstring>
 #include <cstdint>
+#include <string>
 
 namespace relevanced {
 namespace text_util {
 
+/**
+ * A term and its weight within a single document.
+ *
+ * The term itself lives in the default `TermDictionary`; a
+ * record only carries its id, so it is eight bytes regardless
+ * of how long the stem is.  Weights are stored as `float`:
+ * they are normalized term frequencies, and anything summed
+ * over many of them is accumulated in `double`.
+ */
 struct ScoredWord {
-  char word[24];
-  double score {1.0};
+  uint32_t termId {0};
+  float score {1.0};
   ScoredWord();
-  ScoredWord(const char *wordSource, uint8_t length);
-  ScoredWord(const char *wordSource, uint8_t length, double score);
-  void assignWord(const char *wordSource, uint8_t length);
-  size_t getSize();
+  ScoredWord(uint32_t termId, double score);
+  ScoredWord(const char *wordSource, size_t length);
+  ScoredWord(const char *wordSource, size_t length, double score);
+  void assignWord(const char *wordSource, size_t length);
+
+  // looks the term up in the default dictionary.
+  std::string getWord() const;
 };
 
 } // text_util
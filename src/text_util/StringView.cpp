@@ -4,7 +4,10 @@ namespace relevanced {
 namespace text_util {
 
 bool operator==(const StringView &sv1, const StringView &sv2) {
-  return strncmp(sv1.base, sv2.base, sv1.len - 1) == 0;
+  if (sv1.len != sv2.len) {
+    return false;
+  }
+  return memcmp(sv1.base, sv2.base, sv1.len) == 0;
 }
 
 }
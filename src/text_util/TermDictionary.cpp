@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include <folly/Optional.h>
+#include <folly/SharedMutex.h>
+
+#include "text_util/TermDictionary.h"
+#include "text_util/StringView.h"
+
+using namespace std;
+using namespace folly;
+
+namespace relevanced {
+namespace text_util {
+
+const uint32_t TermDictionary::kNoTerm;
+
+uint32_t TermDictionary::getId(const StringView &term) {
+  {
+    SharedMutex::ReadHolder guard(mutex_);
+    auto existing = idsByTerm_.find(term);
+    if (existing != idsByTerm_.end()) {
+      return existing->second;
+    }
+  }
+  SharedMutex::WriteHolder guard(mutex_);
+
+  // another thread may have inserted the term while
+  // we were waiting on the write lock.
+  auto existing = idsByTerm_.find(term);
+  if (existing != idsByTerm_.end()) {
+    return existing->second;
+  }
+  terms_.emplace_back(term.base, term.len);
+  auto &stored = terms_.back();
+  uint32_t termId = terms_.size();
+  idsByTerm_.insert(make_pair(
+    StringView(stored.data(), stored.size()), termId
+  ));
+  return termId;
+}
+
+uint32_t TermDictionary::getId(const string &term) {
+  return getId(StringView(term.data(), term.size()));
+}
+
+Optional<uint32_t> TermDictionary::findId(const StringView &term) {
+  Optional<uint32_t> result;
+  SharedMutex::ReadHolder guard(mutex_);
+  auto existing = idsByTerm_.find(term);
+  if (existing != idsByTerm_.end()) {
+    result.assign(existing->second);
+  }
+  return result;
+}
+
+Optional<uint32_t> TermDictionary::findId(const string &term) {
+  return findId(StringView(term.data(), term.size()));
+}
+
+string TermDictionary::getTerm(uint32_t termId) {
+  SharedMutex::ReadHolder guard(mutex_);
+  if (termId == kNoTerm) {
+    throw std::out_of_range("term id 0 is reserved");
+  }
+  return terms_.at(termId - 1);
+}
+
+size_t TermDictionary::size() {
+  SharedMutex::ReadHolder guard(mutex_);
+  return terms_.size();
+}
+
+shared_ptr<TermDictionary> TermDictionary::getDefault() {
+  static shared_ptr<TermDictionary> dictionary =
+      std::make_shared<TermDictionary>();
+  return dictionary;
+}
+
+} // text_util
+} // relevanced
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <folly/Optional.h>
+#include <folly/SharedMutex.h>
+
+#include "text_util/StringView.h"
+
+namespace relevanced {
+namespace text_util {
+
+/**
+ * Process-wide mapping of stemmed terms to dense integer ids.
+ *
+ * Every distinct stem is stored once and assigned a `uint32_t`
+ * id the first time it is seen.  Documents, accumulators and
+ * centroids then carry ids instead of strings, so the scoring
+ * hot paths hash and compare integers.
+ *
+ * Ids are only meaningful within a single process: anything that
+ * is persisted is translated back to term strings on the way out
+ * and re-interned on the way in.
+ *
+ * Terms are never evicted, so only text that is stored (documents
+ * and centroids) is interned; text that is just scored is looked
+ * up with `findId`.  Id `0` is reserved to mean "no term".
+ */
+class TermDictionary {
+  folly::SharedMutex mutex_;
+  std::deque<std::string> terms_;
+  std::unordered_map<StringView, uint32_t> idsByTerm_;
+
+ public:
+  static const uint32_t kNoTerm = 0;
+
+  uint32_t getId(const StringView &term);
+  uint32_t getId(const std::string &term);
+  folly::Optional<uint32_t> findId(const StringView &term);
+  folly::Optional<uint32_t> findId(const std::string &term);
+  std::string getTerm(uint32_t termId);
+  size_t size();
+
+  static std::shared_ptr<TermDictionary> getDefault();
+};
+
+} // text_util
+} // relevanced
@@ -1,56 +1,177 @@
+#include <algorithm>
 #include <vector>
-#include <unordered_map>
 #include <cmath>
+#include <cstring>
 #include "text_util/WordAccumulator.h"
-#include "models/ProcessedDocument.h"
 #include "text_util/ScoredWord.h"
 #include "text_util/StringView.h"
+#include "text_util/TermDictionary.h"
+#include "text_util/fnv.h"
 
 using namespace std;
 
 namespace relevanced {
 namespace text_util {
 
-using models::ProcessedDocument;
+static size_t slotCountFor(size_t wordCount) {
+  // keeps the table at most half full.
+  size_t count = 16;
+  while (count < 2 * wordCount) {
+    count *= 2;
+  }
+  return count;
+}
 
 WordAccumulator::WordAccumulator(size_t sizeHint) {
   scoredWords_.reserve(sizeHint);
+  isBigram_.reserve(sizeHint);
+  slots_.resize(slotCountFor(sizeHint));
+  slotMask_ = slots_.size() - 1;
+  keys_.reserve(8 * sizeHint);
 }
 
 void WordAccumulator::add(const StringView &word) {
-  totalWords_++;
-  auto existingIndex = wordsByStr_.find(word);
-  if (existingIndex == wordsByStr_.end()) {
-    ScoredWord scored(word.base, (uint8_t) word.len);
-    scoredWords_.push_back(scored);
-    wordsByStr_.insert(make_pair(word, scoredWords_.size() - 1));
+  add_(word, fnv1a64(word.base, word.len), false);
+}
+
+void WordAccumulator::add(const StringView &word, uint64_t hash) {
+  add_(word, hash, false);
+}
+
+void WordAccumulator::addBigram(const StringView &term) {
+  add_(term, fnv1a64(term.base, term.len), true);
+}
+
+void WordAccumulator::insertSlot(const Slot &slot) {
+  size_t idx = slot.hash & slotMask_;
+  while (slots_[idx].generation == generation_) {
+    idx = (idx + 1) & slotMask_;
+  }
+  slots_[idx] = slot;
+}
+
+void WordAccumulator::grow() {
+  vector<Slot> old;
+  old.swap(slots_);
+  slots_.resize(old.size() * 2);
+  slotMask_ = slots_.size() - 1;
+  for (auto &slot : old) {
+    if (slot.generation == generation_) {
+      insertSlot(slot);
+    }
+  }
+}
+
+void WordAccumulator::add_(const StringView &word, uint64_t hash,
+                           bool isBigram) {
+  if (isBigram) {
+    totalBigrams_++;
   } else {
-    auto existing = &scoredWords_.at(existingIndex->second);
-    existing->score += 1;
+    totalWords_++;
+  }
+  size_t idx = hash & slotMask_;
+  while (slots_[idx].generation == generation_) {
+    auto &slot = slots_[idx];
+    if (slot.hash == hash && slot.keyLength == word.len &&
+        memcmp(keys_.data() + slot.keyOffset, word.base, word.len) == 0) {
+      scoredWords_[slot.wordIndex].score += 1;
+      return;
+    }
+    idx = (idx + 1) & slotMask_;
+  }
+  Slot slot;
+  slot.hash = hash;
+  slot.keyOffset = (uint32_t) keys_.size();
+  slot.keyLength = (uint32_t) word.len;
+  slot.wordIndex = (uint32_t) scoredWords_.size();
+  slot.generation = generation_;
+  keys_.insert(keys_.end(), word.base, word.base + word.len);
+  if (internTerms_) {
+    scoredWords_.push_back(ScoredWord(word.base, word.len));
+  } else {
+    ScoredWord scored;
+    auto termId = TermDictionary::getDefault()->findId(word);
+    if (termId.hasValue()) {
+      scored.termId = termId.value();
+    }
+    scoredWords_.push_back(scored);
+  }
+  isBigram_.push_back(isBigram);
+  slots_[idx] = slot;
+  if (2 * scoredWords_.size() > slots_.size()) {
+    grow();
   }
 }
 
 void WordAccumulator::build() {
   double dTotal = (double) totalWords_;
+  double dBigrams = (double) totalBigrams_;
   magnitude_ = 0.0;
-  for (auto &elem: scoredWords_) {
-    double normalized = elem.score / dTotal;
-    elem.score = normalized;
-    magnitude_ += pow(normalized, 2);
+  for (size_t i = 0; i < scoredWords_.size(); i++) {
+    // `score` holds the raw count until now.  The magnitude is
+    // taken over the stored (float) weights so that it matches
+    // the vector that is actually scored.
+    auto &elem = scoredWords_[i];
+    double total = isBigram_[i] ? dBigrams : dTotal;
+    elem.score = (float) (elem.score / total);
+    magnitude_ += pow((double) elem.score, 2);
   }
   magnitude_ = sqrt(magnitude_);
+  std::sort(scoredWords_.begin(), scoredWords_.end(),
+    [](const ScoredWord &w1, const ScoredWord &w2) {
+      return w1.termId < w2.termId;
+    }
+  );
+
+  // words the dictionary didn't know sort first.
+  auto known = scoredWords_.begin();
+  while (known != scoredWords_.end() &&
+      known->termId == TermDictionary::kNoTerm) {
+    ++known;
+  }
+  scoredWords_.erase(scoredWords_.begin(), known);
+}
+
+void WordAccumulator::setInternTerms(bool internTerms) {
+  internTerms_ = internTerms;
 }
 
 double WordAccumulator::getMagnitude() {
   return magnitude_;
 }
 
-vector<ScoredWord>&& WordAccumulator::getScores() {
-  return std::move(scoredWords_);
+const vector<ScoredWord>& WordAccumulator::getScores() {
+  return scoredWords_;
 }
 
+size_t WordAccumulator::size() {
+  return scoredWords_.size();
+}
 
+void WordAccumulator::reset() {
+  totalWords_ = 0;
+  totalBigrams_ = 0;
+  magnitude_ = 0.0;
+  if (scoredWords_.capacity() > kMaxRetainedWords) {
+    vector<ScoredWord>().swap(scoredWords_);
+    vector<bool>().swap(isBigram_);
+    vector<Slot>(slotCountFor(0)).swap(slots_);
+    slotMask_ = slots_.size() - 1;
+  }
+  if (keys_.capacity() > kMaxRetainedKeyBytes) {
+    vector<char>().swap(keys_);
+  }
+  scoredWords_.clear();
+  isBigram_.clear();
+  keys_.clear();
+  generation_++;
+  if (generation_ == 0) {
+    // every slot's generation is now stale or zero; zero them all
+    // so that none can be mistaken for the restarted counter.
+    memset(slots_.data(), 0, slots_.size() * sizeof(Slot));
+    generation_ = 1;
+  }
+}
 
 } // text_util
 } // relevanced
-
@@ -1,26 +1,89 @@
 #pragma once
+#include <cstdint>
 #include <vector>
-#include <unordered_map>
-#include "models/ProcessedDocument.h"
 #include "text_util/ScoredWord.h"
 #include "text_util/StringView.h"
 
 namespace relevanced {
 namespace text_util {
 
+/**
+ * Counts the distinct words of a document and turns the counts
+ * into normalized `ScoredWord`s.
+ *
+ * Words are looked up in a flat open-addressing table keyed by
+ * their `fnv1a64` hash.  Key bytes are copied into a single
+ * growable buffer and referenced by offset, so words can be added
+ * from buffers that are reused or freed before `build()` (see
+ * `DocumentUpload`).
+ *
+ * `reset()` empties the accumulator but keeps its buffers, so an
+ * accumulator that is reused from document to document (see
+ * `DocumentProcessor`) stops allocating once it has seen a
+ * document of typical size.
+ *
+ * With `setInternTerms(false)`, words are only looked up in the
+ * `TermDictionary`.  Words it doesn't know still count towards the
+ * magnitude, but are dropped from the scores by `build()`: text
+ * that is only scored can't grow the dictionary, and an unknown
+ * term can't match any centroid anyway.
+ *
+ * Bigram features (see `text_util/bigrams.h`) are added with
+ * `addBigram()` and normalized by the number of bigrams rather
+ * than the number of words, so turning bigrams on leaves every
+ * word's score unchanged.
+ */
 class WordAccumulator {
+  struct Slot {
+    uint64_t hash;
+    uint32_t keyOffset;
+    uint32_t keyLength;
+    uint32_t wordIndex;
+
+    // a slot whose generation isn't the accumulator's current one
+    // is empty; this makes `reset()` O(1).
+    uint32_t generation;
+  };
+
   size_t totalWords_ {0};
+  size_t totalBigrams_ {0};
   double magnitude_ {0.0};
   std::vector<ScoredWord> scoredWords_;
-  std::unordered_map<StringView, size_t> wordsByStr_;
+
+  // parallel to `scoredWords_` until `build()`.
+  std::vector<bool> isBigram_;
+  std::vector<Slot> slots_;
+  size_t slotMask_ {0};
+  uint32_t generation_ {1};
+  std::vector<char> keys_;
+  bool internTerms_ {true};
+
+  void grow();
+  void insertSlot(const Slot &slot);
+  void add_(const StringView &word, uint64_t hash, bool isBigram);
 public:
+  // buffers bigger than this are released by `reset()` rather than
+  // kept around, so one huge document doesn't pin its memory.
+  static const size_t kMaxRetainedWords = 1 << 16;
+  static const size_t kMaxRetainedKeyBytes = 1 << 20;
+
   WordAccumulator(size_t sizeHint);
   void add(const StringView &word);
+
+  // `hash` must be `fnv1a64(word.base, word.len)`.
+  void add(const StringView &word, uint64_t hash);
+  void addBigram(const StringView &term);
   void build();
   double getMagnitude();
-  std::vector<ScoredWord>&& getScores();
+
+  // applies to words added after the call; `reset()` keeps it.
+  void setInternTerms(bool internTerms);
+
+  // sorted by term id once `build()` has been called.
+  const std::vector<ScoredWord>& getScores();
+  size_t size();
+  void reset();
 };
 
 } // text_util
 } // relevanced
-
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace relevanced {
+namespace text_util {
+
+/**
+ * Hashed bigram features.
+ *
+ * A pair of adjacent stems is hashed into one of `2^bits` buckets,
+ * and the bucket is interned in the `TermDictionary` like any other
+ * term, under a name that no stem can have (`_` is never part of a
+ * token).  Documents, centroids and their persisted forms then
+ * treat bigrams as ordinary terms, while the number of distinct
+ * bigram terms can never exceed the bucket count.
+ *
+ * Buckets depend only on the stems' `fnv1a64` hashes, so they are
+ * stable across restarts.
+ */
+const size_t kMaxBigramBits = 24;
+
+// "_bg" followed by six hex digits.
+const size_t kBigramTermLength = 9;
+
+inline uint64_t bigramBucket(uint64_t leftHash, uint64_t rightHash,
+                             size_t bits) {
+  // order-sensitive combine, then a 64-bit finalizer so the low
+  // bits depend on every input bit.
+  uint64_t hash = leftHash * 0x9E3779B97F4A7C15ULL + rightHash;
+  hash ^= hash >> 30;
+  hash *= 0xBF58476D1CE4E5B9ULL;
+  hash ^= hash >> 27;
+  hash *= 0x94D049BB133111EBULL;
+  hash ^= hash >> 31;
+  return hash & ((1ULL << bits) - 1);
+}
+
+// writes exactly `kBigramTermLength` bytes to `out`.
+inline void formatBigramTerm(uint64_t bucket, char *out) {
+  static const char kHexDigits[] = "0123456789abcdef";
+  out[0] = '_';
+  out[1] = 'b';
+  out[2] = 'g';
+  for (size_t i = 0; i < 6; i++) {
+    out[8 - i] = kHexDigits[bucket & 0xf];
+    bucket >>= 4;
+  }
+}
+
+} // text_util
+} // relevanced
@@ -0,0 +1,20 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace relevanced {
+namespace text_util {
+
+// 64-bit FNV-1a.  Cheap enough to compute for every token as
+// it's emitted, and good enough for keying per-document maps.
+inline uint64_t fnv1a64(const char *data, size_t len) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= (uint8_t) data[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+} // text_util
+} // relevanced
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "text_util/ScoredWord.h"
+#include "text_util/TermDictionary.h"
 #include "util/util.h"
 
 using namespace std;
@@ -10,17 +11,25 @@ using namespace relevanced::util;
 TEST(TestScoredWord, Simple) {
   string dog {"dog"};
   ScoredWord word(dog.c_str(), 3, 1.5);
-  string copied = word.word;
-  EXPECT_EQ("dog", copied);
+  EXPECT_EQ("dog", word.getWord());
   EXPECT_EQ(1.5, word.score);
-  EXPECT_EQ(3, word.getSize());
 }
 
-TEST(TestScoredWord, WordTooLong) {
-  string fish {"fish|fish|fish|fish|fish|"};
+TEST(TestScoredWord, LongWordIsNotTruncated) {
+  string fish {"fish|fish|fish|fish|fish|fish|fish|fish|"};
   ScoredWord word(fish.c_str(), fish.size(), 1.5);
-  string copied = word.word;
-  EXPECT_EQ("fish|fish|fish|fish|fi", copied);
+  EXPECT_EQ(fish, word.getWord());
   EXPECT_EQ(1.5, word.score);
-  EXPECT_EQ(23, word.getSize());
-}
\ No newline at end of file
+}
+
+TEST(TestScoredWord, FromTermId) {
+  string cat {"cat"};
+  auto termId = TermDictionary::getDefault()->getId(cat);
+  ScoredWord word(termId, 0.25);
+  EXPECT_EQ("cat", word.getWord());
+  EXPECT_EQ(0.25, word.score);
+}
+
+TEST(TestScoredWord, Compact) {
+  EXPECT_EQ(8, sizeof(ScoredWord));
+}
@@ -0,0 +1,47 @@
+#include "gtest/gtest.h"
+#include <string>
+#include "text_util/TermDictionary.h"
+#include "text_util/StringView.h"
+#include "text_util/ScoredWord.h"
+
+using namespace std;
+using namespace relevanced;
+using namespace relevanced::text_util;
+
+TEST(TestTermDictionary, SameTermSameId) {
+  TermDictionary dictionary;
+  string dog {"dog"};
+  string alsoDog {"dog"};
+  auto id1 = dictionary.getId(dog);
+  auto id2 = dictionary.getId(StringView(alsoDog.c_str(), alsoDog.size()));
+  EXPECT_EQ(id1, id2);
+  EXPECT_EQ(1, dictionary.size());
+}
+
+TEST(TestTermDictionary, DistinctTermsDistinctIds) {
+  TermDictionary dictionary;
+  auto dogId = dictionary.getId(string("dog"));
+  auto dogsId = dictionary.getId(string("dogs"));
+  auto catId = dictionary.getId(string("cat"));
+  EXPECT_NE(dogId, dogsId);
+  EXPECT_NE(dogId, catId);
+  EXPECT_NE(TermDictionary::kNoTerm, dogId);
+  EXPECT_EQ("dog", dictionary.getTerm(dogId));
+  EXPECT_EQ("dogs", dictionary.getTerm(dogsId));
+  EXPECT_EQ("cat", dictionary.getTerm(catId));
+}
+
+TEST(TestTermDictionary, FindId) {
+  TermDictionary dictionary;
+  EXPECT_FALSE(dictionary.findId(string("fish")).hasValue());
+  auto fishId = dictionary.getId(string("fish"));
+  auto found = dictionary.findId(string("fish"));
+  EXPECT_TRUE(found.hasValue());
+  EXPECT_EQ(fishId, found.value());
+}
+
+TEST(TestTermDictionary, ScoredWordUsesDefaultDictionary) {
+  ScoredWord word("moose", 5, 0.5);
+  auto dictionary = TermDictionary::getDefault();
+  EXPECT_EQ("moose", dictionary->getTerm(word.termId));
+}
@@ -1,6 +1,9 @@
 #include "gtest/gtest.h"
+#include <cmath>
 #include "text_util/WordAccumulator.h"
 #include "text_util/StringView.h"
+#include "text_util/TermDictionary.h"
+#include "text_util/fnv.h"
 #include "util/util.h"
 
 
@@ -31,7 +34,7 @@ TEST(TestWordAccumulator, Simple) {
   auto scores = accumulator.getScores();
   set<string> scoreKeys;
   for (auto &score: scores) {
-    scoreKeys.insert(score.word);
+    scoreKeys.insert(score.getWord());
   }
   set<string> expectedKeys {"dog", "cat", "fish"};
   EXPECT_EQ(expectedKeys, scoreKeys);
@@ -58,8 +61,125 @@ TEST(TestWordAccumulator, Normalization) {
   auto scores = accumulator.getScores();
   map<string, double> scoreMap;
   for (auto &score: scores) {
-    string key = score.word;
+    string key = score.getWord();
     scoreMap.insert(make_pair(key, score.score));
   }
   EXPECT_TRUE(scoreMap["fish"] > scoreMap["dog"]);
-}
\ No newline at end of file
+}
+
+TEST(TestWordAccumulator, PrecomputedHashes) {
+  string dog {"dog"};
+  string dogs {"dogs"};
+  WordAccumulator accumulator {10};
+  StringView dogView(dog.c_str(), dog.size());
+  StringView stemmedView(dogs.c_str(), 3);
+  accumulator.add(dogView, fnv1a64(dog.c_str(), dog.size()));
+  accumulator.add(stemmedView, fnv1a64(dogs.c_str(), 3));
+  accumulator.add(dogView);
+  accumulator.build();
+  auto scores = accumulator.getScores();
+  EXPECT_EQ(1, scores.size());
+  EXPECT_EQ("dog", scores[0].getWord());
+  EXPECT_EQ(1.0, scores[0].score);
+}
+
+TEST(TestWordAccumulator, BigramsNormalizedSeparately) {
+  string dog {"dog"};
+  string cat {"cat"};
+  string bigram {"_bg000001"};
+  WordAccumulator accumulator {10};
+  accumulator.add(StringView(dog.c_str(), dog.size()));
+  accumulator.add(StringView(dog.c_str(), dog.size()));
+  accumulator.add(StringView(cat.c_str(), cat.size()));
+  accumulator.add(StringView(dog.c_str(), dog.size()));
+  accumulator.addBigram(StringView(bigram.c_str(), bigram.size()));
+  accumulator.build();
+  auto scores = accumulator.getScores();
+  map<string, double> scoreMap;
+  for (auto &score: scores) {
+    scoreMap.insert(make_pair(score.getWord(), score.score));
+  }
+  EXPECT_EQ(3, scoreMap.size());
+  EXPECT_FLOAT_EQ(0.75, scoreMap["dog"]);
+  EXPECT_FLOAT_EQ(0.25, scoreMap["cat"]);
+  EXPECT_FLOAT_EQ(1.0, scoreMap["_bg000001"]);
+  EXPECT_FLOAT_EQ(
+    sqrt(0.75 * 0.75 + 0.25 * 0.25 + 1.0), accumulator.getMagnitude()
+  );
+}
+
+TEST(TestWordAccumulator, OutlivesSourceBuffers) {
+  WordAccumulator accumulator {10};
+  for (size_t i = 0; i < 2000; i++) {
+    string buffer = "word" + to_string(i % 1000);
+    accumulator.add(StringView(buffer.c_str(), buffer.size()));
+    buffer.assign(buffer.size(), 'x');
+  }
+  accumulator.build();
+  auto scores = accumulator.getScores();
+  EXPECT_EQ(1000, scores.size());
+  for (auto &score : scores) {
+    EXPECT_EQ("word", score.getWord().substr(0, 4));
+    EXPECT_FLOAT_EQ(2.0 / 2000, score.score);
+  }
+}
+
+TEST(TestWordAccumulator, ResetForgetsWords) {
+  string dog {"dog"};
+  string cat {"cat"};
+  WordAccumulator accumulator {10};
+  accumulator.add(StringView(dog.c_str(), dog.size()));
+  accumulator.add(StringView(dog.c_str(), dog.size()));
+  accumulator.build();
+  EXPECT_EQ(1, accumulator.size());
+
+  accumulator.reset();
+  EXPECT_EQ(0, accumulator.size());
+  accumulator.add(StringView(cat.c_str(), cat.size()));
+  accumulator.add(StringView(dog.c_str(), dog.size()));
+  accumulator.build();
+  auto scores = accumulator.getScores();
+  map<string, double> scoreMap;
+  for (auto &score: scores) {
+    scoreMap.insert(make_pair(score.getWord(), score.score));
+  }
+  map<string, double> expected {{"cat", 0.5}, {"dog", 0.5}};
+  EXPECT_EQ(expected, scoreMap);
+}
+
+TEST(TestWordAccumulator, GrowsAndKeepsCollidingHashes) {
+  WordAccumulator accumulator {1};
+  for (size_t i = 0; i < 600; i++) {
+    string word = "grow" + to_string(i % 300);
+    // every word shares a hash, so lookups must compare the bytes.
+    accumulator.add(StringView(word.c_str(), word.size()), 17);
+  }
+  accumulator.build();
+  EXPECT_EQ(300, accumulator.size());
+  for (auto &score : accumulator.getScores()) {
+    EXPECT_FLOAT_EQ(2.0 / 600, score.score);
+  }
+}
+
+TEST(TestWordAccumulator, LookupOnlyDropsUnknownTerms) {
+  string known {"known-lookup-term"};
+  string unknown {"unknown-lookup-term"};
+  auto dictionary = TermDictionary::getDefault();
+  auto knownId = dictionary->getId(known);
+  size_t dictionarySize = dictionary->size();
+
+  WordAccumulator accumulator {10};
+  accumulator.setInternTerms(false);
+  accumulator.add(StringView(known.c_str(), known.size()));
+  accumulator.add(StringView(unknown.c_str(), unknown.size()));
+  accumulator.build();
+  EXPECT_EQ(dictionarySize, dictionary->size());
+  EXPECT_FALSE(dictionary->findId(unknown).hasValue());
+
+  // the unknown term is dropped, but still counts towards the magnitude.
+  auto &scores = accumulator.getScores();
+  EXPECT_EQ(1, scores.size());
+  EXPECT_EQ(knownId, scores.at(0).termId);
+  EXPECT_FLOAT_EQ(0.5, scores.at(0).score);
+  EXPECT_DOUBLE_EQ(sqrt(0.5), accumulator.getMagnitude());
+}
@@ -1,9 +1,13 @@
 #include "tokenizer/DestructiveTokenIterator.h"
 #include <tuple>
 #include <string>
+#include <vector>
 #include <utf8.h>
-#include "libunicode/code_point_support.h"
-#include "libunicode/UnicodeBlock.h"
+#include <glog/logging.h>
+#include "libunicode/code_point_table.h"
+#include "tokenizer/ascii_scan.h"
+#include "tokenizer/Token.h"
+#include "text_util/fnv.h"
 
 using namespace std;
 
@@ -11,28 +15,92 @@ namespace relevanced {
 namespace tokenizer {
 
 DestructiveTokenIterator::DestructiveTokenIterator(string &text)
-  : text_(text) {
-  outputIter_ = (char*) text.c_str();
-  inputIter_ = (char*) text.c_str();
-  inputBegin_ = inputIter_;
+  : DestructiveTokenIterator(text, 0, text.size()) {}
 
-  auto endPtr = ((uintptr_t) text.c_str()) + text.size();
-  inputEnd_ = (char*) endPtr;
+DestructiveTokenIterator::DestructiveTokenIterator(string &text,
+    size_t begin, size_t end) : text_(text) {
+  DCHECK(begin <= end && end <= text.size());
+  inputBegin_ = (char*) text.c_str();
+  inputIter_ = inputBegin_ + begin;
+  outputIter_ = inputIter_;
+  inputEnd_ = inputBegin_ + end;
+}
+
+// Runs the same state machine as the per-code-point loop in `next`
+// over `count` ASCII bytes that `scanAsciiChunk` has already
+// lowercased, a run of letters or non-letters at a time.  Returns
+// true when a token ends inside the chunk, with `inputIter_` just
+// past the non-letter that ended it.
+bool DestructiveTokenIterator::consumeAscii(size_t count, uint64_t letters,
+    size_t &currentSize, char *&currentStartPointer) {
+  char *chunk = inputIter_;
+  size_t pos = 0;
+  while (pos < count) {
+    // letters run from `pos` up to the first clear bit; the
+    // bits at and past `count` are always clear.
+    size_t letterRun = __builtin_ctzll(~(letters >> pos));
+    currentSize += letterRun;
+    pos += letterRun;
+    if (pos >= count) {
+      break;
+    }
+
+    // consume the non-letter at `pos`
+    pos++;
+    if (currentSize > 2) {
+      inputIter_ = chunk + pos;
+      return true;
+    }
+    currentSize = 0;
+    uint64_t remaining = letters >> pos;
+    if (remaining == 0) {
+      pos = count;
+    } else {
+      pos += __builtin_ctzll(remaining);
+    }
+    currentStartPointer = chunk + pos;
+  }
+  inputIter_ = chunk + count;
+  return false;
 }
 
 bool DestructiveTokenIterator::next(std::tuple<bool, size_t, size_t> &outTuple) {
   if (inputIter_ != inputEnd_) {
     size_t currentSize = 0;
     char *currentStartPointer = inputIter_;
+
+    // where the current token stops: at the non-letter that ended
+    // it, or at the end of input.
+    char *tokenEnd = inputEnd_;
     while (inputIter_ != inputEnd_) {
+      if (inputIter_ >= scannedEnd_
+          && (size_t) (inputEnd_ - inputIter_) >= kAsciiChunkSize) {
+        scannedBegin_ = inputIter_;
+        scannedEnd_ = inputIter_ + scanAsciiChunk(inputIter_, scannedLetters_);
+      }
+      if (inputIter_ < scannedEnd_) {
+        auto asciiCount = (size_t) (scannedEnd_ - inputIter_);
+        auto letters = scannedLetters_ >> (inputIter_ - scannedBegin_);
+        bool tokenEnded = consumeAscii(
+          asciiCount, letters, currentSize, currentStartPointer
+        );
+        outputIter_ = inputIter_;
+        if (tokenEnded) {
+          tokenEnd = inputIter_ - 1;
+          break;
+        }
+        continue;
+      }
+      char *codePointStart = inputIter_;
       auto codePoint = utf8::next(inputIter_, inputEnd_);
-      auto block = libunicode::getUnicodeBlock(codePoint);
-      codePoint = libunicode::normalizeCodePoint(codePoint, block);
+      auto &info = libunicode::lookupCodePoint(codePoint);
+      codePoint += info.lowercaseOffset;
       outputIter_ = utf8::append(codePoint, outputIter_);
-      if (libunicode::isLetterPoint(codePoint, block)) {
+      if (info.isLetter) {
         currentSize += 1;
       } else {
         if (currentSize > 2) {
+          tokenEnd = codePointStart;
           break;
         } else {
           currentSize = 0;
@@ -47,17 +115,14 @@ bool DestructiveTokenIterator::next(std::tuple<bool, size_t, size_t> &outTuple)
       // byte range we're interested in based on the number
       // of code points we have. (they vary in size)
 
-      // instead we calculate byte range based on current position
-      // of the iterator (set by the utf8 library), the position
-      // of that iterator at the start of this "good word cycle",
-      // and the pointer to the base of the string.
+      // instead we calculate byte range based on where the token
+      // stopped (`tokenEnd`), the position of the iterator at the
+      // start of this "good word cycle", and the pointer to the
+      // base of the string.
 
       auto inputStart = (uintptr_t) inputBegin_;
       uintptr_t startChar = ((uintptr_t) currentStartPointer) - inputStart;
-      uintptr_t endChar = ((uintptr_t) inputIter_) - inputStart;
-      if (inputIter_ != inputEnd_) {
-        endChar -= 1;
-      }
+      uintptr_t endChar = ((uintptr_t) tokenEnd) - inputStart;
       size_t startSt = (size_t) startChar;
       size_t endSt = (size_t) endChar;
       std::get<0>(outTuple) = true;
@@ -72,5 +137,21 @@ bool DestructiveTokenIterator::next(std::tuple<bool, size_t, size_t> &outTuple)
   return false;
 }
 
+size_t DestructiveTokenIterator::tokenize(vector<Token> &tokens,
+                                          size_t maxTokens) {
+  const char *base = text_.c_str();
+  std::tuple<bool, size_t, size_t> offsets;
+  size_t added = 0;
+  while (added < maxTokens && next(offsets)) {
+    Token token;
+    token.offset = (uint32_t) std::get<1>(offsets);
+    token.length = (uint32_t) (std::get<2>(offsets) - token.offset);
+    token.hash = text_util::fnv1a64(base + token.offset, token.length);
+    tokens.push_back(token);
+    added++;
+  }
+  return added;
+}
+
 } // tokenizer
-} // relevanced
\ No newline at end of file
+} // relevanced
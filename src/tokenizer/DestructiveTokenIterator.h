@@ -1,6 +1,12 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <tuple>
+#include <vector>
+
+#include "tokenizer/Token.h"
 
 namespace relevanced {
 namespace tokenizer {
@@ -14,9 +20,31 @@ class DestructiveTokenIterator {
 
   char *outputIter_ {nullptr};
 
+  // the last chunk `scanAsciiChunk` classified, which usually
+  // holds several short tokens.
+  char *scannedBegin_ {nullptr};
+  char *scannedEnd_ {nullptr};
+  uint64_t scannedLetters_ {0};
+
+  bool consumeAscii(size_t count, uint64_t letters,
+    size_t &currentSize, char *&currentStartPointer);
+
  public:
   DestructiveTokenIterator(std::string &text);
+
+  // tokenizes only `text[begin, end)`; offsets are still relative
+  // to the start of `text`.
+  DestructiveTokenIterator(std::string &text, size_t begin, size_t end);
   bool next(std::tuple<bool, size_t, size_t> &outTuple);
+
+  // appends up to `maxTokens` of the remaining tokens to `tokens`
+  // and returns how many it added.  Calling it repeatedly with a
+  // bound streams through a large document in fixed-size batches;
+  // it returns 0 once the text is exhausted.
+  size_t tokenize(
+    std::vector<Token> &tokens,
+    size_t maxTokens = std::numeric_limits<size_t>::max()
+  );
 };
 
 } // tokenizer
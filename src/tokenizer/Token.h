@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+
+namespace relevanced {
+namespace tokenizer {
+
+/**
+ * A token emitted by `DestructiveTokenIterator::tokenize`: a byte
+ * range into the (already normalized) text, plus the FNV-1a hash
+ * of those bytes.
+ *
+ * Later stages shorten tokens in place (stemming, truncation);
+ * whoever changes `length` is responsible for updating `hash`.
+ */
+struct Token {
+  uint32_t offset;
+  uint32_t length;
+  uint64_t hash;
+};
+
+} // tokenizer
+} // relevanced
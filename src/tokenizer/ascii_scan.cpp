@@ -0,0 +1,108 @@
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "tokenizer/ascii_scan.h"
+
+namespace relevanced {
+namespace tokenizer {
+
+#if defined(__SSE2__)
+
+namespace {
+
+size_t finishScan(uint32_t nonAscii, uint32_t letterBits, uint64_t &letters) {
+  size_t asciiCount = kAsciiChunkSize;
+  if (nonAscii != 0) {
+    asciiCount = __builtin_ctz(nonAscii);
+  }
+  letters = letterBits & ((((uint64_t) 1) << asciiCount) - 1);
+  return asciiCount;
+}
+
+// bytes >= 0x80 compare as negative, so they never fall in
+// either range and pass through unchanged.
+size_t scanSse2(char *data, uint64_t &letters) {
+  const __m128i beforeUpperA = _mm_set1_epi8('A' - 1);
+  const __m128i afterUpperZ = _mm_set1_epi8('Z' + 1);
+  const __m128i beforeLowerA = _mm_set1_epi8('a' - 1);
+  const __m128i afterLowerZ = _mm_set1_epi8('z' + 1);
+  const __m128i caseBit = _mm_set1_epi8(32);
+  uint32_t nonAscii = 0;
+  uint32_t letterBits = 0;
+  for (size_t offset = 0; offset < kAsciiChunkSize; offset += 16) {
+    __m128i *ptr = (__m128i*) (data + offset);
+    __m128i bytes = _mm_loadu_si128(ptr);
+    __m128i isUpper = _mm_and_si128(
+      _mm_cmpgt_epi8(bytes, beforeUpperA),
+      _mm_cmplt_epi8(bytes, afterUpperZ)
+    );
+    bytes = _mm_add_epi8(bytes, _mm_and_si128(isUpper, caseBit));
+    _mm_storeu_si128(ptr, bytes);
+    __m128i isLetter = _mm_and_si128(
+      _mm_cmpgt_epi8(bytes, beforeLowerA),
+      _mm_cmplt_epi8(bytes, afterLowerZ)
+    );
+    nonAscii |= ((uint32_t) _mm_movemask_epi8(bytes)) << offset;
+    letterBits |= ((uint32_t) _mm_movemask_epi8(isLetter)) << offset;
+  }
+  return finishScan(nonAscii, letterBits, letters);
+}
+
+__attribute__((target("avx2")))
+size_t scanAvx2(char *data, uint64_t &letters) {
+  const __m256i beforeUpperA = _mm256_set1_epi8('A' - 1);
+  const __m256i afterUpperZ = _mm256_set1_epi8('Z' + 1);
+  const __m256i beforeLowerA = _mm256_set1_epi8('a' - 1);
+  const __m256i afterLowerZ = _mm256_set1_epi8('z' + 1);
+  const __m256i caseBit = _mm256_set1_epi8(32);
+  __m256i *ptr = (__m256i*) data;
+  __m256i bytes = _mm256_loadu_si256(ptr);
+  __m256i isUpper = _mm256_and_si256(
+    _mm256_cmpgt_epi8(bytes, beforeUpperA),
+    _mm256_cmpgt_epi8(afterUpperZ, bytes)
+  );
+  bytes = _mm256_add_epi8(bytes, _mm256_and_si256(isUpper, caseBit));
+  _mm256_storeu_si256(ptr, bytes);
+  __m256i isLetter = _mm256_and_si256(
+    _mm256_cmpgt_epi8(bytes, beforeLowerA),
+    _mm256_cmpgt_epi8(afterLowerZ, bytes)
+  );
+  return finishScan(
+    (uint32_t) _mm256_movemask_epi8(bytes),
+    (uint32_t) _mm256_movemask_epi8(isLetter),
+    letters
+  );
+}
+
+typedef size_t (*AsciiScanner)(char*, uint64_t&);
+
+AsciiScanner chooseScanner() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return scanAvx2;
+  }
+  return scanSse2;
+}
+
+} // anonymous namespace
+
+size_t scanAsciiChunk(char *data, uint64_t &letters) {
+  static const AsciiScanner scanner = chooseScanner();
+  return scanner(data, letters);
+}
+
+#else
+
+size_t scanAsciiChunk(char*, uint64_t &letters) {
+  letters = 0;
+  return 0;
+}
+
+#endif
+
+} // tokenizer
+} // relevanced
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace relevanced {
+namespace tokenizer {
+
+// bytes examined by each call to `scanAsciiChunk`.
+const size_t kAsciiChunkSize = 32;
+
+/**
+ * Vectorized fast path for the tokenizer.
+ *
+ * Looks at the `kAsciiChunkSize` bytes starting at `data`,
+ * lowercases any ASCII capitals among them in place and returns
+ * how many leading bytes are ASCII (i.e. < 0x80).  Bit `i` of
+ * `letters` is set when byte `i` of that ASCII prefix is a letter.
+ *
+ * Bytes >= 0x80 are left untouched, so it's safe to call on a
+ * chunk that only starts with ASCII.
+ *
+ * Uses AVX2 when the CPU supports it, SSE2 otherwise; on other
+ * architectures it always returns 0 and the caller falls back
+ * to decoding code points one at a time.
+ */
+size_t scanAsciiChunk(char *data, uint64_t &letters);
+
+} // tokenizer
+} // relevanced
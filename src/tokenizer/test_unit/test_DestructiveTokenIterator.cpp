@@ -3,9 +3,13 @@
 #include <vector>
 #include "gtest/gtest.h"
 #include "tokenizer/DestructiveTokenIterator.h"
+#include "tokenizer/Token.h"
+#include "text_util/fnv.h"
 
 using namespace std;
 using relevanced::tokenizer::DestructiveTokenIterator;
+using relevanced::tokenizer::Token;
+using relevanced::text_util::fnv1a64;
 
 TEST(TestDestructiveTokenIterator, SimpleTest) {
   string text = "this is some text";
@@ -61,3 +65,116 @@ TEST(TestDestructiveTokenIterator, TestRepeatedPunctuation) {
   };
   EXPECT_EQ(expected, tokens);
 }
+
+TEST(TestDestructiveTokenIterator, TestLongAsciiText) {
+  // long enough to go through the vectorized path, with
+  // tokens straddling its chunk boundaries.
+  string text = "Short words: an ox is ok, but ELEPHANTINE-SIZED "
+                "rhinoceroses wander; yes!!";
+  DestructiveTokenIterator iter(text);
+  vector<string> tokens;
+  tuple<bool, size_t, size_t> current;
+  while (iter.next(current)) {
+    if (!get<0>(current)) {
+      break;
+    }
+    auto start = get<1>(current);
+    tokens.push_back(text.substr(start, get<2>(current) - start));
+  }
+  vector<string> expected {
+    "short", "words", "but", "elephantine", "sized",
+    "rhinoceroses", "wander", "yes"
+  };
+  EXPECT_EQ(expected, tokens);
+}
+
+TEST(TestDestructiveTokenIterator, TestMixedAsciiAndUnicode) {
+  string text = "Größere Häuser stehen im DORF, und Straßen führen "
+                "ÜBERALL hin; schön! Ja";
+  DestructiveTokenIterator iter(text);
+  vector<string> tokens;
+  tuple<bool, size_t, size_t> current;
+  while (iter.next(current)) {
+    if (!get<0>(current)) {
+      break;
+    }
+    auto start = get<1>(current);
+    tokens.push_back(text.substr(start, get<2>(current) - start));
+  }
+  vector<string> expected {
+    "größere", "häuser", "stehen", "dorf", "und", "straßen",
+    "führen", "überall", "hin", "schön"
+  };
+  EXPECT_EQ(expected, tokens);
+}
+
+TEST(TestDestructiveTokenIterator, TestTokenize) {
+  string text = "this is some TEXt, ok?";
+  DestructiveTokenIterator iter(text);
+  vector<Token> tokens;
+  EXPECT_EQ(3, iter.tokenize(tokens));
+  vector<string> words;
+  for (auto &token : tokens) {
+    string word = text.substr(token.offset, token.length);
+    EXPECT_EQ(fnv1a64(word.data(), word.size()), token.hash);
+    words.push_back(word);
+  }
+  vector<string> expected {
+    "this", "some", "text"
+  };
+  EXPECT_EQ(expected, words);
+  EXPECT_EQ(0, iter.tokenize(tokens));
+}
+
+TEST(TestDestructiveTokenIterator, TestTokenizeInBatches) {
+  string text = "one two three four five six seven";
+  DestructiveTokenIterator iter(text);
+  vector<Token> tokens;
+  EXPECT_EQ(2, iter.tokenize(tokens, 2));
+  EXPECT_EQ(2, iter.tokenize(tokens, 2));
+  EXPECT_EQ(2, iter.tokenize(tokens, 2));
+  EXPECT_EQ(1, iter.tokenize(tokens, 2));
+  EXPECT_EQ(0, iter.tokenize(tokens, 2));
+  vector<string> words;
+  for (auto &token : tokens) {
+    words.push_back(text.substr(token.offset, token.length));
+  }
+  vector<string> expected {
+    "one", "two", "three", "four", "five", "six", "seven"
+  };
+  EXPECT_EQ(expected, words);
+}
+
+TEST(TestDestructiveTokenIterator, TestTrailingDelimiter) {
+  // the non-letter that ends the input isn't part of the token,
+  // whether it's one byte or several.
+  string text = "some text. more»";
+  DestructiveTokenIterator iter(text);
+  vector<Token> tokens;
+  iter.tokenize(tokens);
+  vector<string> words;
+  for (auto &token : tokens) {
+    words.push_back(text.substr(token.offset, token.length));
+  }
+  vector<string> expected {
+    "some", "text", "more"
+  };
+  EXPECT_EQ(expected, words);
+}
+
+TEST(TestDestructiveTokenIterator, TestRange) {
+  string text = "SKIPPED first Second third SKIPPED";
+  DestructiveTokenIterator iter(text, 8, 26);
+  vector<Token> tokens;
+  EXPECT_EQ(3, iter.tokenize(tokens));
+  vector<string> words;
+  for (auto &token : tokens) {
+    words.push_back(text.substr(token.offset, token.length));
+  }
+  vector<string> expected {
+    "first", "second", "third"
+  };
+  EXPECT_EQ(expected, words);
+  EXPECT_EQ("SKIPPED", text.substr(0, 7));
+  EXPECT_EQ("SKIPPED", text.substr(27));
+}
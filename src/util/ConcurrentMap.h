@@ -2,6 +2,8 @@
 
 #include <memory>
 #include <exception>
+#include <utility>
+#include <vector>
 #include <folly/ConcurrentSkipList.h>
 #include <folly/Optional.h>
 #include "util/MultiVersionPtr.h"
@@ -74,6 +76,10 @@ public:
     util::UniquePointer<TVal> tempV = std::move(val);
     val_.reset(tempV.release());
   }
+  void setValuePtr(const TReadPtr &val) {
+    hasValue_ = true;
+    val_ = val;
+  }
   friend struct std::less<TItem>;
 };
 
@@ -114,11 +120,23 @@ public:
     auto it = accessor.find(toFind);
     if (it.good()) {
       it->setValue(std::move(val));
-    } else {
-      TItem item(key, std::move(val));
-      accessor.addOrGetData(item);
+      return;
+    }
+    TItem item(key, std::move(val));
+    auto added = accessor.addOrGetData(item);
+    if (!added.second) {
+      // another writer inserted the key since `find`; ours is newer.
+      added.first->setValuePtr(item.getValuePtr());
     }
   }
+
+  // leaves an existing value in place.  Returns true if `val` was
+  // inserted.
+  bool insertIfAbsent(const TKey &key, util::UniquePointer<TVal> &&val) {
+    TItem item(key, std::move(val));
+    typename TSkipList::Accessor accessor(skipList_);
+    return accessor.addOrGetData(item).second;
+  }
   bool erase(const TKey &key) {
     TItem toErase(key);
     typename TSkipList::Accessor accessor(skipList_);
@@ -135,6 +153,14 @@ public:
     }
     return result;
   }
+  std::vector<std::pair<TKey, TValReadPtr>> getAll() {
+    std::vector<std::pair<TKey, TValReadPtr>> result;
+    typename TSkipList::Accessor accessor(skipList_);
+    for (auto it = accessor.begin(); it != accessor.end(); ++it) {
+      result.push_back(std::make_pair(it->getKey(), it->getValuePtr()));
+    }
+    return result;
+  }
 };
 
 
@@ -108,7 +108,7 @@ public:
         auto base = new MultiVersionPtr<T>(newParent, this);
         ((void) base);
       }
-      T *get() {
+      T *get() const {
         auto currentBase = base.load();
         DCHECK(currentBase != nullptr);
         auto result = currentBase->getPtr();
@@ -133,7 +133,7 @@ public:
         setBase(other.base.load());
         return *this;
       }
-      T *operator->() {
+      T *operator->() const {
         auto currentBase = base.load();
         DCHECK(currentBase != nullptr);
         return currentBase->getPtr();
@@ -57,3 +57,36 @@ TEST(TestConcurrentMap, Simple) {
 }
 
 
+
+TEST(TestConcurrentMap, GetAll) {
+  {
+    ConcurrentMap<string, Something> aMap {10};
+    aMap.insertOrUpdate("x", UniquePointer<Something>(new Something("x")));
+    aMap.insertOrUpdate("y", UniquePointer<Something>(new Something("y")));
+    aMap.insertOrUpdate("z", UniquePointer<Something>(new Something("z")));
+    aMap.erase("y");
+    auto all = aMap.getAll();
+    EXPECT_EQ(2, all.size());
+    EXPECT_EQ("x", all.at(0).first);
+    EXPECT_EQ("x", all.at(0).second->id);
+    EXPECT_EQ("z", all.at(1).first);
+    EXPECT_EQ("z", all.at(1).second->id);
+  }
+  Something::resetDeletedIds();
+}
+
+TEST(TestConcurrentMap, InsertIfAbsent) {
+  {
+    ConcurrentMap<string, Something> aMap {10};
+    EXPECT_TRUE(aMap.insertIfAbsent(
+      "x", UniquePointer<Something>(new Something("x1"))
+    ));
+    EXPECT_FALSE(aMap.insertIfAbsent(
+      "x", UniquePointer<Something>(new Something("x2"))
+    ));
+    EXPECT_EQ("x1", aMap.getOption("x").value()->id);
+    aMap.insertOrUpdate("x", UniquePointer<Something>(new Something("x3")));
+    EXPECT_EQ("x3", aMap.getOption("x").value()->id);
+  }
+  Something::resetDeletedIds();
+}
@@ -55,3 +55,12 @@ TEST(TestUtil, TestOptionOfFutureTrySad) {
 }
 
 
+
+TEST(TestUtil, TestSha1StreamMatchesSha1) {
+  string text = "some text that arrives in a few separate pieces";
+  util::Sha1Stream stream;
+  stream.update(text.data(), 10);
+  stream.update(text.data() + 10, 0);
+  stream.update(text.data() + 10, text.size() - 10);
+  EXPECT_EQ(util::sha1(text), stream.finish());
+}
@@ -41,12 +41,9 @@ int64_t getChronoEpochTime() {
   return secs.count();
 }
 
-string sha1(const string &input) {
-  size_t hashLen = 20;
-  unsigned char hashBuff[hashLen];
-  SHA1((const unsigned char *) input.c_str(), input.size(), hashBuff);
+static string hexOfSha1Digest(const unsigned char *hashBuff) {
   ostringstream output;
-  for (size_t i = 0; i < hashLen; i++) {
+  for (size_t i = 0; i < SHA_DIGEST_LENGTH; i++) {
     unsigned char c = hashBuff[i];
     int current = c;
     output << std::hex << current;
@@ -54,6 +51,26 @@ string sha1(const string &input) {
   return output.str();
 }
 
+string sha1(const string &input) {
+  unsigned char hashBuff[SHA_DIGEST_LENGTH];
+  SHA1((const unsigned char *) input.c_str(), input.size(), hashBuff);
+  return hexOfSha1Digest(hashBuff);
+}
+
+Sha1Stream::Sha1Stream() {
+  SHA1_Init(&context_);
+}
+
+void Sha1Stream::update(const char *data, size_t len) {
+  SHA1_Update(&context_, data, len);
+}
+
+string Sha1Stream::finish() {
+  unsigned char hashBuff[SHA_DIGEST_LENGTH];
+  SHA1_Final(hashBuff, &context_);
+  return hexOfSha1Digest(hashBuff);
+}
+
 const char* countryCodeOfThriftLanguage(Language lang) {
   switch (lang) {
     case Language::DE : return "de";
@@ -63,6 +80,7 @@ const char* countryCodeOfThriftLanguage(Language lang) {
     case Language::IT : return "it";
     case Language::RU : return "ru";
     case Language::OTHER : return "OTHER";
+    case Language::AUTO : return "AUTO";
     default           : return "UNKNOWN";
   }
 }
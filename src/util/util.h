@@ -12,6 +12,7 @@
 #include <folly/futures/Try.h>
 #include <folly/futures/Future.h>
 #include <folly/Optional.h>
+#include <openssl/sha.h>
 #include "gen-cpp2/RelevancedProtocol_types.h"
 
 namespace relevanced {
@@ -132,6 +133,17 @@ bool isOnlyAscii(const std::string &text);
 int64_t getChronoEpochTime();
 std::string sha1(const std::string &input);
 
+// `sha1` over text that arrives in pieces: `finish()` returns the
+// same string `sha1` would for all of the `update` calls' bytes
+// concatenated.
+class Sha1Stream {
+  SHA_CTX context_;
+ public:
+  Sha1Stream();
+  void update(const char *data, size_t len);
+  std::string finish();
+};
+
 const char *countryCodeOfThriftLanguage(thrift_protocol::Language);
 
 template<typename T>